@@ -13,8 +13,11 @@
  * limitations under the License.
  */
 #include "cloud_report_cacher.h"
+
+#include <algorithm>
+#include <iterator>
+
 #include "hisysevent.h"
-#include "nlohmann/json.hpp"
 #include "cloud_file_log.h"
 #include "cloud_file_fault_event.h"
  
@@ -24,9 +27,189 @@ namespace CloudFile {
 using namespace std;
 
 constexpr int MAX_CACHE_SIZE = 20;
+// one report never carries more events than the cache limit used to hand over at once
+constexpr size_t MAX_REPORT_EVENTS = MAX_CACHE_SIZE + 1;
 constexpr int REPORT_VERSION = 2;
+constexpr uint64_t FLUSH_COALESCE_DELAY_US = 200 * 1000;
+constexpr size_t REPORT_ITEM_RESERVE = 160;
+constexpr unsigned char JSON_CONTROL_LIMIT = 0x20;
+constexpr unsigned char UTF8_CONT_MASK = 0xC0;
+constexpr unsigned char UTF8_CONT_TAG = 0x80;
 
-CloudReportCacher::CloudReportCacher()
+namespace {
+size_t GetUtf8SequenceLength(unsigned char lead)
+{
+    constexpr unsigned char twoByteMin = 0xC2;
+    constexpr unsigned char threeByteMin = 0xE0;
+    constexpr unsigned char fourByteMin = 0xF0;
+    constexpr unsigned char fourByteMax = 0xF4;
+    if (lead < UTF8_CONT_TAG) {
+        return 1;
+    }
+    if (lead < twoByteMin || lead > fourByteMax) {
+        return 0;
+    }
+    if (lead < threeByteMin) {
+        return 2; // 2: two byte sequence
+    }
+    return lead < fourByteMin ? 3 : 4; // 3, 4: three and four byte sequences
+}
+
+/* The second byte of E0, ED, F0 and F4 is narrowed to reject overlong forms, surrogates and values above U+10FFFF. */
+bool IsValidUtf8Sequence(const string &value, size_t pos, size_t length)
+{
+    constexpr unsigned char contMax = 0xBF;
+    if (pos + length > value.size()) {
+        return false;
+    }
+    unsigned char lead = static_cast<unsigned char>(value[pos]);
+    unsigned char secondMin = UTF8_CONT_TAG;
+    unsigned char secondMax = contMax;
+    switch (lead) {
+        case 0xE0:
+            secondMin = 0xA0;
+            break;
+        case 0xED:
+            secondMax = 0x9F;
+            break;
+        case 0xF0:
+            secondMin = 0x90;
+            break;
+        case 0xF4:
+            secondMax = 0x8F;
+            break;
+        default:
+            break;
+    }
+    unsigned char second = static_cast<unsigned char>(value[pos + 1]);
+    if (second < secondMin || second > secondMax) {
+        return false;
+    }
+    for (size_t k = 2; k < length; k++) {
+        if ((static_cast<unsigned char>(value[pos + k]) & UTF8_CONT_MASK) != UTF8_CONT_TAG) {
+            return false;
+        }
+    }
+    return true;
+}
+
+const char *GetJsonEscape(unsigned char c)
+{
+    switch (c) {
+        case '"':
+            return "\\\"";
+        case '\\':
+            return "\\\\";
+        case '\b':
+            return "\\b";
+        case '\f':
+            return "\\f";
+        case '\n':
+            return "\\n";
+        case '\r':
+            return "\\r";
+        case '\t':
+            return "\\t";
+        default:
+            return nullptr;
+    }
+}
+
+/* Escapes like nlohmann dump without ensure_ascii, invalid utf-8 bytes are dropped as error_handler ignore does. */
+void AppendJsonString(string &out, const string &value)
+{
+    static const char *hexDigits = "0123456789abcdef";
+    constexpr int highNibbleShift = 4;
+    constexpr unsigned char lowNibbleMask = 0x0F;
+    out.push_back('"');
+    size_t i = 0;
+    while (i < value.size()) {
+        unsigned char c = static_cast<unsigned char>(value[i]);
+        size_t length = GetUtf8SequenceLength(c);
+        if (length > 1) {
+            if (IsValidUtf8Sequence(value, i, length)) {
+                out.append(value, i, length);
+                i += length;
+            } else {
+                i++;
+            }
+            continue;
+        }
+        i++;
+        const char *escaped = GetJsonEscape(c);
+        if (escaped != nullptr) {
+            out.append(escaped);
+        } else if (c < JSON_CONTROL_LIMIT) {
+            out.append("\\u00");
+            out.push_back(hexDigits[c >> highNibbleShift]);
+            out.push_back(hexDigits[c & lowNibbleMask]);
+        } else if (length == 1) {
+            out.push_back(static_cast<char>(c));
+        }
+    }
+    out.push_back('"');
+}
+} // namespace
+
+FaultEventRing::FaultEventRing()
+{
+    for (size_t i = 0; i < CAPACITY; i++) {
+        slots_[i].seq.store(i, memory_order_relaxed);
+    }
+}
+
+bool FaultEventRing::TryPush(const CloudFaultInfo &event)
+{
+    size_t pos = tail_.load(memory_order_relaxed);
+    Slot *slot = nullptr;
+    while (true) {
+        slot = &slots_[pos & MASK];
+        size_t seq = slot->seq.load(memory_order_acquire);
+        if (seq == pos) {
+            if (tail_.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) {
+                break;
+            }
+        } else if (seq < pos) {
+            return false;
+        } else {
+            pos = tail_.load(memory_order_relaxed);
+        }
+    }
+    slot->event = event;
+    slot->seq.store(pos + 1, memory_order_release);
+    return true;
+}
+
+bool FaultEventRing::TryPop(CloudFaultInfo &event)
+{
+    size_t pos = head_.load(memory_order_relaxed);
+    Slot *slot = nullptr;
+    while (true) {
+        slot = &slots_[pos & MASK];
+        size_t seq = slot->seq.load(memory_order_acquire);
+        if (seq == pos + 1) {
+            if (head_.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) {
+                break;
+            }
+        } else if (seq < pos + 1) {
+            return false;
+        } else {
+            pos = head_.load(memory_order_relaxed);
+        }
+    }
+    event = move(slot->event);
+    slot->seq.store(pos + CAPACITY, memory_order_release);
+    return true;
+}
+
+size_t FaultEventRing::Size() const
+{
+    size_t tail = tail_.load(memory_order_relaxed);
+    size_t head = head_.load(memory_order_relaxed);
+    return tail > head ? tail - head : 0;
+}
+
+CloudReportCacher::CloudReportCacher() : flushQueue_("cloudReportFlush")
 {
 }
 
@@ -46,6 +229,7 @@ void CloudReportCacher::Init(const string &bundleName, const string &traceId, co
     if (!GetReportInfo(bundleName, reportInfo)) {
         return;
     }
+    lock_guard<mutex> lock(reportInfo->flushMutex_);
     reportInfo->traceId_ = traceId;
     reportInfo->scenarioCode_ = scenarioCode;
 }
@@ -60,6 +244,7 @@ void CloudReportCacher::SetScenarioCode(const string &bundleName, const uint32_t
     if (!GetReportInfo(bundleName, reportInfo)) {
         return;
     }
+    lock_guard<mutex> lock(reportInfo->flushMutex_);
     reportInfo->scenarioCode_ = scenarioCode;
 }
 
@@ -69,17 +254,30 @@ void CloudReportCacher::PushEvent(const string &bundleName, const CloudFaultInfo
     if (!GetReportInfo(bundleName, reportInfo)) {
         return;
     }
-    bool exceededLimit = false;
-    {
-        unique_lock<mutex> lock(eventsMutex_);
-        reportInfo->events_.emplace_back(event);
-        exceededLimit = reportInfo->events_.size() > MAX_CACHE_SIZE;
+    if (!reportInfo->events_.TryPush(event)) {
+        // the storm outran the background flush, drain this bundle inline once before giving up on the event
+        Flush(bundleName, reportInfo, 0);
+        if (!reportInfo->events_.TryPush(event)) {
+            reportInfo->droppedCount_.fetch_add(1, memory_order_relaxed);
+            return;
+        }
     }
-    if (exceededLimit) {
-        Report(bundleName, reportInfo->lastScheduleType_ + 1);
+    if (reportInfo->events_.Size() > MAX_CACHE_SIZE) {
+        ScheduleFlush(bundleName, reportInfo);
     }
 }
 
+void CloudReportCacher::ScheduleFlush(const string &bundleName, const shared_ptr<ReportInfo> &reportInfo)
+{
+    if (reportInfo->flushScheduled_.exchange(true)) {
+        return;
+    }
+    flushQueue_.submit([this, bundleName, reportInfo]() {
+        reportInfo->flushScheduled_.store(false);
+        Flush(bundleName, reportInfo, 0);
+    }, ffrt::task_attr().delay(FLUSH_COALESCE_DELAY_US));
+}
+
 void CloudReportCacher::Report(const string &bundleName, const int scheduleType)
 {
     if (scheduleType <= 0) {
@@ -90,34 +288,92 @@ void CloudReportCacher::Report(const string &bundleName, const int scheduleType)
     if (!GetReportInfo(bundleName, reportInfo)) {
         return;
     }
-    reportInfo->lastScheduleType_ = scheduleType;
-    unique_lock<mutex> lock(eventsMutex_);
-    if (reportInfo->events_.empty()) {
+    Flush(bundleName, reportInfo, scheduleType);
+}
+
+/*
+ * scheduleType 0 reports the overflow of the running schedule as the next one, like the cache limit used to.
+ * A backlog is split into reports of at most MAX_REPORT_EVENTS, all but the last one numbered as overflows.
+ */
+void CloudReportCacher::Flush(const string &bundleName, const shared_ptr<ReportInfo> &reportInfo,
+    const int32_t scheduleType)
+{
+    lock_guard<mutex> lock(reportInfo->flushMutex_);
+    // only take what is queued now, producers keep pushing while the batch is serialized
+    size_t pending = reportInfo->events_.Size();
+    vector<CloudFaultInfo> events;
+    events.reserve(pending);
+    CloudFaultInfo event;
+    while (events.size() < pending && reportInfo->events_.TryPop(event)) {
+        events.emplace_back(move(event));
+    }
+    if (events.empty()) {
+        reportInfo->lastScheduleType_ = scheduleType > 0 ? scheduleType : reportInfo->lastScheduleType_ + 1;
         return;
     }
+    uint64_t dropped = reportInfo->droppedCount_.load(memory_order_relaxed);
+    if (dropped != reportInfo->loggedDropCount_) {
+        LOGW("%{public}s dropped %{public}llu fault events in total", bundleName.c_str(),
+            static_cast<unsigned long long>(dropped));
+        reportInfo->loggedDropCount_ = dropped;
+    }
+    for (size_t begin = 0; begin < events.size(); begin += MAX_REPORT_EVENTS) {
+        size_t end = min(begin + MAX_REPORT_EVENTS, events.size());
+        bool last = end == events.size();
+        int32_t schedule = (last && scheduleType > 0) ? scheduleType : reportInfo->lastScheduleType_ + 1;
+        reportInfo->lastScheduleType_ = schedule;
+        vector<CloudFaultInfo> batch(make_move_iterator(events.begin() + begin),
+            make_move_iterator(events.begin() + end));
+        ReportBatch(bundleName, reportInfo, batch, schedule);
+    }
+}
 
-    nlohmann::json jsonArr = nlohmann::json::array();
-    CloudFaultInfo terminateEvent = reportInfo->events_[reportInfo->events_.size() - 1];
+void CloudReportCacher::ReportBatch(const string &bundleName, const shared_ptr<ReportInfo> &reportInfo,
+    const vector<CloudFaultInfo> &events, const int32_t schedule)
+{
+    CloudFaultInfo terminateEvent = events.back();
     terminateEvent.faultType_ = static_cast<uint32_t>(FaultType::WARNING);
-    for (auto it = reportInfo->events_.begin(); it != reportInfo->events_.end(); ++it) {
-        CloudFaultInfo& event = *it;
-        nlohmann::json jsonItem;
-        jsonItem["version"] = REPORT_VERSION;
-        jsonItem["trace_id"] = reportInfo->traceId_;
-        jsonItem["schedule"] = scheduleType;
-        jsonItem["fault_error_code"] = event.faultErrorCode_ ;
-        jsonItem["function_name"] = event.funcName_;
-        jsonItem["fault_time"] = event.faultTime_;
-        jsonItem["message"] = event.message_;
-        jsonArr.push_back(jsonItem);
-        if (event.terminate_) {
-            terminateEvent = event;
+    for (const auto &item : events) {
+        if (item.terminate_) {
+            terminateEvent = item;
             terminateEvent.faultType_ = static_cast<uint32_t>(FaultType::CLOUD_SYNC_ERROR);
         }
     }
-    terminateEvent.message_ = jsonArr.dump(-1, ' ', false, nlohmann::detail::error_handler_t::ignore);
+    terminateEvent.message_ = BuildReportMessage(events, reportInfo->traceId_, schedule);
     ReportFaultInfo(terminateEvent, bundleName, reportInfo->scenarioCode_);
-    reportInfo->events_.clear();
+    reportInfo->reportedCount_.fetch_add(events.size(), memory_order_relaxed);
+}
+
+/* Same text as the former nlohmann array dump, keys stay in its sorted order. */
+string CloudReportCacher::BuildReportMessage(const vector<CloudFaultInfo> &events, const string &traceId,
+    const int32_t scheduleType)
+{
+    size_t reserve = 2; // 2: brackets
+    for (const auto &event : events) {
+        reserve += REPORT_ITEM_RESERVE + traceId.size() + event.funcName_.size() + event.message_.size();
+    }
+    string out;
+    out.reserve(reserve);
+    string schedule = to_string(scheduleType);
+    out.push_back('[');
+    for (size_t i = 0; i < events.size(); i++) {
+        const CloudFaultInfo &event = events[i];
+        if (i != 0) {
+            out.push_back(',');
+        }
+        out.append("{\"fault_error_code\":").append(to_string(event.faultErrorCode_));
+        out.append(",\"fault_time\":").append(to_string(event.faultTime_));
+        out.append(",\"function_name\":");
+        AppendJsonString(out, event.funcName_);
+        out.append(",\"message\":");
+        AppendJsonString(out, event.message_);
+        out.append(",\"schedule\":").append(schedule);
+        out.append(",\"trace_id\":");
+        AppendJsonString(out, traceId);
+        out.append(",\"version\":").append(to_string(REPORT_VERSION)).append("}");
+    }
+    out.push_back(']');
+    return out;
 }
 
 void CloudReportCacher::ReportFaultInfo(const CloudFaultInfo &event, const string &bundleName,
@@ -136,6 +392,9 @@ void CloudReportCacher::ReportFaultInfo(const CloudFaultInfo &event, const strin
 
 bool CloudReportCacher::GetReportInfo(const string &bundleName, shared_ptr<ReportInfo> &reportInfo)
 {
+    if (reportCache_.Find(bundleName, reportInfo)) {
+        return true;
+    }
     unique_lock<mutex> lock(reportMutex_);
     if (reportCache_.Find(bundleName, reportInfo)) {
         return true;
@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 #include "battery_status.h"
+#include "device_status_snapshot.h"
 #include "utils_log.h"
 
 namespace OHOS::FileManagement::CloudSync {
@@ -23,11 +24,13 @@ constexpr int32_t FULL_BATTERY_CAPACITY = 100;
 void BatteryStatus::SetChargingStatus(bool status)
 {
     isCharging_.store(status);
+    DeviceStatusSnapshot::SetCharging(status);
 }
 
 void BatteryStatus::SetCapacity(int32_t capacity)
 {
     capacity_.store(capacity);
+    DeviceStatusSnapshot::SetCapacity(capacity);
 }
 
 void BatteryStatus::GetInitChargingStatus()
@@ -35,9 +38,9 @@ void BatteryStatus::GetInitChargingStatus()
 #ifdef SUPPORT_POWER
     auto &batterySrvClient = PowerMgr::BatterySrvClient::GetInstance();
     auto pluggedType = batterySrvClient.GetPluggedType();
-    isCharging_.store(pluggedType != PowerMgr::BatteryPluggedType::PLUGGED_TYPE_NONE &&
-                  pluggedType != PowerMgr::BatteryPluggedType::PLUGGED_TYPE_BUTT);
-    capacity_.store(batterySrvClient.GetCapacity());
+    SetChargingStatus(pluggedType != PowerMgr::BatteryPluggedType::PLUGGED_TYPE_NONE &&
+                      pluggedType != PowerMgr::BatteryPluggedType::PLUGGED_TYPE_BUTT);
+    SetCapacity(batterySrvClient.GetCapacity());
     LOGI("pluggedType: %{public}d, isCharging: %{public}d, capacity: %{public}d",
         pluggedType, isCharging_.load(), capacity_.load());
 #endif
@@ -50,6 +53,7 @@ int32_t BatteryStatus::GetCapacity()
     if (capacity < 0) {
         auto &batterySrvClient = PowerMgr::BatterySrvClient::GetInstance();
         capacity = batterySrvClient.GetCapacity();
+        DeviceStatusSnapshot::SetCapacity(capacity);
     }
     return capacity;
 #endif
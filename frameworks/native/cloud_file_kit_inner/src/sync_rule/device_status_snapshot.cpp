@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "device_status_snapshot.h"
+
+namespace OHOS::FileManagement::CloudSync {
+std::atomic<uint32_t> DeviceStatusSnapshot::word_{(CAPACITY_UNKNOWN << CAPACITY_SHIFT) |
+    (DEFAULT_THERMAL_LEVEL << THERMAL_SHIFT)};
+
+uint32_t DeviceStatusSnapshot::Load()
+{
+    return word_.load(std::memory_order_relaxed);
+}
+
+void DeviceStatusSnapshot::SetScreenOff(bool screenOff)
+{
+    if (screenOff) {
+        word_.fetch_or(SCREEN_OFF_BIT, std::memory_order_relaxed);
+    } else {
+        word_.fetch_and(~SCREEN_OFF_BIT, std::memory_order_relaxed);
+    }
+}
+
+void DeviceStatusSnapshot::SetCharging(bool charging)
+{
+    if (charging) {
+        word_.fetch_or(CHARGING_BIT, std::memory_order_relaxed);
+    } else {
+        word_.fetch_and(~CHARGING_BIT, std::memory_order_relaxed);
+    }
+}
+
+void DeviceStatusSnapshot::SetCapacity(int32_t capacity)
+{
+    uint32_t value = (capacity < 0 || static_cast<uint32_t>(capacity) >= CAPACITY_UNKNOWN) ?
+        CAPACITY_UNKNOWN : static_cast<uint32_t>(capacity);
+    SetField(CAPACITY_SHIFT, value);
+}
+
+void DeviceStatusSnapshot::SetThermalLevel(int32_t level)
+{
+    SetField(THERMAL_SHIFT, level < 0 ? 0 : static_cast<uint32_t>(level) & FIELD_MASK);
+}
+
+void DeviceStatusSnapshot::SetField(uint32_t shift, uint32_t value)
+{
+    uint32_t oldWord = word_.load(std::memory_order_relaxed);
+    uint32_t newWord = 0;
+    do {
+        newWord = (oldWord & ~(FIELD_MASK << shift)) | ((value & FIELD_MASK) << shift);
+    } while (!word_.compare_exchange_weak(oldWord, newWord, std::memory_order_relaxed));
+}
+} // namespace OHOS::FileManagement::CloudSync
@@ -17,6 +17,7 @@
 
 #include "common_event_manager.h"
 #include "common_event_support.h"
+#include "device_status_snapshot.h"
 #include "dfs_error.h"
 #include "power_mgr_client.h"
 #include "utils_log.h"
@@ -33,12 +34,13 @@ void ScreenStatus::InitScreenStatus()
 {
     bool isScreenOn = PowerMgr::PowerMgrClient::GetInstance().IsScreenOn();
     ScreenState screenState = isScreenOn ? ScreenState::SCREEN_ON : ScreenState::SCREEN_OFF;
-    screenState_.store(screenState);
+    SetScreenState(screenState);
 }
 
 void ScreenStatus::SetScreenState(ScreenState screenState)
 {
     screenState_.store(screenState);
+    DeviceStatusSnapshot::SetScreenOff(screenState == ScreenState::SCREEN_OFF);
 }
 
 bool ScreenStatus::IsForceSleep()
@@ -15,6 +15,7 @@
 #include "system_load.h"
 
 #include "battery_status.h"
+#include "device_status_snapshot.h"
 #include "dfs_error.h"
 #include "ffrt_inner.h"
 #include "parameters.h"
@@ -105,6 +106,7 @@ void SystemLoadStatus::GetSystemloadLevel()
 void SystemLoadStatus::Setload(const PowerMgr::ThermalLevel &level)
 {
     levelStatus_.store(level);
+    DeviceStatusSnapshot::SetThermalLevel(static_cast<int32_t>(level));
 }
 
 PowerMgr::ThermalLevel SystemLoadStatus::Getload()
@@ -13,6 +13,8 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <atomic>
 #include <charconv>
 #include <filesystem>
 #include <fstream>
@@ -26,6 +28,7 @@
 #include "cloud_upload_callback_client_manager.h"
 #include "downgrade_download_callback_client.h"
 #include "dfs_error.h"
+#include "ffrt_inner.h"
 #include "iservice_registry.h"
 #include "service_proxy.h"
 #include "system_ability_definition.h"
@@ -38,6 +41,9 @@ using namespace std;
 constexpr int32_t MIN_USER_ID = 100;
 constexpr int32_t MAX_FILE_CACHE_NUM = 400;
 constexpr int32_t MAX_DENTRY_FILE_SIZE = 500;
+constexpr size_t MAX_XATTR_PATH_SIZE = 20;
+// chunk requests in flight at once, keeps the service binder pool free for other callers
+constexpr int MAX_XATTR_INFLIGHT = 2;
 constexpr int32_t MAX_PROGRESS_QUERY_NUM = 100;
 constexpr int32_t BASE_USER_RANGE = 200000;
 const string CLOUDSYNC_MEDIA_CALLBACK_ID = "cloudSyncMediaCallbackId";
@@ -1063,10 +1069,6 @@ int32_t CloudSyncManagerImpl::CleanFileCache(const std::string &uri)
 int32_t CloudSyncManagerImpl::BatchDentryFileInsert(const std::vector<DentryFileInfo> &fileInfo,
     std::vector<std::string> &failCloudId)
 {
-    if (fileInfo.size() > MAX_DENTRY_FILE_SIZE) {
-        LOGE("BatchDentryFileInsert parameter is invalid");
-        return E_INVAL_ARG;
-    }
     auto CloudSyncServiceProxy = ServiceProxy::GetInstance("BatchDentryFileInsert");
     if (!CloudSyncServiceProxy) {
         LOGE("proxy is null");
@@ -1074,13 +1076,43 @@ int32_t CloudSyncManagerImpl::BatchDentryFileInsert(const std::vector<DentryFile
     }
 
     SetDeathRecipient(CloudSyncServiceProxy->AsObject());
-    std::vector<DentryFileInfoObj> fileInfoObj;
-    for (const auto &info : fileInfo) {
-        DentryFileInfoObj obj(info);
-        fileInfoObj.emplace_back(obj);
+    // the next chunk is encoded while the current one is in flight, so at most two chunks are held
+    ffrt::queue encodeQueue("dentry_encode_queue");
+    DentryFileBatchObj batch;
+    DentryFileBatchObj nextBatch;
+    bool encoded = batch.Encode(fileInfo.data(), std::min<size_t>(fileInfo.size(), MAX_DENTRY_FILE_SIZE));
+    for (size_t offset = 0; offset < fileInfo.size(); offset += MAX_DENTRY_FILE_SIZE) {
+        size_t nextOffset = offset + MAX_DENTRY_FILE_SIZE;
+        bool nextEncoded = false;
+        ffrt::task_handle handle;
+        if (nextOffset < fileInfo.size()) {
+            size_t nextCount = std::min<size_t>(fileInfo.size() - nextOffset, MAX_DENTRY_FILE_SIZE);
+            handle = encodeQueue.submit_h([&nextBatch, &nextEncoded, &fileInfo, nextOffset, nextCount]() {
+                nextEncoded = nextBatch.Encode(fileInfo.data() + nextOffset, nextCount);
+            });
+        }
+        int32_t ret = E_INVAL_ARG;
+        std::vector<std::string> chunkFailCloudId;
+        if (encoded) {
+            ret = CloudSyncServiceProxy->BatchDentryFileInsertChunk(batch, chunkFailCloudId);
+        }
+        if (handle != nullptr) {
+            encodeQueue.wait(handle);
+        }
+        if (ret != E_OK) {
+            // earlier chunks stay inserted, so the caller learns which entries were not
+            LOGE("insert chunk at %{public}zu failed, ret: %{public}d", offset, ret);
+            for (size_t i = offset; i < fileInfo.size(); i++) {
+                failCloudId.push_back(fileInfo[i].cloudId);
+            }
+            return ret;
+        }
+        failCloudId.insert(failCloudId.end(), std::make_move_iterator(chunkFailCloudId.begin()),
+            std::make_move_iterator(chunkFailCloudId.end()));
+        std::swap(batch, nextBatch);
+        encoded = nextEncoded;
     }
-
-    return CloudSyncServiceProxy->BatchDentryFileInsert(fileInfoObj, failCloudId);
+    return E_OK;
 }
 
 void CloudSyncManagerImpl::SubscribeListener(void)
@@ -1322,11 +1354,52 @@ int32_t CloudSyncManagerImpl::GetAclXattrBatch(const bool isAccess,
         return E_SA_LOAD_FAILED;
     }
     SetDeathRecipient(CloudSyncServiceProxy->AsObject());
-    int32_t ret = CloudSyncServiceProxy->GetAclXattrBatch(isAccess, filePaths, aclXattrResults);
-    if (ret != E_OK) {
-        LOGE("ret is %{public}d", ret);
+    if (filePaths.size() <= MAX_XATTR_PATH_SIZE) {
+        int32_t ret = CloudSyncServiceProxy->GetAclXattrBatch(isAccess, filePaths, aclXattrResults);
+        if (ret != E_OK) {
+            LOGE("ret is %{public}d", ret);
+        }
+        return ret;
     }
-    return ret;
+
+    // split into service sized chunks with a bounded number in flight, a failed chunk fails the whole call
+    size_t chunkNum = (filePaths.size() + MAX_XATTR_PATH_SIZE - 1) / MAX_XATTR_PATH_SIZE;
+    std::vector<std::vector<XattrResult>> chunkResults(chunkNum);
+    std::vector<int32_t> chunkRets(chunkNum, E_OK);
+    std::atomic<bool> failed{false};
+    ffrt::queue xattrQueue(ffrt::queue_concurrent, "acl_xattr_queue",
+                           ffrt::queue_attr().max_concurrency(MAX_XATTR_INFLIGHT));
+    std::vector<ffrt::task_handle> handles;
+    for (size_t index = 0; index < chunkNum; index++) {
+        handles.push_back(xattrQueue.submit_h([&, index]() {
+            // chunks start in order, so a skipped chunk always follows the one that failed
+            if (failed.load()) {
+                return;
+            }
+            size_t offset = index * MAX_XATTR_PATH_SIZE;
+            auto first = filePaths.begin() + offset;
+            auto last = first + std::min<size_t>(MAX_XATTR_PATH_SIZE, filePaths.size() - offset);
+            chunkRets[index] = CloudSyncServiceProxy->GetAclXattrBatch(isAccess,
+                std::vector<std::string>(first, last), chunkResults[index]);
+            if (chunkRets[index] != E_OK) {
+                failed.store(true);
+            }
+        }));
+    }
+    for (auto &handle : handles) {
+        xattrQueue.wait(handle);
+    }
+    for (size_t index = 0; index < chunkNum; index++) {
+        if (chunkRets[index] != E_OK) {
+            LOGE("chunk %{public}zu ret is %{public}d", index, chunkRets[index]);
+            return chunkRets[index];
+        }
+    }
+    for (auto &results : chunkResults) {
+        aclXattrResults.insert(aclXattrResults.end(), std::make_move_iterator(results.begin()),
+            std::make_move_iterator(results.end()));
+    }
+    return E_OK;
 }
 
 void CloudSyncManagerImpl::SetStartSyncPending()
@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <unistd.h>
+
+#include "ashmem.h"
+#include "cloud_sync_common.h"
+#include "ipc_file_descriptor.h"
+#include "utils_log.h"
+
+namespace OHOS::FileManagement::CloudSync {
+namespace {
+constexpr const char *ASHMEM_NAME = "dentry_file_batch";
+
+void PutUint32(std::vector<uint8_t> &buf, uint32_t value)
+{
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&value);
+    buf.insert(buf.end(), bytes, bytes + sizeof(value));
+}
+
+void PutInt64(std::vector<uint8_t> &buf, int64_t value)
+{
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&value);
+    buf.insert(buf.end(), bytes, bytes + sizeof(value));
+}
+
+void PutString(std::vector<uint8_t> &buf, const std::string &value)
+{
+    PutUint32(buf, static_cast<uint32_t>(value.size()));
+    buf.insert(buf.end(), value.begin(), value.end());
+}
+
+size_t GetEncodedSize(const DentryFileInfo &info)
+{
+    constexpr size_t stringCount = 4;
+    return stringCount * sizeof(uint32_t) + 2 * sizeof(int64_t) + info.cloudId.size() + info.path.size() +
+        info.fileName.size() + info.fileType.size();
+}
+
+class PayloadReader {
+public:
+    PayloadReader(const uint8_t *data, size_t size) : data_(data), size_(size) {}
+
+    bool GetUint32(uint32_t &value)
+    {
+        return Copy(&value, sizeof(value));
+    }
+
+    bool GetInt64(int64_t &value)
+    {
+        return Copy(&value, sizeof(value));
+    }
+
+    bool GetString(std::string &value)
+    {
+        uint32_t length = 0;
+        if (!GetUint32(length) || length > size_ - offset_) {
+            return false;
+        }
+        value.assign(reinterpret_cast<const char *>(data_ + offset_), length);
+        offset_ += length;
+        return true;
+    }
+
+    bool AtEnd() const
+    {
+        return offset_ == size_;
+    }
+
+private:
+    bool Copy(void *dst, size_t length)
+    {
+        if (length > size_ - offset_) {
+            return false;
+        }
+        std::copy(data_ + offset_, data_ + offset_ + length, static_cast<uint8_t *>(dst));
+        offset_ += length;
+        return true;
+    }
+
+    const uint8_t *data_;
+    size_t size_;
+    size_t offset_{0};
+};
+} // namespace
+
+bool DentryFileBatchObj::Encode(const DentryFileInfo *first, size_t count)
+{
+    payload_.clear();
+    count_ = 0;
+    if (count > MAX_BATCH_COUNT || (first == nullptr && count != 0)) {
+        LOGE("invalid batch count: %{public}zu", count);
+        return false;
+    }
+    size_t size = 0;
+    for (size_t i = 0; i < count; i++) {
+        size += GetEncodedSize(first[i]);
+    }
+    if (size > MAX_PAYLOAD_SIZE) {
+        LOGE("batch payload too large: %{public}zu", size);
+        return false;
+    }
+    payload_.reserve(size);
+    for (size_t i = 0; i < count; i++) {
+        const DentryFileInfo &info = first[i];
+        PutString(payload_, info.cloudId);
+        PutInt64(payload_, info.size);
+        PutInt64(payload_, info.modifiedTime);
+        PutString(payload_, info.path);
+        PutString(payload_, info.fileName);
+        PutString(payload_, info.fileType);
+    }
+    count_ = static_cast<uint32_t>(count);
+    return true;
+}
+
+uint32_t DentryFileBatchObj::GetCount() const
+{
+    return count_;
+}
+
+size_t DentryFileBatchObj::GetPayloadSize() const
+{
+    return payload_.size();
+}
+
+bool DentryFileBatchObj::Decode(const uint8_t *data, size_t size, uint32_t count, std::vector<DentryFileInfo> &out)
+{
+    if (data == nullptr && size != 0) {
+        return false;
+    }
+    PayloadReader reader(data, size);
+    out.clear();
+    out.reserve(count);
+    for (uint32_t i = 0; i < count; i++) {
+        DentryFileInfo info;
+        if (!reader.GetString(info.cloudId) || !reader.GetInt64(info.size) || !reader.GetInt64(info.modifiedTime) ||
+            !reader.GetString(info.path) || !reader.GetString(info.fileName) || !reader.GetString(info.fileType)) {
+            LOGE("batch payload truncated at entry %{public}u", i);
+            out.clear();
+            return false;
+        }
+        out.emplace_back(std::move(info));
+    }
+    if (!reader.AtEnd()) {
+        LOGE("batch payload has trailing bytes");
+        out.clear();
+        return false;
+    }
+    return true;
+}
+
+bool DentryFileBatchObj::WriteAshmemPayload(Parcel &parcel) const
+{
+    sptr<Ashmem> ashmem = Ashmem::CreateAshmem(ASHMEM_NAME, static_cast<int32_t>(payload_.size()));
+    if (ashmem == nullptr) {
+        LOGE("create ashmem failed");
+        return false;
+    }
+    bool ret = ashmem->MapReadAndWriteAshmem() &&
+        ashmem->WriteToAshmem(payload_.data(), static_cast<int32_t>(payload_.size()), 0);
+    ashmem->UnmapAshmem();
+    if (!ret) {
+        LOGE("write ashmem failed");
+        ashmem->CloseAshmem();
+        return false;
+    }
+    // the parcel owns the duplicated fd, which keeps the region alive until the receiver maps it
+    int fd = dup(ashmem->GetAshmemFd());
+    ashmem->CloseAshmem();
+    if (fd < 0) {
+        LOGE("dup ashmem fd failed, errno: %{public}d", errno);
+        return false;
+    }
+    sptr<IPCFileDescriptor> descriptor = new (std::nothrow) IPCFileDescriptor(fd);
+    if (descriptor == nullptr) {
+        close(fd);
+        return false;
+    }
+    return parcel.WriteObject<IPCFileDescriptor>(descriptor);
+}
+
+bool DentryFileBatchObj::ReadAshmemPayload(Parcel &parcel, uint32_t size)
+{
+    sptr<IPCFileDescriptor> descriptor = parcel.ReadObject<IPCFileDescriptor>();
+    if (descriptor == nullptr) {
+        LOGE("failed to read ashmem fd");
+        return false;
+    }
+    int fd = dup(descriptor->GetFd());
+    if (fd < 0) {
+        LOGE("dup ashmem fd failed, errno: %{public}d", errno);
+        return false;
+    }
+    // never map past the real region, a short region would fault on access
+    int regionSize = AshmemGetSize(fd);
+    if (regionSize < 0 || static_cast<uint32_t>(regionSize) < size) {
+        LOGE("ashmem size mismatch: %{public}d < %{public}u", regionSize, size);
+        close(fd);
+        return false;
+    }
+    sptr<Ashmem> ashmem = new (std::nothrow) Ashmem(fd, static_cast<int32_t>(size));
+    if (ashmem == nullptr) {
+        close(fd);
+        return false;
+    }
+    bool ret = false;
+    if (ashmem->MapReadOnlyAshmem()) {
+        auto data = static_cast<const uint8_t *>(ashmem->ReadFromAshmem(static_cast<int32_t>(size), 0));
+        ret = Decode(data, size, count_, fileInfo);
+        ashmem->UnmapAshmem();
+    }
+    ashmem->CloseAshmem();
+    return ret;
+}
+
+bool DentryFileBatchObj::Marshalling(Parcel &parcel) const
+{
+    uint32_t size = static_cast<uint32_t>(payload_.size());
+    if (!parcel.WriteUint32(count_) || !parcel.WriteUint32(size)) {
+        LOGE("failed to write batch header");
+        return false;
+    }
+    bool useAshmem = size > INLINE_PAYLOAD_LIMIT;
+    if (!parcel.WriteBool(useAshmem)) {
+        LOGE("failed to write payload type");
+        return false;
+    }
+    if (useAshmem) {
+        return WriteAshmemPayload(parcel);
+    }
+    if (size != 0 && !parcel.WriteBuffer(payload_.data(), size)) {
+        LOGE("failed to write inline payload");
+        return false;
+    }
+    return true;
+}
+
+bool DentryFileBatchObj::ReadFromParcel(Parcel &parcel)
+{
+    uint32_t size = 0;
+    bool useAshmem = false;
+    if (!parcel.ReadUint32(count_) || !parcel.ReadUint32(size) || !parcel.ReadBool(useAshmem)) {
+        LOGE("failed to read batch header");
+        return false;
+    }
+    if (count_ > MAX_BATCH_COUNT || size > MAX_PAYLOAD_SIZE || (!useAshmem && size > INLINE_PAYLOAD_LIMIT)) {
+        LOGE("invalid batch, count: %{public}u, size: %{public}u", count_, size);
+        return false;
+    }
+    if (useAshmem) {
+        return ReadAshmemPayload(parcel, size);
+    }
+    const uint8_t *data = size == 0 ? nullptr : parcel.ReadBuffer(size);
+    if (size != 0 && data == nullptr) {
+        LOGE("failed to read inline payload");
+        return false;
+    }
+    return Decode(data, size, count_, fileInfo);
+}
+
+DentryFileBatchObj *DentryFileBatchObj::Unmarshalling(Parcel &parcel)
+{
+    DentryFileBatchObj *info = new (std::nothrow) DentryFileBatchObj();
+    if ((info != nullptr) && (!info->ReadFromParcel(parcel))) {
+        LOGW("read from parcel failed");
+        delete info;
+        info = nullptr;
+    }
+    return info;
+}
+} // namespace OHOS::FileManagement::CloudSync
@@ -15,7 +15,10 @@
 #ifndef OHOS_CLOUD_SYNC_SERVICE_CLOUD_REPORT_CACHE_H
 #define OHOS_CLOUD_SYNC_SERVICE_CLOUD_REPORT_CACHE_H
 
+#include "ffrt_inner.h"
 #include "safe_map.h"
+#include <array>
+#include <atomic>
 #include <vector>
 #include <mutex>
 
@@ -34,11 +37,42 @@ struct CloudFaultInfo {
     bool terminate_ = false;
 };
 
+/*
+ * Bounded multi-producer ring of pending fault events. Producers claim a slot with one CAS on tail_ and
+ * publish it through the slot sequence, so pushing a fault never waits for a flush in progress.
+ */
+class FaultEventRing {
+public:
+    static constexpr size_t CAPACITY = 128;
+
+    FaultEventRing();
+    bool TryPush(const CloudFaultInfo &event);
+    bool TryPop(CloudFaultInfo &event);
+    size_t Size() const;
+
+private:
+    static constexpr size_t MASK = CAPACITY - 1;
+    static_assert((CAPACITY & MASK) == 0, "capacity must be a power of two");
+    struct Slot {
+        atomic<size_t> seq{0};
+        CloudFaultInfo event;
+    };
+
+    array<Slot, CAPACITY> slots_;
+    atomic<size_t> head_{0};
+    atomic<size_t> tail_{0};
+};
+
 struct ReportInfo {
-    vector<CloudFaultInfo> events_;
+    FaultEventRing events_;
+    atomic<bool> flushScheduled_{false};
+    atomic<uint64_t> droppedCount_{0};
+    atomic<uint64_t> reportedCount_{0};
+    mutex flushMutex_; // guards the fields below and serializes flushes of one bundle
     string traceId_;
-    uint32_t scenarioCode_;
-    int lastScheduleType_;
+    uint32_t scenarioCode_{0};
+    int lastScheduleType_{0};
+    uint64_t loggedDropCount_{0};
 };
 
 class CloudReportCacher {
@@ -49,14 +83,20 @@ public:
     void PushEvent(const string &bundleName, const CloudFaultInfo &event);
     void Report(const string &bundleName, const int32_t scheduleType);
     void ReportFaultInfo(const CloudFaultInfo &event, const string &bundleName, const uint32_t scenarioCode);
+    static string BuildReportMessage(const vector<CloudFaultInfo> &events, const string &traceId,
+        const int32_t scheduleType);
 private:
     CloudReportCacher();
     ~CloudReportCacher() = default;
     bool GetReportInfo(const string &bundleName, shared_ptr<ReportInfo> &reportInfo);
+    void ScheduleFlush(const string &bundleName, const shared_ptr<ReportInfo> &reportInfo);
+    void Flush(const string &bundleName, const shared_ptr<ReportInfo> &reportInfo, const int32_t scheduleType);
+    void ReportBatch(const string &bundleName, const shared_ptr<ReportInfo> &reportInfo,
+        const vector<CloudFaultInfo> &events, const int32_t schedule);
 
     SafeMap<const string, shared_ptr<ReportInfo>> reportCache_;
-    mutex eventsMutex_;
     mutex reportMutex_;
+    ffrt::queue flushQueue_;
 };
 } // namespace CloudFile
 } // namespace FileManagement
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_FILEMGMT_DEVICE_STATUS_SNAPSHOT_H
+#define OHOS_FILEMGMT_DEVICE_STATUS_SNAPSHOT_H
+
+#include <atomic>
+#include <cstdint>
+
+namespace OHOS::FileManagement::CloudSync {
+/*
+ * Screen, charging, capacity and thermal state packed into one word. The word is written by the
+ * ScreenStatus, BatteryStatus and SystemLoadStatus setters, which the event listeners already call,
+ * so hot loops can evaluate their run condition with a single relaxed load instead of querying
+ * every status on each iteration. The word lives in cloudfile_kit and is only reached through the
+ * out of line accessors.
+ */
+class DeviceStatusSnapshot {
+public:
+    static constexpr uint32_t SCREEN_OFF_BIT = 1U << 0;
+    static constexpr uint32_t CHARGING_BIT = 1U << 1;
+    static constexpr uint32_t CAPACITY_SHIFT = 8;
+    static constexpr uint32_t THERMAL_SHIFT = 16;
+    static constexpr uint32_t FIELD_MASK = 0xFF;
+    static constexpr uint32_t CAPACITY_UNKNOWN = FIELD_MASK;
+    /* ThermalLevel::NORMAL */
+    static constexpr uint32_t DEFAULT_THERMAL_LEVEL = 1;
+
+    static uint32_t Load();
+    static void SetScreenOff(bool screenOff);
+    static void SetCharging(bool charging);
+    static void SetCapacity(int32_t capacity);
+    static void SetThermalLevel(int32_t level);
+
+    static bool IsScreenOff(uint32_t word)
+    {
+        return (word & SCREEN_OFF_BIT) != 0;
+    }
+
+    static bool IsCharging(uint32_t word)
+    {
+        return (word & CHARGING_BIT) != 0;
+    }
+
+    /* Returns -1 when no capacity has been published yet. */
+    static int32_t GetCapacity(uint32_t word)
+    {
+        uint32_t capacity = (word >> CAPACITY_SHIFT) & FIELD_MASK;
+        return capacity == CAPACITY_UNKNOWN ? -1 : static_cast<int32_t>(capacity);
+    }
+
+    static int32_t GetThermalLevel(uint32_t word)
+    {
+        return static_cast<int32_t>((word >> THERMAL_SHIFT) & FIELD_MASK);
+    }
+
+    /*
+     * Screen off, charging, capacity not below minCapacity and thermal level not above maxThermalLevel.
+     * An unpublished capacity passes, callers run the full status check once before relying on the snapshot.
+     */
+    static bool IsIdleCharging(int32_t minCapacity, int32_t maxThermalLevel)
+    {
+        uint32_t word = Load();
+        if (!IsScreenOff(word) || !IsCharging(word)) {
+            return false;
+        }
+        int32_t capacity = GetCapacity(word);
+        if (capacity >= 0 && capacity < minCapacity) {
+            return false;
+        }
+        return GetThermalLevel(word) <= maxThermalLevel;
+    }
+
+private:
+    static void SetField(uint32_t shift, uint32_t value);
+
+    /* defined in cloudfile_kit, so every library that links it shares the one word */
+    static std::atomic<uint32_t> word_;
+};
+} // namespace OHOS::FileManagement::CloudSync
+
+#endif // OHOS_FILEMGMT_DEVICE_STATUS_SNAPSHOT_H
@@ -214,6 +214,35 @@ struct DentryFileInfoObj : public Parcelable {
     }
 };
 
+/*
+ * One chunk of a bulk dentry insert. The sender encodes the entries straight from DentryFileInfo into a
+ * flat buffer, which travels inline in the parcel while small and in an ashmem region otherwise.
+ * The receiver decodes the buffer directly into fileInfo.
+ */
+struct DentryFileBatchObj : public Parcelable {
+    static constexpr uint32_t INLINE_PAYLOAD_LIMIT = 32 * 1024;
+    static constexpr uint32_t MAX_PAYLOAD_SIZE = 32 * 1024 * 1024;
+    static constexpr uint32_t MAX_BATCH_COUNT = 20000;
+
+    std::vector<DentryFileInfo> fileInfo;
+
+    bool Encode(const DentryFileInfo *first, size_t count);
+    uint32_t GetCount() const;
+    size_t GetPayloadSize() const;
+    static bool Decode(const uint8_t *data, size_t size, uint32_t count, std::vector<DentryFileInfo> &out);
+
+    bool ReadFromParcel(Parcel &parcel);
+    bool Marshalling(Parcel &parcel) const override;
+    static DentryFileBatchObj *Unmarshalling(Parcel &parcel);
+
+private:
+    bool WriteAshmemPayload(Parcel &parcel) const;
+    bool ReadAshmemPayload(Parcel &parcel, uint32_t size);
+
+    uint32_t count_{0};
+    std::vector<uint8_t> payload_;
+};
+
 struct AssetInfoObj : public Parcelable {
     std::string uri;
     std::string recordType;
@@ -144,6 +144,13 @@ public:
     virtual void CleanGalleryDentryFile(const std::string path) = 0;
     virtual int32_t BatchCleanFile(const std::vector<CleanFileInfo> &fileInfo,
         std::vector<std::string> &failCloudId) = 0;
+    /**
+     * @brief 批量插入dentry文件，按块分批提交
+     *
+     * @param fileInfo 待插入的文件信息列表
+     * @param failCloudId 插入失败的cloudId，返回错误时包含失败块及其后所有条目，其余条目已插入
+     * @return int32_t 同步返回执行结果
+     */
     virtual int32_t BatchDentryFileInsert(const std::vector<DentryFileInfo> &fileInfo,
          std::vector<std::string> &failCloudId) = 0;
     /**
@@ -201,6 +208,14 @@ public:
     virtual int32_t IsFinishPull(bool &finishFlag) = 0;
     // get dentryfile occupy
     virtual int32_t GetDentryFileOccupy(int64_t &occupyNum);
+    /**
+     * @brief 批量获取acl扩展属性，按块分批查询
+     *
+     * @param isAccess 获取access acl或default acl
+     * @param filePaths 文件路径列表
+     * @param aclXattrResults 查询结果追加于此，返回错误时不追加任何结果
+     * @return int32_t 同步返回执行结果
+     */
     virtual int32_t GetAclXattrBatch(const bool isAccess, const std::vector<std::string> &filePaths,
                                      std::vector<XattrResult> &aclXattrResults);
     virtual int32_t GetDowngradeDownloadTaskState(const std::vector<std::string> &bundleNames,
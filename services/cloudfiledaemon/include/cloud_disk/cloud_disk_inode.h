@@ -28,6 +28,7 @@
 #include "cloud_asset_read_session.h"
 #include "ffrt_inner.h"
 #include "file_operations_base.h"
+#include "fuse_request_lane.h"
 
 namespace OHOS {
 namespace FileManagement {
@@ -100,6 +101,8 @@ struct CloudDiskFuseData {
     std::shared_mutex fileIdLock;
     std::shared_mutex localIdLock;
     std::shared_mutex readSessionLock;
+    /* slow requests of this session, stopped before the session is destroyed */
+    std::shared_ptr<FuseRequestLane> dataLane{nullptr};
     struct fuse_session *se;
 };
 } // namespace CloudDisk
@@ -42,6 +42,8 @@ public:
                                  std::shared_ptr<CloudDiskFile> filePtr, int64_t key);
     static void PutLocalId(struct CloudDiskFuseData *data,
                            std::shared_ptr<CloudDiskInode> inoPtr, const std::string &key);
+    static void PutCloudDiskInodes(struct CloudDiskFuseData *data,
+                                   const std::vector<struct fuse_forget_data> &forgets);
     static std::shared_ptr<CloudDiskInode> GenerateCloudDiskInode(struct CloudDiskFuseData *data,
                                                                   fuse_ino_t parent,
                                                                   const std::string &fileName,
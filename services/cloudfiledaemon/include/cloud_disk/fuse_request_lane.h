@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CLOUD_FILE_DAEMON_FUSE_REQUEST_LANE_H
+#define CLOUD_FILE_DAEMON_FUSE_REQUEST_LANE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace FileManagement {
+namespace CloudDisk {
+/*
+ * Worker pool that takes the slow cloud disk requests off the FUSE session threads, so that lookups and
+ * getattrs of other apps are not queued behind a cloud read or a database backed readdir. A worker is
+ * added whenever the queue is deeper than the idle workers, up to maxWorkers, and workers above
+ * minWorkers leave after idling for idleTimeout. The task replies to its own fuse request. A lane refuses
+ * tasks until it is started by the session that owns it, and that session stops it before it is destroyed.
+ */
+class FuseRequestLane final : public NoCopyable {
+public:
+    using Task = std::function<void()>;
+
+    FuseRequestLane(const std::string &name, uint32_t minWorkers, uint32_t maxWorkers, size_t maxPending,
+        std::chrono::milliseconds idleTimeout);
+    ~FuseRequestLane();
+
+    /* Returns false when the lane is stopped or full, the caller then serves the request itself. */
+    bool Submit(Task task);
+    void Start();
+    void Stop();
+    uint32_t GetWorkerCount();
+    uint32_t GetPeakWorkerCount();
+    size_t GetPendingCount();
+
+    static std::shared_ptr<FuseRequestLane> CreateDataLane();
+
+private:
+    void StartWorker();
+    void WorkerLoop();
+
+    std::string name_;
+    uint32_t minWorkers_;
+    uint32_t maxWorkers_;
+    size_t maxPending_;
+    std::chrono::milliseconds idleTimeout_;
+
+    std::mutex mutex_;
+    std::condition_variable taskCond_;
+    std::condition_variable exitCond_;
+    std::deque<Task> tasks_;
+    uint32_t workers_{0};
+    uint32_t idleWorkers_{0};
+    uint32_t peakWorkers_{0};
+    bool stopped_{true};
+};
+} // namespace CloudDisk
+} // namespace FileManagement
+} // namespace OHOS
+#endif // CLOUD_FILE_DAEMON_FUSE_REQUEST_LANE_H
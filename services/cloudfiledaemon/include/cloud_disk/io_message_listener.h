@@ -16,95 +16,93 @@
 #ifndef CLOUD_FILE_DAEMON_IO_MESSAGE_STATUS_LISTENER_H
 #define CLOUD_FILE_DAEMON_IO_MESSAGE_STATUS_LISTENER_H
 
-#include <chrono>
-#include <condition_variable>
-#include <fstream>
-#include <thread>
-#include <mutex>
+#include <atomic>
+#include <string>
+#include <variant>
+#include <vector>
 
 #include "application_state_observer_stub.h"
 #include "common_event_subscriber.h"
 #include "ffrt_inner.h"
+#include "fuse_io_accounting.h"
 
 namespace OHOS {
 namespace FileManagement {
 namespace CloudDisk {
+constexpr size_t IO_BUNDLE_NAME_LEN = 128;
 
-struct IoData {
-    int64_t rchar = 0;
-    int64_t syscr = 0;
+/* The foreground stay of an app, measured against the counters of the FUSE daemons. */
+struct IoWindow {
+    int32_t uid = -1;
+    int64_t startTime = 0;
+    CloudFile::FuseIoCounters start;
+};
+
+/* One abnormal foreground stay, stored as is in the ring file. The counts are FUSE requests, not syscalls. */
+struct IoRecord {
+    int64_t datetime = 0;
+    int32_t foregroundTime = 0;
+    int32_t reserved = 0;
     int64_t readBytes = 0;
-    int64_t syscopen = 0;
-    int64_t syscstat = 0;
+    int64_t reads = 0;
+    int64_t opens = 0;
+    int64_t stats = 0;
+    char bundleName[IO_BUNDLE_NAME_LEN] = {0};
 };
 
-struct IoDataToWrite {
-    std::string bundleName;
-    int64_t rcharDiff = 0;
-    int64_t syscrDiff = 0;
-    int64_t readBytesDiff = 0;
-    int64_t syscopenDiff = 0;
-    int64_t syscstatDiff = 0;
-    double result = 0;
-    std::string datetime;
+struct IoRingHeader {
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    uint32_t capacity = 0;
+    uint32_t recordSize = 0;
+    /* records ever appended and records already reported, the slot of a record is its index modulo capacity */
+    uint64_t head = 0;
+    uint64_t reported = 0;
 };
 
 using Int32Vector = std::vector<int32_t>;
 using Int64Vector = std::vector<int64_t>;
 using StringVector = std::vector<std::string>;
-using DoubleVector = std::vector<double>;
-bool CheckInt(const std::string &value);
-bool CheckDouble(const std::string &value);
 
 enum class VectorIndex {
     IO_TIMES,
     IO_BUNDLE_NAME,
-    IO_READ_CHAR_DIFF,
-    IO_SYSC_READ_DIFF,
-    IO_READ_BYTES_DIFF,
-    IO_SYSC_OPEN_DIFF,
-    IO_SYSC_STAT_DIFF,
-    IO_RESULT,
+    IO_FUSE_READ_BYTES,
+    IO_FUSE_READ,
+    IO_FUSE_OPEN,
+    IO_FUSE_STAT,
     IO_DATETIME
 };
 using VectorVariant = std::variant<
     Int32Vector,
     StringVector,
-    Int64Vector,
-    DoubleVector
+    Int64Vector
 >;
 class IoMessageManager {
 private:
     std::string currentBundleName = "";
-    std::atomic<bool> isThreadRunning{false};
     std::atomic<bool> reportThreadRunning{false};
-    ffrt::mutex sleepMutex;
-    ffrt::condition_variable sleepCv;
-    std::map<std::string, int32_t> bundleTimeMap;
-    IoData currentData;
-    IoData preData;
-    IoDataToWrite dataToWrite;
-    AppExecFwk::AppStateData lastestAppStateData;
+    ffrt::mutex ioMutex;
+    IoWindow window;
+    std::string ringPath;
+    int ringFd = -1;
+    IoRingHeader ringHeader;
 
     Int32Vector ioTimes;
     StringVector ioBundleName;
-    Int64Vector ioReadCharDiff;
-    Int64Vector ioSyscReadDiff;
-    Int64Vector ioReadBytesDiff;
-    Int64Vector ioSyscOpenDiff;
-    Int64Vector ioSyscStatDiff;
-    DoubleVector ioResult;
+    Int64Vector ioFuseReadBytes;
+    Int64Vector ioFuseRead;
+    Int64Vector ioFuseOpen;
+    Int64Vector ioFuseStat;
     StringVector ioDatetime;
 
     std::vector<VectorVariant> targetVectors = {
         VectorVariant(std::in_place_type<Int32Vector>, std::move(ioTimes)),
         VectorVariant(std::in_place_type<StringVector>, std::move(ioBundleName)),
-        VectorVariant(std::in_place_type<Int64Vector>, std::move(ioReadCharDiff)),
-        VectorVariant(std::in_place_type<Int64Vector>, std::move(ioSyscReadDiff)),
-        VectorVariant(std::in_place_type<Int64Vector>, std::move(ioReadBytesDiff)),
-        VectorVariant(std::in_place_type<Int64Vector>, std::move(ioSyscOpenDiff)),
-        VectorVariant(std::in_place_type<Int64Vector>, std::move(ioSyscStatDiff)),
-        VectorVariant(std::in_place_type<DoubleVector>, std::move(ioResult)),
+        VectorVariant(std::in_place_type<Int64Vector>, std::move(ioFuseReadBytes)),
+        VectorVariant(std::in_place_type<Int64Vector>, std::move(ioFuseRead)),
+        VectorVariant(std::in_place_type<Int64Vector>, std::move(ioFuseOpen)),
+        VectorVariant(std::in_place_type<Int64Vector>, std::move(ioFuseStat)),
         VectorVariant(std::in_place_type<StringVector>, std::move(ioDatetime))
     };
 
@@ -113,18 +111,22 @@ private:
     {
         return std::get<T>(targetVectors[static_cast<size_t>(Index)]);
     }
-    std::string GetIoDatetime();
+    std::string GetIoDatetime(int64_t datetime);
     bool CheckBundleName(const std::string &appBundleName);
-    bool ReadIoDataFromFile(const std::string &path);
-    void RecordDataToFile(const std::string &path);
-    void RecordIoData();
-    void ProcessIoData(const std::string &path);
-    void PushData(const std::vector<std::string> &fields);
+    void OpenWindowLocked(const AppExecFwk::AppStateData &appStateData);
+    void CloseWindowLocked();
+    bool IsAbnormal(const IoRecord &record);
+    bool OpenRingLocked();
+    bool WriteRingHeaderLocked();
+    bool AppendRecordLocked(const IoRecord &record);
+    void TakePendingRecordsLocked(std::vector<IoRecord> &records);
+    void PushRecord(const IoRecord &record);
     void ReadAndReportIoMessage();
-    void CheckMaxSizeAndReport();
     void Report();
 
 public:
+    IoMessageManager();
+    ~IoMessageManager();
     static IoMessageManager &GetInstance();
     void OnReceiveEvent(const AppExecFwk::AppStateData &appStateData);
 };
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FUSE_INVAL_DISPATCHER_H
+#define FUSE_INVAL_DISPATCHER_H
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include <fuse_lowlevel.h>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace FileManagement {
+namespace CloudFile {
+struct FuseInvalStats {
+    uint64_t requested{0};
+    uint64_t issued{0};
+    uint64_t coalesced{0};
+    uint64_t overflowed{0};
+    uint64_t dropped{0};
+};
+
+/*
+ * Kernel invalidations of both daemons. A notify must not be sent from the request that causes it, so
+ * requests are queued and sent together one timer tick later. Requests for the same entry within a tick
+ * are sent once, and an inode whose dentry is gone is invalidated once per batch. A queue that reaches maxPending is handed to the sender at once instead of waiting for
+ * the tick, and requests for new entries are dropped until it is sent, leaving those entries to expire.
+ */
+class FuseInvalDispatcher final : public NoCopyable {
+public:
+    static FuseInvalDispatcher &GetInstance();
+
+    /* Drops the dentry of name in parent, or the cached attributes of child when the dentry is gone. */
+    void InvalEntry(struct fuse_session *se, fuse_ino_t parent, fuse_ino_t child, const std::string &name);
+    void Flush();
+    /* Forgets the queued requests of a session about to be destroyed, once nothing of it queues more. */
+    void Discard(struct fuse_session *se);
+    FuseInvalStats GetStats();
+
+private:
+    FuseInvalDispatcher(uint64_t tickMs, size_t maxPending);
+    ~FuseInvalDispatcher() = default;
+
+    using EntryKey = std::tuple<struct fuse_session *, fuse_ino_t, std::string>;
+    using InodeKey = std::pair<struct fuse_session *, fuse_ino_t>;
+
+    void ScheduleLocked(bool &startTick, bool &flushNow);
+    void Schedule(bool startTick, bool flushNow);
+    static void OnTick(void *data);
+
+    uint64_t tickMs_;
+    size_t maxPending_;
+    std::mutex mutex_;
+    std::mutex sendMutex_;
+    std::map<EntryKey, fuse_ino_t> entries_;
+    bool tickStarted_{false};
+    bool flushQueued_{false};
+    FuseInvalStats stats_;
+};
+} // namespace CloudFile
+} // namespace FileManagement
+} // namespace OHOS
+#endif // FUSE_INVAL_DISPATCHER_H
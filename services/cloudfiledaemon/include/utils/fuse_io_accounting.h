@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FUSE_IO_ACCOUNTING_H
+#define FUSE_IO_ACCOUNTING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <sys/types.h>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace FileManagement {
+namespace CloudFile {
+/* Totals of the requests served for one app since the daemon started. */
+struct FuseIoCounters {
+    uint64_t reads{0};
+    uint64_t readBytes{0};
+    uint64_t opens{0};
+    uint64_t stats{0};
+};
+
+/*
+ * Per-app counters of the requests the FUSE daemons serve, keyed by the uid of the caller. Counting takes no
+ * lock: a uid claims a slot of a fixed table the first time it is seen and then only adds to it. Requests of
+ * uids that find no free slot are counted as uncounted.
+ */
+class FuseIoAccounting final : public NoCopyable {
+public:
+    FuseIoAccounting() = default;
+    ~FuseIoAccounting() = default;
+
+    static FuseIoAccounting &GetInstance();
+    void CountRead(uid_t uid, uint64_t bytes);
+    void CountOpen(uid_t uid);
+    void CountStat(uid_t uid);
+    FuseIoCounters GetCounters(uid_t uid);
+    uint64_t GetUncountedCount();
+
+private:
+    static constexpr size_t SLOT_COUNT = 512;
+    static constexpr size_t MAX_PROBE = 32;
+
+    struct Slot {
+        /* uid + 1, 0 while the slot is free */
+        std::atomic<uint64_t> key{0};
+        std::atomic<uint64_t> reads{0};
+        std::atomic<uint64_t> readBytes{0};
+        std::atomic<uint64_t> opens{0};
+        std::atomic<uint64_t> stats{0};
+    };
+
+    Slot *FindSlot(uid_t uid, bool claim);
+
+    Slot slots_[SLOT_COUNT];
+    std::atomic<uint64_t> uncounted_{0};
+};
+} // namespace CloudFile
+} // namespace FileManagement
+} // namespace OHOS
+#endif // FUSE_IO_ACCOUNTING_H
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FUSE_WATCHDOG_H
+#define FUSE_WATCHDOG_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <sys/types.h>
+#include <vector>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace FileManagement {
+namespace CloudFile {
+using FuseWatchdogCallback = void (*)(void *arg);
+
+/* The operation a thread runs, published by the thread and read by the scanner. */
+struct FuseWatchdogSlot {
+    /* generation << 2 | phase, so the scanner cannot claim an operation that has already been replaced */
+    std::atomic<uint64_t> state{0};
+    std::atomic<int64_t> startMs{0};
+    std::atomic<uint32_t> timeoutMs{0};
+    std::atomic<const char *> name{nullptr};
+    std::atomic<FuseWatchdogCallback> callback{nullptr};
+    std::atomic<void *> arg{nullptr};
+    std::atomic<bool> retired{false};
+    pid_t tid{0};
+};
+
+/*
+ * Watchdog of short FUSE operations. An operation only stores its start stamp in the slot of its thread, and
+ * one scanner thread looks for the ones that run longer than their timeout. The overrun is logged and the
+ * callback of the operation runs once, on the scanner, while the operation waits for it before returning.
+ */
+class FuseWatchdog final : public NoCopyable {
+public:
+    class Guard final : public NoCopyable {
+    public:
+        /* name must outlive the operation, arg is passed to callback when the operation overruns */
+        Guard(const char *name, uint32_t timeoutMs, FuseWatchdogCallback callback = nullptr, void *arg = nullptr,
+            FuseWatchdog &watchdog = FuseWatchdog::GetInstance());
+        ~Guard();
+
+    private:
+        FuseWatchdogSlot *slot_{nullptr};
+    };
+
+    explicit FuseWatchdog(std::chrono::milliseconds scanPeriod);
+    ~FuseWatchdog();
+
+    static FuseWatchdog &GetInstance();
+    uint64_t GetOverrunCount();
+
+private:
+    enum Phase : uint64_t {
+        IDLE = 0,
+        ACTIVE = 1,
+        REPORTING = 2,
+        REPORTED = 3,
+    };
+    static constexpr uint64_t PHASE_BITS = 2;
+    static constexpr uint64_t PHASE_MASK = (1 << PHASE_BITS) - 1;
+
+    FuseWatchdogSlot *Begin(const char *name, uint32_t timeoutMs, FuseWatchdogCallback callback, void *arg);
+    static void End(FuseWatchdogSlot *slot);
+    FuseWatchdogSlot *GetThreadSlot();
+    void ScanLoop();
+    void Scan(int64_t nowMs);
+    static int64_t NowMs();
+
+    uint64_t id_;
+    std::chrono::milliseconds scanPeriod_;
+    std::mutex mutex_;
+    std::condition_variable scanCond_;
+    std::vector<std::shared_ptr<FuseWatchdogSlot>> slots_;
+    std::atomic<uint64_t> overruns_{0};
+    bool scannerStarted_{false};
+    bool scannerExited_{false};
+    bool stopped_{false};
+};
+} // namespace CloudFile
+} // namespace FileManagement
+} // namespace OHOS
+#endif // FUSE_WATCHDOG_H
@@ -190,7 +190,7 @@ void AccountStatusSubscriber::RemovedClean(const EventFwk::CommonEventData &even
     if (fuse_lowlevel_notify_inval_entry(se, parentSt.st_ino, bundleName.c_str(), bundleName.size())) {
         fuse_lowlevel_notify_inval_inode(se, childSt.st_ino, 0, 0);
     }
-    MetaFileMgr::GetInstance().CloudDiskClearAll();
+    MetaFileMgr::GetInstance().CloudDiskClearBundle(static_cast<uint32_t>(userId), bundleName);
     LOGI("Package Removed Complete Clean");
 }
 } // namespace CloudDisk
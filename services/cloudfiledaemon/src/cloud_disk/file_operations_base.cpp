@@ -69,16 +69,8 @@ void FileOperationsBase::Forget(fuse_req_t req, fuse_ino_t ino, uint64_t nLookup
 void FileOperationsBase::ForgetMulti(fuse_req_t req, size_t count, struct fuse_forget_data *forgets)
 {
     auto data = reinterpret_cast<struct CloudDiskFuseData *>(fuse_req_userdata(req));
-    for (size_t i = 0; i < count; i++) {
-        auto inoPtr = FileOperationsHelper::FindCloudDiskInode(data, static_cast<int64_t>(forgets[i].ino));
-        if (inoPtr == nullptr) {
-            CLOUD_FILE_FAULT_REPORT(CloudFile::CloudFileFaultInfo{"", CloudFile::FaultOperation::FORGETMULTI,
-                CloudFile::FaultType::WARNING, EINVAL, "ForgetMulti got an invalid inode"});
-            continue;
-        }
-        string localIdKey = std::to_string(inoPtr->parent) + inoPtr->fileName;
-        FileOperationsHelper::PutCloudDiskInode(data, inoPtr, forgets[i].nlookup, forgets[i].ino);
-        FileOperationsHelper::PutLocalId(data, inoPtr, localIdKey);
+    if (count != 0) {
+        FileOperationsHelper::PutCloudDiskInodes(data, vector<struct fuse_forget_data>(forgets, forgets + count));
     }
     fuse_reply_none(req);
 }
@@ -35,6 +35,8 @@
 #include "parameters.h"
 #include "file_operations_helper.h"
 #include "fuse_ioctl.h"
+#include "fuse_inval_dispatcher.h"
+#include "fuse_request_lane.h"
 #include "hitrace_meter.h"
 #include "securec.h"
 #include "utils_log.h"
@@ -72,7 +74,6 @@ namespace {
     static const unsigned int CATCH_TIMEOUT_S = 4;
     static const std::chrono::seconds READ_TIMEOUT_S = 16s;
     static const std::chrono::seconds OPEN_TIMEOUT_S = 4s;
-    static const uint64_t INVAL_TIMEOUT_MS = 5;
     static const uint32_t SERVICE_UID = 1009;
 }
 
@@ -88,16 +89,6 @@ struct SessionInitParams {
     std::shared_ptr<bool> openFinish;
 };
 
-struct FuseInvalData {
-    fuse_session *se;
-    fuse_ino_t parentIno;
-    fuse_ino_t childIno;
-    string childName;
-
-    FuseInvalData(fuse_session *seVal, fuse_ino_t parentInoVal, fuse_ino_t childInoVal, const string &childNameVal)
-        : se(seVal), parentIno(parentInoVal), childIno(childInoVal), childName(childNameVal) {}
-};
-
 struct ReadCompletionParams {
     shared_ptr<ffrt::condition_variable> cond;
     shared_ptr<bool> readFinish;
@@ -113,24 +104,9 @@ struct CloudReadParams {
     string path;
 };
 
-static void CallBack(void *data)
-{
-    FuseInvalData *fuseInvalData = static_cast<FuseInvalData *>(data);
-    if (fuse_lowlevel_notify_inval_entry(fuseInvalData->se, fuseInvalData->parentIno,
-                                         fuseInvalData->childName.c_str(), fuseInvalData->childName.size())) {
-        fuse_lowlevel_notify_inval_inode(fuseInvalData->se, fuseInvalData->childIno, 0, 0);
-    }
-
-    delete fuseInvalData;
-}
-
 static void fuse_inval(fuse_session *se, fuse_ino_t parentIno, fuse_ino_t childIno, const string &childName)
 {
-    FuseInvalData *fuseInvalData = new (nothrow) FuseInvalData(se, parentIno, childIno, childName);
-    if (fuseInvalData == nullptr) {
-        return;
-    }
-    ffrt_timer_start(ffrt_qos_background, INVAL_TIMEOUT_MS, static_cast<void *>(fuseInvalData), CallBack, false);
+    FuseInvalDispatcher::GetInstance().InvalEntry(se, parentIno, childIno, childName);
 }
 
 static void InitInodeAttr(struct CloudDiskFuseData *data, fuse_ino_t parent,
@@ -318,7 +294,7 @@ static int32_t DoCloudLookup(fuse_req_t req, fuse_ino_t parent, const char *name
 void FileOperationsCloud::Lookup(fuse_req_t req, fuse_ino_t parent, const char *name)
 {
     HITRACE_METER_NAME(HITRACE_TAG_FILEMANAGEMENT, __PRETTY_FUNCTION__);
-    struct fuse_entry_param e;
+    struct fuse_entry_param e = {};
     e.attr_timeout = 1.0;
     e.entry_timeout = 1.0;
     int32_t err = DoCloudLookup(req, parent, name, &e);
@@ -908,7 +884,9 @@ void FileOperationsCloud::MkNod(fuse_req_t req, fuse_ino_t parent, const char *n
                                 mode_t mode, dev_t rdev)
 {
     HITRACE_METER_NAME(HITRACE_TAG_FILEMANAGEMENT, __PRETTY_FUNCTION__);
-    struct fuse_entry_param e;
+    struct fuse_entry_param e = {};
+    e.attr_timeout = 1.0;
+    e.entry_timeout = 1.0;
     int32_t err = DoCreatFile(req, parent, name, mode, e);
     if (err < 0) {
         fuse_reply_err(req, -err);
@@ -923,7 +901,9 @@ void FileOperationsCloud::Create(fuse_req_t req, fuse_ino_t parent, const char *
 {
     HITRACE_METER_NAME(HITRACE_TAG_FILEMANAGEMENT, __PRETTY_FUNCTION__);
     auto data = reinterpret_cast<struct CloudDiskFuseData *>(fuse_req_userdata(req));
-    struct fuse_entry_param e;
+    struct fuse_entry_param e = {};
+    e.attr_timeout = 1.0;
+    e.entry_timeout = 1.0;
     int32_t err = DoCreatFile(req, parent, name, mode, e);
     if (err < 0) {
         fuse_reply_err(req, -err);
@@ -971,10 +951,16 @@ static size_t FindNextPos(const vector<MetaBase> &childInfos, off_t off)
     return 0;
 }
 
-static int32_t GetChildInfos(fuse_req_t req, fuse_ino_t ino, vector<CloudDiskFileInfo> &childInfos)
+static void SubmitToDataLane(struct CloudDiskFuseData *data, const FuseRequestLane::Task &task)
+{
+    if (data->dataLane == nullptr || !data->dataLane->Submit(task)) {
+        task();
+    }
+}
+
+static int32_t GetChildInfos(struct CloudDiskFuseData *data, fuse_ino_t ino, vector<CloudDiskFileInfo> &childInfos)
 {
     HITRACE_METER_NAME(HITRACE_TAG_FILEMANAGEMENT, __PRETTY_FUNCTION__);
-    auto data = reinterpret_cast<struct CloudDiskFuseData *>(fuse_req_userdata(req));
     auto inoPtr = FileOperationsHelper::FindCloudDiskInode(data, static_cast<int64_t>(ino));
     if (inoPtr == nullptr) {
         LOGE("inode not found");
@@ -1085,14 +1071,19 @@ void FileOperationsCloud::ReadDir(fuse_req_t req, fuse_ino_t ino, size_t size, o
         return;
     }
 
-    vector<CloudDiskFileInfo> childInfos;
-    int32_t err = GetChildInfos(req, ino, childInfos);
-    if (err != 0) {
-        CLOUD_FILE_FAULT_REPORT(CloudFile::CloudFileFaultInfo{"", CloudFile::FaultOperation::READDIR,
-            CloudFile::FaultType::QUERY_DATABASE, err, "failed to get child infos, err = " + std::to_string(err)});
-        return (void)fuse_reply_err(req, EINVAL);
-    }
-    AddDirEntryToBuf(req, ino, size, off, childInfos);
+    auto data = reinterpret_cast<struct CloudDiskFuseData *>(fuse_req_userdata(req));
+    auto readDir = [req, data, ino, size, off] {
+        vector<CloudDiskFileInfo> childInfos;
+        int32_t err = GetChildInfos(data, ino, childInfos);
+        if (err != 0) {
+            CLOUD_FILE_FAULT_REPORT(CloudFile::CloudFileFaultInfo{"", CloudFile::FaultOperation::READDIR,
+                CloudFile::FaultType::QUERY_DATABASE, err, "failed to get child infos, err = " + std::to_string(err)});
+            return (void)fuse_reply_err(req, EINVAL);
+        }
+        AddDirEntryToBuf(req, ino, size, off, childInfos);
+    };
+    // the database query runs on the data lane, the session thread goes back to metadata requests
+    SubmitToDataLane(data, readDir);
 }
 
 int32_t CheckXattr(const char *name)
@@ -1540,7 +1531,9 @@ void FileOperationsCloud::MkDir(fuse_req_t req, fuse_ino_t parent, const char *n
         return (void) fuse_reply_err(req, EINVAL);
     }
 
-    struct fuse_entry_param e;
+    struct fuse_entry_param e = {};
+    e.attr_timeout = 1.0;
+    e.entry_timeout = 1.0;
     err = DoCloudLookup(req, parent, name, &e);
     if (err != 0) {
         LOGE("Failed to find dir %{private}s", GetAnonyString(name).c_str());
@@ -1976,7 +1969,10 @@ void FileOperationsCloud::Read(fuse_req_t req, fuse_ino_t ino, size_t size,
     }
     string path = CloudFileUtils::GetLocalDKCachePath(inoPtr->cloudId, inoPtr->bundleName, data->userId);
     CloudReadParams readParams = {offset, size, buf, path};
-    DoCloudRead(req, filePtr, readParams);
+    auto cloudRead = [req, filePtr, readParams] {
+        DoCloudRead(req, filePtr, readParams);
+    };
+    SubmitToDataLane(data, cloudRead);
 }
 
 static void UpdateCloudDiskInode(shared_ptr<CloudDiskRdbStore> rdbStore, shared_ptr<CloudDiskInode> inoPtr)
@@ -270,6 +270,49 @@ void FileOperationsHelper::PutLocalId(struct CloudDiskFuseData *data,
             key + " refCount != 0 : " + std::to_string(inoPtr->refCount)});
     }
 }
+/* Batch form of PutCloudDiskInode() and PutLocalId(), each cache is locked once for the whole batch. */
+void FileOperationsHelper::PutCloudDiskInodes(struct CloudDiskFuseData *data,
+                                              const vector<struct fuse_forget_data> &forgets)
+{
+    vector<shared_ptr<CloudDiskInode>> released;
+    vector<pair<shared_ptr<CloudDiskInode>, int64_t>> referenced;
+    size_t invalidCount = 0;
+    {
+        std::unique_lock<std::shared_mutex> wLock(data->cacheLock);
+        for (const auto &forget : forgets) {
+            int64_t key = static_cast<int64_t>(forget.ino);
+            auto it = data->inodeCache.find(key);
+            if (it == data->inodeCache.end() || it->second == nullptr) {
+                invalidCount++;
+                continue;
+            }
+            auto inoPtr = it->second;
+            inoPtr->refCount -= forget.nlookup;
+            if (inoPtr->refCount == 0) {
+                data->inodeCache.erase(it);
+                released.push_back(inoPtr);
+            } else {
+                referenced.emplace_back(inoPtr, key);
+            }
+        }
+    }
+    if (!released.empty()) {
+        std::unique_lock<std::shared_mutex> wLock(data->localIdLock);
+        for (const auto &inoPtr : released) {
+            data->localIdCache.erase(to_string(inoPtr->parent) + inoPtr->fileName);
+        }
+    }
+    LOGD("forget %{public}zu inodes, released: %{public}zu", forgets.size(), released.size());
+    if (invalidCount != 0) {
+        CLOUD_FILE_FAULT_REPORT(CloudFile::CloudFileFaultInfo{"", CloudFile::FaultOperation::FORGETMULTI,
+            CloudFile::FaultType::WARNING, EINVAL, "ForgetMulti got invalid inodes: " + to_string(invalidCount)});
+    }
+    for (const auto &[inoPtr, key] : referenced) {
+        CLOUD_FILE_FAULT_REPORT(CloudFile::CloudFileFaultInfo{inoPtr->bundleName,
+            CloudFile::FaultOperation::FORGET, CloudFile::FaultType::CACHE_CLEAR, EINVAL,
+            to_string(key) + " refCount != 0 : " + to_string(inoPtr->refCount)});
+    }
+}
 } // namespace CloudDisk
 } // namespace FileManagement
 } // namespace OHOS
@@ -21,8 +21,8 @@
 #include "file_operations_cloud.h"
 #include "file_operations_helper.h"
 #include "fuse_ioctl.h"
+#include "fuse_watchdog.h"
 #include "utils_log.h"
-#include "xcollie_helper.h"
 
 namespace OHOS {
 namespace FileManagement {
@@ -32,10 +32,25 @@ using namespace CloudFile;
 static const int32_t BUNDLE_NAME_OFFSET = 1000000000;
 static const int32_t STAT_MODE_DIR = 0771;
 static const float LOOKUP_TIMEOUT = 60.0;
-#ifdef HICOLLIE_ENABLE
-static const unsigned int LOOKUP_TIMEOUT_S = 1;
-static const unsigned int GETATTR_TIMEOUT_S = 1;
-#endif
+static const uint32_t LOOKUP_TIMEOUT_MS = 1000;
+static const uint32_t GETATTR_TIMEOUT_MS = 1000;
+
+struct WatchdogInput {
+    string name_;
+    FaultOperation faultOperation_;
+};
+
+static void WatchdogCallback(void *input)
+{
+    auto watchdogInput = reinterpret_cast<WatchdogInput *>(input);
+    if (watchdogInput == nullptr) {
+        return;
+    }
+    FaultType faultType = watchdogInput->faultOperation_ == FaultOperation::LOOKUP ?
+        FaultType::CLOUD_FILE_LOOKUP_TIMEOUT : FaultType::TIMEOUT;
+    string msg = "In WatchdogCallback, name:" + GetAnonyString(watchdogInput->name_);
+    CLOUD_FILE_FAULT_REPORT(CloudFileFaultInfo{"", watchdogInput->faultOperation_, faultType, EWOULDBLOCK, msg});
+}
 
 static int32_t DoLocalLookup(fuse_req_t req, fuse_ino_t parent, const char *name,
                              struct fuse_entry_param *e)
@@ -96,25 +111,20 @@ void FileOperationsLocal::Lookup(fuse_req_t req, fuse_ino_t parent, const char *
     int32_t err;
     e.attr_timeout = LOOKUP_TIMEOUT;
     e.entry_timeout = LOOKUP_TIMEOUT;
-#ifdef HICOLLIE_ENABLE
-    auto xcollieId = XCollieHelper::SetTimer("CloudDisk_Lookup", LOOKUP_TIMEOUT_S, nullptr, nullptr, false);
-#endif
+    WatchdogInput watchdogInput{name, FaultOperation::LOOKUP};
+    FuseWatchdog::Guard guard("CloudDisk_Lookup", LOOKUP_TIMEOUT_MS, WatchdogCallback, &watchdogInput);
     err = DoLocalLookup(req, parent, name, &e);
     if (err) {
         fuse_reply_err(req, err);
     } else {
         fuse_reply_entry(req, &e);
     }
-#ifdef HICOLLIE_ENABLE
-    XCollieHelper::CancelTimer(xcollieId);
-#endif
 }
 
 void FileOperationsLocal::GetAttr(fuse_req_t req, fuse_ino_t ino, struct fuse_file_info *fi)
 {
-#ifdef HICOLLIE_ENABLE
-    auto xcollieId = XCollieHelper::SetTimer("CloudDisk_GetAttr", GETATTR_TIMEOUT_S, nullptr, nullptr, false);
-#endif
+    WatchdogInput watchdogInput{to_string(ino), FaultOperation::GETATTR};
+    FuseWatchdog::Guard guard("CloudDisk_GetAttr", GETATTR_TIMEOUT_MS, WatchdogCallback, &watchdogInput);
     struct CloudDiskFuseData *data = reinterpret_cast<struct CloudDiskFuseData *>(fuse_req_userdata(req));
     if (ino == FUSE_ROOT_ID) {
         string path = FileOperationsHelper::GetCloudDiskRootPath(data->userId);
@@ -126,15 +136,9 @@ void FileOperationsLocal::GetAttr(fuse_req_t req, fuse_ino_t ino, struct fuse_fi
                 CloudFile::FaultType::FILE, errno, "lookup " + GetAnonyString(path) + " error, err: " +
                 std::to_string(errno)});
             fuse_reply_err(req, errno);
-#ifdef HICOLLIE_ENABLE
-            XCollieHelper::CancelTimer(xcollieId);
-#endif
             return;
         }
         fuse_reply_attr(req, &statBuf, 0);
-#ifdef HICOLLIE_ENABLE
-        XCollieHelper::CancelTimer(xcollieId);
-#endif
         return;
     }
     auto inoPtr = FileOperationsHelper::FindCloudDiskInode(data, static_cast<int64_t>(ino));
@@ -142,15 +146,9 @@ void FileOperationsLocal::GetAttr(fuse_req_t req, fuse_ino_t ino, struct fuse_fi
         CLOUD_FILE_FAULT_REPORT(CloudFile::CloudFileFaultInfo{"", CloudFile::FaultOperation::GETATTR,
             CloudFile::FaultType::INODE_FILE, EINVAL, "inode not found"});
         fuse_reply_err(req, EINVAL);
-#ifdef HICOLLIE_ENABLE
-        XCollieHelper::CancelTimer(xcollieId);
-#endif
         return;
     }
     fuse_reply_attr(req, &inoPtr->stat, 0);
-#ifdef HICOLLIE_ENABLE
-    XCollieHelper::CancelTimer(xcollieId);
-#endif
 }
 
 void FileOperationsLocal::ReadDir(fuse_req_t req, fuse_ino_t ino, size_t size, off_t off,
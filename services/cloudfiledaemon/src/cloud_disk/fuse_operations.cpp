@@ -18,6 +18,7 @@
 #include "cloud_file_fault_event.h"
 #include "file_operations_helper.h"
 #include "file_operations_local.h"
+#include "fuse_io_accounting.h"
 #include "utils_log.h"
 
 namespace OHOS {
@@ -33,6 +34,7 @@ static std::shared_ptr<CloudDiskInode> GetCloudDiskInode(fuse_req_t req, fuse_in
 
 void FuseOperations::Lookup(fuse_req_t req, fuse_ino_t parent, const char *name)
 {
+    CloudFile::FuseIoAccounting::GetInstance().CountStat(req->ctx.uid);
     if (parent == FUSE_ROOT_ID) {
         auto opsPtr = make_shared<FileOperationsLocal>();
         opsPtr->Lookup(req, parent, name);
@@ -66,6 +68,7 @@ void FuseOperations::Access(fuse_req_t req, fuse_ino_t ino, int mask)
 
 void FuseOperations::GetAttr(fuse_req_t req, fuse_ino_t ino, struct fuse_file_info *fi)
 {
+    CloudFile::FuseIoAccounting::GetInstance().CountStat(req->ctx.uid);
     if (ino == FUSE_ROOT_ID) {
         auto opsPtr = make_shared<FileOperationsLocal>();
         opsPtr->GetAttr(req, ino, fi);
@@ -83,6 +86,7 @@ void FuseOperations::GetAttr(fuse_req_t req, fuse_ino_t ino, struct fuse_file_in
 
 void FuseOperations::Open(fuse_req_t req, fuse_ino_t ino, struct fuse_file_info *fi)
 {
+    CloudFile::FuseIoAccounting::GetInstance().CountOpen(req->ctx.uid);
     if (ino == FUSE_ROOT_ID) {
         auto opsPtr = make_shared<FileOperationsLocal>();
         opsPtr->Open(req, ino, fi);
@@ -117,18 +121,15 @@ void FuseOperations::Forget(fuse_req_t req, fuse_ino_t ino, uint64_t nLookup)
 
 void FuseOperations::ForgetMulti(fuse_req_t req, size_t count, struct fuse_forget_data *forgets)
 {
-    if (count == 0 || forgets[0].ino == FUSE_ROOT_ID) {
-        fuse_reply_err(req, EINVAL);
-        return;
-    }
-    auto inoPtr = GetCloudDiskInode(req, forgets[0].ino);
-    if (inoPtr == nullptr) {
-        CLOUD_FILE_FAULT_REPORT(CloudFile::CloudFileFaultInfo{"", CloudFile::FaultOperation::FORGETMULTI,
-            CloudFile::FaultType::INODE_FILE, EINVAL, "inode not found"});
-        fuse_reply_err(req, EINVAL);
-        return;
-    }
-    inoPtr->ops->ForgetMulti(req, count, forgets);
+    /*
+     * A batch mixes local and cloud inodes, and the root, so it is not handed to the ops of its first inode.
+     * Releasing an inode is the same for every ops, the whole batch is released in one pass.
+     */
+    auto data = reinterpret_cast<struct CloudDiskFuseData *>(fuse_req_userdata(req));
+    if (count != 0) {
+        FileOperationsHelper::PutCloudDiskInodes(data, vector<struct fuse_forget_data>(forgets, forgets + count));
+    }
+    fuse_reply_none(req);
 }
 
 void FuseOperations::MkNod(fuse_req_t req, fuse_ino_t parent, const char *name,
@@ -294,6 +295,7 @@ void FuseOperations::Rename(fuse_req_t req, fuse_ino_t parent, const char *name,
 void FuseOperations::Read(fuse_req_t req, fuse_ino_t ino, size_t size,
                           off_t offset, struct fuse_file_info *fi)
 {
+    CloudFile::FuseIoAccounting::GetInstance().CountRead(req->ctx.uid, size);
     if (ino == FUSE_ROOT_ID) {
         auto opsPtr = make_shared<FileOperationsLocal>();
         opsPtr->Read(req, ino, size, offset, fi);
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fuse_request_lane.h"
+
+#include <algorithm>
+#include <pthread.h>
+#include <thread>
+
+#include "utils_log.h"
+
+namespace OHOS {
+namespace FileManagement {
+namespace CloudDisk {
+using namespace std;
+namespace {
+    static const uint32_t DATA_LANE_MIN_WORKERS = 1;
+    static const uint32_t DATA_LANE_MAX_WORKERS = 8;
+    static const size_t DATA_LANE_MAX_PENDING = 256;
+    static const chrono::milliseconds DATA_LANE_IDLE_TIMEOUT = 5000ms;
+    static const size_t THREAD_NAME_LEN = 15;
+}
+
+FuseRequestLane::FuseRequestLane(const string &name, uint32_t minWorkers, uint32_t maxWorkers,
+    size_t maxPending, chrono::milliseconds idleTimeout)
+    : name_(name), minWorkers_(minWorkers), maxWorkers_(max(maxWorkers, 1u)), maxPending_(maxPending),
+      idleTimeout_(idleTimeout)
+{
+}
+
+FuseRequestLane::~FuseRequestLane()
+{
+    Stop();
+}
+
+shared_ptr<FuseRequestLane> FuseRequestLane::CreateDataLane()
+{
+    return make_shared<FuseRequestLane>("fuse_data_lane", DATA_LANE_MIN_WORKERS, DATA_LANE_MAX_WORKERS,
+        DATA_LANE_MAX_PENDING, DATA_LANE_IDLE_TIMEOUT);
+}
+
+bool FuseRequestLane::Submit(Task task)
+{
+    bool addWorker = false;
+    {
+        lock_guard<mutex> lock(mutex_);
+        if (stopped_ || tasks_.size() >= maxPending_) {
+            return false;
+        }
+        tasks_.push_back(move(task));
+        if (tasks_.size() > idleWorkers_ && workers_ < maxWorkers_) {
+            // counted here so that concurrent submits do not overshoot maxWorkers
+            workers_++;
+            peakWorkers_ = max(peakWorkers_, workers_);
+            addWorker = true;
+        }
+    }
+    taskCond_.notify_one();
+    if (addWorker) {
+        StartWorker();
+    }
+    return true;
+}
+
+void FuseRequestLane::StartWorker()
+{
+    thread([this] {
+        pthread_setname_np(pthread_self(), name_.substr(0, THREAD_NAME_LEN).c_str());
+        WorkerLoop();
+    }).detach();
+}
+
+void FuseRequestLane::WorkerLoop()
+{
+    unique_lock<mutex> lock(mutex_);
+    while (true) {
+        if (tasks_.empty()) {
+            if (stopped_) {
+                break;
+            }
+            idleWorkers_++;
+            bool hasTask = taskCond_.wait_for(lock, idleTimeout_, [this] {
+                return !tasks_.empty() || stopped_;
+            });
+            idleWorkers_--;
+            if (!hasTask && workers_ > minWorkers_) {
+                break;
+            }
+            continue;
+        }
+        Task task = move(tasks_.front());
+        tasks_.pop_front();
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+    workers_--;
+    exitCond_.notify_all();
+}
+
+void FuseRequestLane::Start()
+{
+    lock_guard<mutex> lock(mutex_);
+    stopped_ = false;
+}
+
+void FuseRequestLane::Stop()
+{
+    unique_lock<mutex> lock(mutex_);
+    stopped_ = true;
+    taskCond_.notify_all();
+    // queued tasks still own unanswered fuse requests, the workers drain them before leaving
+    exitCond_.wait(lock, [this] {
+        return workers_ == 0;
+    });
+    if (!tasks_.empty()) {
+        LOGW("%{public}s stopped with %{public}zu tasks left", name_.c_str(), tasks_.size());
+        tasks_.clear();
+    }
+}
+
+uint32_t FuseRequestLane::GetWorkerCount()
+{
+    lock_guard<mutex> lock(mutex_);
+    return workers_;
+}
+
+uint32_t FuseRequestLane::GetPeakWorkerCount()
+{
+    lock_guard<mutex> lock(mutex_);
+    return peakWorkers_;
+}
+
+size_t FuseRequestLane::GetPendingCount()
+{
+    lock_guard<mutex> lock(mutex_);
+    return tasks_.size();
+}
+} // namespace CloudDisk
+} // namespace FileManagement
+} // namespace OHOS
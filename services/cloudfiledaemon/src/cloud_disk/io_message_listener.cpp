@@ -14,11 +14,18 @@
  */
 #include "io_message_listener.h"
 
+#include <algorithm>
+#include <cerrno>
 #include <chrono>
-#include <cstdlib>
+#include <climits>
+#include <cstring>
 #include <ctime>
+#include <fcntl.h>
+#include <filesystem>
 #include <iomanip>
 #include <sstream>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <unordered_set>
 #include "datetime_ex.h"
 #include "hisysevent.h"
@@ -31,17 +38,26 @@ namespace OHOS {
 namespace FileManagement {
 namespace CloudDisk {
 
+/*
+ * Thresholds in FUSE requests per GET_FREQUENCY seconds. The former limit was 1000 syscalls of each kind.
+ * Every open reaches the daemons, so that limit stays. Readahead merges the page cache misses of about four
+ * 32 KiB read syscalls into one 128 KiB request. Lookups and getattrs reach the daemons once per file and
+ * cache timeout of 1 s, which leaves about one request of the five stats an app typically issues per file.
+ */
 const int32_t GET_FREQUENCY = 5;
-const int32_t READ_THRESHOLD = 1000;
-const int32_t OPEN_THRESHOLD = 1000;
-const int32_t STAT_THRESHOLD = 1000;
+const int64_t FUSE_READ_THRESHOLD = 250;
+const int64_t FUSE_OPEN_THRESHOLD = 1000;
+const int64_t FUSE_STAT_THRESHOLD = 200;
+const string IO_EVENT_NAME = "ABNORMAL_FUSE_IO_STATISTICS_DATA";
 const string IO_DATA_FILE_PATH = "/data/service/el1/public/cloudfile/io/";
-const string IO_FILE_NAME = "io_message.csv";
-const string IO_NEED_REPORT_PREFIX = "wait_report_";
+const string IO_RING_FILE_NAME = "io_message.ring";
+const string IO_LEGACY_FILE_NAME = "io_message.csv";
+const string IO_LEGACY_REPORT_FILE_NAME = "wait_report_io_message.csv";
 const int32_t TYPE_FRONT = 2;
 const int32_t TYPE_BACKGROUND = 4;
-const int32_t MAX_IO_FILE_SIZE = 16 * 1024;
-const size_t MAX_RECORD_IN_FILE = 10000;
+const uint32_t IO_RING_MAGIC = 0x494f5247;
+const uint32_t IO_RING_VERSION = 2;
+const uint32_t IO_RING_CAPACITY = 256;
 const size_t MAX_IO_REPORT_NUMBER = 100;
 
 const std::unordered_set<std::string> BUNDLE_NAME_CHECKLIST = {
@@ -49,6 +65,18 @@ const std::unordered_set<std::string> BUNDLE_NAME_CHECKLIST = {
     "inputmethod",
 };
 
+IoMessageManager::IoMessageManager() : ringPath(IO_DATA_FILE_PATH + IO_RING_FILE_NAME)
+{
+}
+
+IoMessageManager::~IoMessageManager()
+{
+    if (ringFd >= 0) {
+        close(ringFd);
+        ringFd = -1;
+    }
+}
+
 IoMessageManager &IoMessageManager::GetInstance()
 {
     static IoMessageManager instance;
@@ -66,11 +94,9 @@ bool IoMessageManager::CheckBundleName(const std::string &appBundleName)
     return true;
 }
 
-string IoMessageManager::GetIoDatetime()
+string IoMessageManager::GetIoDatetime(int64_t datetime)
 {
-    int64_t currentTime = GetSecondsSince1970ToNow();
-
-    time_t time_t_seconds = static_cast<time_t>(currentTime);
+    time_t time_t_seconds = static_cast<time_t>(datetime);
     std::tm* localTime = std::localtime(&time_t_seconds);
 
     std::ostringstream oss;
@@ -79,144 +105,104 @@ string IoMessageManager::GetIoDatetime()
     return oss.str();
 }
 
-bool IoMessageManager::ReadIoDataFromFile(const std::string &path)
+static int64_t GetSteadySeconds()
 {
-    ifstream inFile(path);
-    if (!inFile.is_open()) {
-        LOGE("Failed to open io, err: %{public}d", errno);
-        return false;
-    }
-
-    string line;
-    while (getline(inFile, line)) {
-        size_t colon = line.find(':');
-        if (colon == string::npos) {
-            continue;
-        }
-
-        string key = line.substr(0, colon);
-        string value = line.substr(colon + 1);
-
-        char *end = nullptr;
-        errno = 0;
-        long val = strtol(value.c_str(), &end, 10);
-        if (end == value.c_str() || *end != '\0') {
-            LOGE("Invalid numeric value for key: %{public}s", key.c_str());
-            currentData = preData;
-            return false;
-        }
-        if (errno == ERANGE) {
-            LOGE("Numeric value out of range for key: %{public}s", key.c_str());
-            currentData = preData;
-            return false;
-        }
-        if (key == "rchar") currentData.rchar = val;
-        if (key == "syscr") currentData.syscr = val;
-        if (key == "read_bytes") currentData.readBytes = val;
-        if (key == "syscopen") currentData.syscopen = val;
-        if (key == "syscstat") currentData.syscstat = val;
-    }
-    return true;
+    return duration_cast<seconds>(steady_clock::now().time_since_epoch()).count();
 }
 
-
-void IoMessageManager::RecordDataToFile(const string &path)
+static off_t GetRecordOffset(uint64_t index, uint32_t capacity)
 {
-    ofstream outFile(path, ios::app);
-    if (!outFile) {
-        LOGE("Failed to open io file to write, err: %{public}d", errno);
-        return;
-    }
-
-    outFile << bundleTimeMap[dataToWrite.bundleName] << ","
-            << dataToWrite.bundleName << ","
-            << dataToWrite.rcharDiff << ","
-            << dataToWrite.syscrDiff << ","
-            << dataToWrite.readBytesDiff << ","
-            << dataToWrite.syscopenDiff << ","
-            << dataToWrite.syscstatDiff << ","
-            << dataToWrite.result << ","
-            << dataToWrite.datetime << "\n";
-    LOGD("Write io data success");
+    return static_cast<off_t>(sizeof(IoRingHeader) + (index % capacity) * sizeof(IoRecord));
 }
 
-static vector<const char*> ConvertToCStringArray(const vector<string>& vec)
+bool IoMessageManager::WriteRingHeaderLocked()
 {
-    vector<const char*> cstrVec;
-    for (const auto& str : vec) {
-        cstrVec.push_back(str.c_str());
+    ssize_t ret = pwrite(ringFd, &ringHeader, sizeof(ringHeader), 0);
+    if (ret != static_cast<ssize_t>(sizeof(ringHeader))) {
+        LOGE("Failed to write io ring header, err: %{public}d", errno);
+        return false;
     }
-    return cstrVec;
+    return true;
 }
 
-template <typename T>
-void PushField(const std::string &value, std::vector<T> &vec)
+bool IoMessageManager::OpenRingLocked()
 {
-    if constexpr (std::is_same_v<T, int32_t>) {
-        vec.push_back(std::stoi(value));
-    } else if constexpr (std::is_same_v<T, int64_t>) {
-        vec.push_back(std::stoll(value));
-    } else if constexpr (std::is_same_v<T, double>) {
-        vec.push_back(std::stod(value));
-    } else {
-        vec.push_back(value);
+    if (ringFd >= 0) {
+        return true;
     }
-}
-
-bool CheckInt(const std::string &value)
-{
-    if (value.empty()) {
+    int fd = open(ringPath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        LOGE("Failed to open io ring file, err: %{public}d", errno);
         return false;
     }
-    if (!all_of(value.begin(), value.end(), ::isdigit)) {
+    ringFd = fd;
+    ssize_t ret = pread(fd, &ringHeader, sizeof(ringHeader), 0);
+    if (ret == static_cast<ssize_t>(sizeof(ringHeader)) && ringHeader.magic == IO_RING_MAGIC &&
+        ringHeader.version == IO_RING_VERSION && ringHeader.capacity == IO_RING_CAPACITY &&
+        ringHeader.recordSize == sizeof(IoRecord) && ringHeader.reported <= ringHeader.head) {
+        return true;
+    }
+    // a new file, or one written in another layout, starts over empty
+    ringHeader = {IO_RING_MAGIC, IO_RING_VERSION, IO_RING_CAPACITY, sizeof(IoRecord), 0, 0};
+    if (ftruncate(fd, 0) != 0 || !WriteRingHeaderLocked()) {
+        LOGE("Failed to init io ring file, err: %{public}d", errno);
+        close(fd);
+        ringFd = -1;
         return false;
     }
+    // the text files of the former /proc sampling are never reported any more
+    filesystem::path dir = filesystem::path(ringPath).parent_path();
+    std::error_code errCode;
+    filesystem::remove(dir / IO_LEGACY_FILE_NAME, errCode);
+    filesystem::remove(dir / IO_LEGACY_REPORT_FILE_NAME, errCode);
     return true;
 }
 
-bool CheckDouble(const std::string &value)
+bool IoMessageManager::AppendRecordLocked(const IoRecord &record)
 {
-    if (value.empty()) {
+    if (!OpenRingLocked()) {
         return false;
     }
-
-    errno = 0;
-    char *endptr;
-    std::strtod(value.c_str(), &endptr);
-    if (errno != 0) {
+    ssize_t ret = pwrite(ringFd, &record, sizeof(record), GetRecordOffset(ringHeader.head, ringHeader.capacity));
+    if (ret != static_cast<ssize_t>(sizeof(record))) {
+        LOGE("Failed to write io record, err: %{public}d", errno);
         return false;
     }
-    return *endptr == '\0' || *endptr == '\r';
+    ringHeader.head++;
+    if (ringHeader.head - ringHeader.reported > ringHeader.capacity) {
+        LOGW("io ring is full, drop the oldest record");
+        ringHeader.reported = ringHeader.head - ringHeader.capacity;
+    }
+    return WriteRingHeaderLocked();
 }
 
-struct PushBackVisitor {
-    const std::string &value;
-
-    template<typename T>
-    void operator()(std::vector<T> &vec)
-    {
-        PushField(value, vec);
+void IoMessageManager::TakePendingRecordsLocked(vector<IoRecord> &records)
+{
+    if (!OpenRingLocked()) {
+        return;
     }
-};
-
-struct CheckVisitor {
-    const std::string &value;
-    bool &checkType;
-
-    template<typename T>
-    void operator()(std::vector<T> &vec)
-    {
-        if constexpr (std::is_same_v<T, int32_t>) {
-            checkType = CheckInt(value);
-        } else if constexpr (std::is_same_v<T, int64_t>) {
-            checkType = CheckInt(value);
-        } else if constexpr (std::is_same_v<T, double>) {
-            checkType = CheckDouble(value);
-        } else if constexpr (std::is_same_v<T, std::string>) {
-            checkType = true;
+    for (uint64_t index = ringHeader.reported; index < ringHeader.head; index++) {
+        IoRecord record;
+        ssize_t ret = pread(ringFd, &record, sizeof(record), GetRecordOffset(index, ringHeader.capacity));
+        if (ret != static_cast<ssize_t>(sizeof(record))) {
+            LOGE("Failed to read io record, err: %{public}d", errno);
+            break;
         }
+        record.bundleName[IO_BUNDLE_NAME_LEN - 1] = '\0';
+        records.push_back(record);
     }
-};
+    ringHeader.reported = ringHeader.head;
+    WriteRingHeaderLocked();
+}
+
+static vector<const char*> ConvertToCStringArray(const vector<string>& vec)
+{
+    vector<const char*> cstrVec;
+    for (const auto& str : vec) {
+        cstrVec.push_back(str.c_str());
+    }
+    return cstrVec;
+}
 
 template <typename T>
 HiSysEventParam CreateParam(const std::string name, HiSysEventParamType type, std::vector<T> &data)
@@ -245,24 +231,20 @@ void IoMessageManager::Report()
     HiSysEventParam params[] = {
         CreateParam("TIME", HISYSEVENT_INT32_ARRAY, GetVector<Int32Vector, VectorIndex::IO_TIMES>(targetVectors)),
         CreateParam("BUNDLENAME", HISYSEVENT_STRING_ARRAY, charIoBundleName),
-        CreateParam("READCHAR", HISYSEVENT_INT64_ARRAY,
-            GetVector<Int64Vector, VectorIndex::IO_READ_CHAR_DIFF>(targetVectors)),
-        CreateParam("SYSCR", HISYSEVENT_INT64_ARRAY,
-            GetVector<Int64Vector, VectorIndex::IO_SYSC_READ_DIFF>(targetVectors)),
-        CreateParam("READBYTES", HISYSEVENT_INT64_ARRAY,
-            GetVector<Int64Vector, VectorIndex::IO_READ_BYTES_DIFF>(targetVectors)),
-        CreateParam("SYSCOPEN", HISYSEVENT_INT64_ARRAY,
-            GetVector<Int64Vector, VectorIndex::IO_SYSC_OPEN_DIFF>(targetVectors)),
-        CreateParam("SYSCSTAT", HISYSEVENT_INT64_ARRAY,
-            GetVector<Int64Vector, VectorIndex::IO_SYSC_STAT_DIFF>(targetVectors)),
-        CreateParam("RESULT", HISYSEVENT_DOUBLE_ARRAY,
-            GetVector<DoubleVector, VectorIndex::IO_RESULT>(targetVectors)),
+        CreateParam("FUSE_READ_BYTES", HISYSEVENT_INT64_ARRAY,
+            GetVector<Int64Vector, VectorIndex::IO_FUSE_READ_BYTES>(targetVectors)),
+        CreateParam("FUSE_READ", HISYSEVENT_INT64_ARRAY,
+            GetVector<Int64Vector, VectorIndex::IO_FUSE_READ>(targetVectors)),
+        CreateParam("FUSE_OPEN", HISYSEVENT_INT64_ARRAY,
+            GetVector<Int64Vector, VectorIndex::IO_FUSE_OPEN>(targetVectors)),
+        CreateParam("FUSE_STAT", HISYSEVENT_INT64_ARRAY,
+            GetVector<Int64Vector, VectorIndex::IO_FUSE_STAT>(targetVectors)),
         CreateParam("DATETIME", HISYSEVENT_STRING_ARRAY, charIoDatetime)
     };
 
     auto ret = OH_HiSysEvent_Write(
         "HM_FS",
-        "ABNORMAL_IO_STATISTICS_DATA",
+        IO_EVENT_NAME.c_str(),
         HISYSEVENT_STATISTIC,
         params,
         sizeof(params) / sizeof(params[0])
@@ -278,175 +260,104 @@ void IoMessageManager::Report()
     }
 }
 
-void IoMessageManager::PushData(const vector<string> &fields)
+void IoMessageManager::PushRecord(const IoRecord &record)
 {
-    if (fields.size() != targetVectors.size()) {
-        return;
-    }
-    for (uint32_t i = 0; i < fields.size(); ++i) {
-        bool checkType = false;
-        CheckVisitor visitor{fields[i], checkType};
-        std::visit(visitor, targetVectors[i]);
-        if (!checkType) {
-            LOGI("checkType failed. value = %{public}s", fields[i].c_str());
-            return;
-        }
-    }
-    for (uint32_t i = 0; i < fields.size(); ++i) {
-        PushBackVisitor visitor{fields[i]};
-        std::visit(visitor, targetVectors[i]);
-    }
-    return;
+    GetVector<Int32Vector, VectorIndex::IO_TIMES>(targetVectors).push_back(record.foregroundTime);
+    GetVector<StringVector, VectorIndex::IO_BUNDLE_NAME>(targetVectors).push_back(record.bundleName);
+    GetVector<Int64Vector, VectorIndex::IO_FUSE_READ_BYTES>(targetVectors).push_back(record.readBytes);
+    GetVector<Int64Vector, VectorIndex::IO_FUSE_READ>(targetVectors).push_back(record.reads);
+    GetVector<Int64Vector, VectorIndex::IO_FUSE_OPEN>(targetVectors).push_back(record.opens);
+    GetVector<Int64Vector, VectorIndex::IO_FUSE_STAT>(targetVectors).push_back(record.stats);
+    GetVector<StringVector, VectorIndex::IO_DATETIME>(targetVectors).push_back(GetIoDatetime(record.datetime));
 }
 
 void IoMessageManager::ReadAndReportIoMessage()
 {
-    ifstream localData(IO_DATA_FILE_PATH + IO_NEED_REPORT_PREFIX + IO_FILE_NAME);
-    if (!localData) {
-        LOGE("Open cloud data statistic local data fail : %{public}d", errno);
-        return;
+    vector<IoRecord> records;
+    {
+        lock_guard<ffrt::mutex> lock(ioMutex);
+        TakePendingRecordsLocked(records);
     }
-
-    string line;
     size_t reportCount = 0;
-    size_t totalCount = 0;
-    while (getline(localData, line)) {
-        vector<string> fields;
-        istringstream iss(line);
-        string token;
-
-        while (getline(iss, token, ',')) {
-            fields.push_back(token);
-        }
-
-        PushData(fields);
+    for (const auto &record : records) {
+        PushRecord(record);
         reportCount++;
-        totalCount++;
         if (reportCount >= MAX_IO_REPORT_NUMBER) {
             Report();
             reportCount = 0;
         }
-        if (totalCount >= MAX_RECORD_IN_FILE) {
-            break;
-        }
     }
     if (reportCount > 0) {
         Report();
     }
-    bool ret = filesystem::remove(IO_DATA_FILE_PATH + IO_NEED_REPORT_PREFIX + IO_FILE_NAME);
-    if (!ret) {
-        LOGE("Failed to remove need_report_io_file, err:%{public}d", errno);
-    }
     reportThreadRunning.store(false);
 }
 
-void IoMessageManager::CheckMaxSizeAndReport()
+bool IoMessageManager::IsAbnormal(const IoRecord &record)
 {
-    std::error_code errCode;
-    if (!filesystem::exists(IO_DATA_FILE_PATH + IO_FILE_NAME, errCode) || errCode.value() != 0) {
-        LOGE("source file not exist");
-        return;
-    }
-    auto fileSize = filesystem::file_size(IO_DATA_FILE_PATH + IO_FILE_NAME, errCode);
-    if (fileSize < MAX_IO_FILE_SIZE || errCode.value() != 0) {
-        return;
-    }
-    if (filesystem::exists(IO_DATA_FILE_PATH + IO_NEED_REPORT_PREFIX + IO_FILE_NAME)) {
-        LOGI("Report file exist");
-    }
-    filesystem::rename(IO_DATA_FILE_PATH + IO_FILE_NAME,
-        IO_DATA_FILE_PATH + IO_NEED_REPORT_PREFIX + IO_FILE_NAME, errCode);
-    if (errCode.value() != 0) {
-        LOGE("Failed to rename file, error code: %{public}d", errCode.value());
-        return;
-    }
-    if (!reportThreadRunning.load()) {
-        reportThreadRunning.store(true);
-        LOGI("Start report io data");
-        ffrt::submit([this] { ReadAndReportIoMessage(); }, {}, {}, ffrt::task_attr().qos(ffrt::qos_background));
-    }
+    // the thresholds hold for GET_FREQUENCY seconds, shorter stays are judged as one such period
+    int64_t duration = max<int64_t>(record.foregroundTime, GET_FREQUENCY);
+    return record.reads * GET_FREQUENCY >= FUSE_READ_THRESHOLD * duration ||
+        record.opens * GET_FREQUENCY >= FUSE_OPEN_THRESHOLD * duration ||
+        record.stats * GET_FREQUENCY >= FUSE_STAT_THRESHOLD * duration;
 }
 
-void IoMessageManager::ProcessIoData(const string &path)
+void IoMessageManager::OpenWindowLocked(const AppExecFwk::AppStateData &appStateData)
 {
-    if (currentBundleName != lastestAppStateData.bundleName) {
-        bundleTimeMap[lastestAppStateData.bundleName] = 0;
-    }
+    currentBundleName = appStateData.bundleName;
+    window.uid = appStateData.uid;
+    window.startTime = GetSteadySeconds();
+    window.start = CloudFile::FuseIoAccounting::GetInstance().GetCounters(static_cast<uid_t>(window.uid));
+}
 
-    if (!ReadIoDataFromFile(path)) {
+void IoMessageManager::CloseWindowLocked()
+{
+    string bundleName = currentBundleName;
+    IoWindow last = window;
+    currentBundleName = "";
+    window = {};
+    if (bundleName.empty() || last.uid < 0) {
         return;
     }
-
-    if (preData.rchar == 0) {
-        preData = currentData;
+    auto end = CloudFile::FuseIoAccounting::GetInstance().GetCounters(static_cast<uid_t>(last.uid));
+    IoRecord record;
+    record.datetime = GetSecondsSince1970ToNow();
+    record.foregroundTime = static_cast<int32_t>(min<int64_t>(GetSteadySeconds() - last.startTime, INT32_MAX));
+    record.readBytes = static_cast<int64_t>(end.readBytes - last.start.readBytes);
+    record.reads = static_cast<int64_t>(end.reads - last.start.reads);
+    record.opens = static_cast<int64_t>(end.opens - last.start.opens);
+    record.stats = static_cast<int64_t>(end.stats - last.start.stats);
+    if (!IsAbnormal(record)) {
         return;
     }
-
-    currentBundleName = lastestAppStateData.bundleName;
-    dataToWrite.datetime = GetIoDatetime();
-    dataToWrite.bundleName = lastestAppStateData.bundleName;
-    dataToWrite.rcharDiff = currentData.rchar - preData.rchar;
-    dataToWrite.syscrDiff = currentData.syscr - preData.syscr;
-    dataToWrite.readBytesDiff = currentData.readBytes - preData.readBytes;
-    dataToWrite.syscopenDiff = currentData.syscopen - preData.syscopen;
-    dataToWrite.syscstatDiff = currentData.syscstat - preData.syscstat;
-
-    /* Prevent division by zero */
-    if (dataToWrite.rcharDiff + 1 != 0) {
-        dataToWrite.result = (dataToWrite.readBytesDiff) / (dataToWrite.rcharDiff + 1) * dataToWrite.syscrDiff;
-    }
-
-    if (dataToWrite.result >= READ_THRESHOLD ||
-        dataToWrite.syscopenDiff >= OPEN_THRESHOLD ||
-        dataToWrite.syscstatDiff >= STAT_THRESHOLD) {
-        CheckMaxSizeAndReport();
-        RecordDataToFile(IO_DATA_FILE_PATH + IO_FILE_NAME);
+    size_t len = min(bundleName.size(), IO_BUNDLE_NAME_LEN - 1);
+    bundleName.copy(record.bundleName, len);
+    record.bundleName[len] = '\0';
+    if (!AppendRecordLocked(record)) {
+        return;
     }
-
-    preData = currentData;
-    bundleTimeMap[lastestAppStateData.bundleName] += GET_FREQUENCY;
-}
-
-void IoMessageManager::RecordIoData()
-{
-    while (isThreadRunning.load()) {
-        unique_lock<ffrt::mutex> lock(sleepMutex);
-        if (!lastestAppStateData.bundleName.empty()) {
-            string path = "/proc/" + to_string(lastestAppStateData.pid) + "/sys_count";
-            ProcessIoData(path);
-        }
-        sleepCv.wait_for(lock, chrono::seconds(GET_FREQUENCY), [&] {
-            return !isThreadRunning.load();
-        });
+    if (ringHeader.head - ringHeader.reported >= MAX_IO_REPORT_NUMBER && !reportThreadRunning.exchange(true)) {
+        LOGI("Start report io data");
+        ffrt::submit([this] { ReadAndReportIoMessage(); }, {}, {}, ffrt::task_attr().qos(ffrt::qos_background));
     }
 }
 
 void IoMessageManager::OnReceiveEvent(const AppExecFwk::AppStateData &appStateData)
 {
-    lock_guard<ffrt::mutex> lock(sleepMutex);
+    lock_guard<ffrt::mutex> lock(ioMutex);
     if (!CheckBundleName(appStateData.bundleName)) {
         return;
     }
 
     if (appStateData.state == TYPE_FRONT) {
-        lastestAppStateData = appStateData;
-        if (currentBundleName != lastestAppStateData.bundleName) {
-            bundleTimeMap[lastestAppStateData.bundleName] = 0;
-            currentBundleName = lastestAppStateData.bundleName;
-            preData = {};
-            sleepCv.notify_all();
-        }
-        if (!isThreadRunning.load()) {
-            isThreadRunning.store(true);
-            ffrt::submit([this] {RecordIoData();}, {}, {}, ffrt::task_attr().qos(ffrt::qos_background));
+        if (currentBundleName != appStateData.bundleName) {
+            CloseWindowLocked();
+            OpenWindowLocked(appStateData);
         }
         return;
     }
     if (appStateData.bundleName == currentBundleName && appStateData.state == TYPE_BACKGROUND) {
-        isThreadRunning.store(false);
-        sleepCv.notify_all();
-        currentData = {};
-        preData = {};
+        CloseWindowLocked();
     }
 }
 } // namespace CloudDisk
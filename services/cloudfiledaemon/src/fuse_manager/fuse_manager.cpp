@@ -15,6 +15,7 @@
 
 #include "fuse_manager/fuse_manager.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <cerrno>
@@ -24,11 +25,13 @@
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
+#include <deque>
 #include <exception>
 #include <filesystem>
 #include <fcntl.h>
 #include <iostream>
 #include <fstream>
+#include <functional>
 #include <map>
 #include <mutex>
 #include <pthread.h>
@@ -40,6 +43,7 @@
 #include <thread>
 #include <unistd.h>
 #include <sys/ioctl.h>
+#include <set>
 #include <vector>
 
 #include "cloud_daemon_statistic.h"
@@ -56,11 +60,12 @@
 #include "ffrt_inner.h"
 #include "fuse_ioctl.h"
 #include "fuse_operations.h"
+#include "fuse_inval_dispatcher.h"
+#include "fuse_io_accounting.h"
+#include "fuse_request_lane.h"
+#include "fuse_watchdog.h"
 #include "parameters.h"
 #include "setting_data_helper.h"
-#ifdef HICOLLIE_ENABLE
-#include "xcollie_helper.h"
-#endif
 #include "hitrace_meter.h"
 #include "meta_file.h"
 #include "securec.h"
@@ -78,6 +83,8 @@ static const string LOCAL_PATH_HMDFS_CLOUD_CACHE = "/hmdfs/cache/cloud_cache";
 static const string DEVICE_VIEW_PHOTOS_PATH = "/account/device_view/local/data/";
 static const string CLOUD_CACHE_DIR = "/.video_cache";
 static const string PHOTOS_KEY = "persist.kernel.bundle_name.photos";
+static const string CLOUD_DISK_IDLE_THREADS_KEY = "const.filemanagement.cloud_disk_fuse_idle_threads";
+static const string CLOUD_OPEN_WARMUP_KEY = "const.filemanagement.cloud_open_warmup";
 static const string CLOUD_CACHE_XATTR_NAME = "user.cloud.cacheMap";
 static const string CLOUD_KEEP_CACHE_XATTR_NAME = "user.cloud.keepcache";
 static const string VIDEO_TYPE_PREFIX = "VID_";
@@ -99,6 +106,8 @@ static const unsigned int MAX_READ_SIZE = 4 * 1024 * 1024;
 static const unsigned int MIN_LOG_SIZE = 4 * 1024;
 static const unsigned int KEY_FRAME_SIZE = 8192;
 static const unsigned int MAX_IDLE_THREADS = 6;
+static const int32_t CLOUD_DISK_IDLE_THREADS = 4;
+static const int32_t CLOUD_DISK_MAX_IDLE_THREADS = 16;
 static const unsigned int MAX_APPID_LEN = 256;
 static const unsigned int READ_CACHE_SLEEP = 10 * 1000;
 static const unsigned int CACHE_PAGE_NUM = 2;
@@ -106,10 +115,13 @@ static const unsigned int FUSE_BUFFER_SIZE = 512 * 1024;
 static const unsigned int CATCH_TIMEOUT_S = 4;
 static const std::chrono::seconds READ_TIMEOUT_S = 16s;
 static const std::chrono::seconds OPEN_TIMEOUT_S = 4s;
-#ifdef HICOLLIE_ENABLE
-static const unsigned int LOOKUP_TIMEOUT_S = 1;
-static const unsigned int FORGET_TIMEOUT_S = 1;
-#endif
+static const uint32_t LOOKUP_TIMEOUT_MS = 1000;
+static const uint32_t FORGET_TIMEOUT_MS = 1000;
+static const size_t WARMUP_AHEAD = 3;
+static const size_t MAX_WARMUP_DIRS = 8;
+static const size_t MAX_WARMUP_LOOKUPS = 64;
+static const size_t MAX_WARM_SESSIONS = 8;
+static const int64_t WARM_SESSION_TTL_MS = 30 * 1000;
 
 PAGE_FLAG_TYPE PG_READAHEAD = 0x00000001;
 PAGE_FLAG_TYPE PG_UPTODATE = 0x00000002;
@@ -175,6 +187,13 @@ struct CloudFdInfo {
     std::mutex modifyLock;
 };
 
+/* an open waiting for the read session of its inode, fi is copied since the request handler has returned */
+struct PendingOpen {
+    fuse_req_t req;
+    struct fuse_file_info fi;
+    shared_ptr<CloudFdInfo> cloudFdInfo;
+};
+
 struct CloudInode {
     shared_ptr<MetaBase> mBase{nullptr};
     string path;
@@ -193,6 +212,10 @@ struct CloudInode {
     /* process's read status for ioctl, true when canceled */
     std::map<pid_t, bool> readCtlMap;
     std::unique_ptr<CLOUD_CACHE_STATUS[]> cacheFileIndex{nullptr};
+    /* opens queued while one task creates the read session, replied by that task */
+    std::mutex pendingOpenLock;
+    std::vector<PendingOpen> pendingOpens;
+    bool opening{false};
     bool SetReadCacheFlag(int64_t index, PAGE_FLAG_TYPE flag)
     {
         std::shared_lock lock(sessionLock);
@@ -252,6 +275,39 @@ struct HmdfsSaveAppId {
     char appId[MAX_APPID_LEN];
 };
 
+/* children of a directory in the order they were first looked up, which follows the order they are shown */
+struct DirOpenOrder {
+    deque<fuse_ino_t> lookups;
+    fuse_ino_t lastOpen{0};
+    uint64_t lastUse{0};
+};
+
+/* a read session initialised ahead of the open predicted for its inode, for the asset it had then */
+struct WarmSession {
+    shared_ptr<CloudFile::CloudAssetReadSession> session;
+    int64_t createdMs{0};
+    string recordId;
+    uint64_t size{0};
+    uint64_t mtime{0};
+};
+
+struct SessionWarmer {
+    bool enabled{false};
+    std::mutex lock;
+    uint64_t useClock{0};
+    map<fuse_ino_t, DirOpenOrder> dirs;
+    map<fuse_ino_t, WarmSession> sessions;
+    set<fuse_ino_t> warming;
+};
+
+/* ffrt tasks that still use the session after the fuse worker that submitted them returned */
+struct SessionTasks {
+    ffrt::mutex lock;
+    ffrt::condition_variable cond;
+    uint32_t running{0};
+    bool stopped{false};
+};
+
 struct FuseData {
     int userId;
     uint64_t fileId{0};
@@ -265,6 +321,8 @@ struct FuseData {
     struct fuse_session *se;
     string photoBundleName{""};
     string activeBundle{PHOTOS_BUNDLE_NAME};
+    SessionWarmer warmer;
+    SessionTasks tasks;
 };
 
 struct FFRTParamData {
@@ -375,26 +433,24 @@ static int HandleCloudError(CloudError error, FaultOperation faultOperation, str
     return ret;
 }
 
-#ifdef HICOLLIE_ENABLE
-
-struct XcollieInput {
-    shared_ptr<CloudInode> node_;
+/* Read by the watchdog scanner while the operation runs, so it only points at what the operation never changes. */
+struct WatchdogInput {
+    const string *path_;
     FaultOperation faultOperation_;
 };
 
-static void XcollieCallback(void *xcollie)
+static void WatchdogCallback(void *input)
 {
-    auto xcollieInput = reinterpret_cast<XcollieInput *>(xcollie);
-    if (xcollieInput == nullptr) {
+    auto watchdogInput = reinterpret_cast<WatchdogInput *>(input);
+    if (watchdogInput == nullptr) {
         return;
     }
-    shared_ptr<CloudInode> inode = xcollieInput->node_;
-    if (inode == nullptr) {
+    if (watchdogInput->path_ == nullptr) {
         return;
     }
 
     FaultType faultType = FaultType::TIMEOUT;
-    switch (xcollieInput->faultOperation_) {
+    switch (watchdogInput->faultOperation_) {
         case FaultOperation::LOOKUP:
             faultType = FaultType::CLOUD_FILE_LOOKUP_TIMEOUT;
             break;
@@ -405,11 +461,10 @@ static void XcollieCallback(void *xcollie)
             break;
     }
 
-    string msg = "In XcollieCallback, path:" + GetAnonyString((inode->path).c_str());
-    CLOUD_FILE_FAULT_REPORT(CloudFileFaultInfo{PHOTOS_BUNDLE_NAME, xcollieInput->faultOperation_,
+    string msg = "In WatchdogCallback, path:" + GetAnonyString(*watchdogInput->path_);
+    CLOUD_FILE_FAULT_REPORT(CloudFileFaultInfo{PHOTOS_BUNDLE_NAME, watchdogInput->faultOperation_,
         faultType, EWOULDBLOCK, msg});
 }
-#endif
 
 static shared_ptr<CloudDatabase> GetDatabase(struct FuseData *data)
 {
@@ -516,6 +571,37 @@ static void CheckAndReport(const string &path, const string &childName, bool cre
     }
 }
 
+static void RecordLookupOrder(struct FuseData *data, fuse_ino_t parent, fuse_ino_t ino)
+{
+    auto &warmer = data->warmer;
+    if (!warmer.enabled) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(warmer.lock);
+    auto dirIt = warmer.dirs.find(parent);
+    if (dirIt == warmer.dirs.end()) {
+        if (warmer.dirs.size() >= MAX_WARMUP_DIRS) {
+            auto oldest = warmer.dirs.begin();
+            for (auto it = warmer.dirs.begin(); it != warmer.dirs.end(); it++) {
+                if (it->second.lastUse < oldest->second.lastUse) {
+                    oldest = it;
+                }
+            }
+            warmer.dirs.erase(oldest);
+        }
+        dirIt = warmer.dirs.emplace(parent, DirOpenOrder()).first;
+    }
+    auto &dir = dirIt->second;
+    dir.lastUse = ++warmer.useClock;
+    if (find(dir.lookups.begin(), dir.lookups.end(), ino) != dir.lookups.end()) {
+        return;
+    }
+    dir.lookups.push_back(ino);
+    if (dir.lookups.size() > MAX_WARMUP_LOOKUPS) {
+        dir.lookups.pop_front();
+    }
+}
+
 static int CloudDoLookupHelper(fuse_ino_t parent, const char *name, struct fuse_entry_param *e,
     FuseData *data, string& parentName)
 {
@@ -526,8 +612,13 @@ static int CloudDoLookupHelper(fuse_ino_t parent, const char *name, struct fuse_
 
     LOGD("parent: %{private}s, name: %s", GetAnonyString(parentName).c_str(), GetAnonyString(name).c_str());
 
+    auto metaFile = MetaFileMgr::GetInstance().GetRevalidatedMetaFile(data->userId, parentName);
+    if (metaFile == nullptr) {
+        LOGE("get metafile of %s failed", GetAnonyString(parentName).c_str());
+        return EINVAL;
+    }
     MetaBase mBase(name);
-    int err = MetaFile(data->userId, parentName).DoLookup(mBase);
+    int err = metaFile->DoLookup(mBase);
     if (err) {
         LOGE("lookup %s error, err: %{public}d", GetAnonyString(childName).c_str(), err);
         return err;
@@ -543,17 +634,12 @@ static int CloudDoLookupHelper(fuse_ino_t parent, const char *name, struct fuse_
     child->refCount++;
     if (create) {
         child->mBase = make_shared<MetaBase>(mBase);
-#ifdef HICOLLIE_ENABLE
-        XcollieInput xcollieInput{child, FaultOperation::LOOKUP};
-        auto xcollieId = XCollieHelper::SetTimer("CloudFileDaemon_CloudLookup", LOOKUP_TIMEOUT_S,
-            XcollieCallback, &xcollieInput, false);
-#endif
+        WatchdogInput watchdogInput{&childName, FaultOperation::LOOKUP};
+        FuseWatchdog::Guard guard("CloudFileDaemon_CloudLookup", LOOKUP_TIMEOUT_MS, WatchdogCallback,
+            &watchdogInput);
         wLock.lock();
         data->inodeCache[cloudId] = child;
         wLock.unlock();
-#ifdef HICOLLIE_ENABLE
-        XCollieHelper::CancelTimer(xcollieId);
-#endif
     } else if (*(child->mBase) != mBase) {
         LOGW("invalidate %s", GetAnonyString(childName).c_str());
         child->mBase = make_shared<MetaBase>(mBase);
@@ -565,6 +651,7 @@ static int CloudDoLookupHelper(fuse_ino_t parent, const char *name, struct fuse_
          static_cast<long long>(child->refCount));
     GetMetaAttr(data, child, &e->attr);
     e->ino = static_cast<fuse_ino_t>(cloudId);
+    RecordLookupOrder(data, parent, e->ino);
     return 0;
 }
 
@@ -586,7 +673,11 @@ static void CloudLookup(fuse_req_t req, fuse_ino_t parent,
                         const char *name)
 {
     HITRACE_METER_NAME(HITRACE_TAG_FILEMANAGEMENT, __PRETTY_FUNCTION__);
-    struct fuse_entry_param e;
+    FuseIoAccounting::GetInstance().CountStat(req->ctx.uid);
+    // short enough that an invalidation the dispatcher drops when full only delays the change
+    struct fuse_entry_param e = {};
+    e.attr_timeout = 1.0;
+    e.entry_timeout = 1.0;
     int err;
 
     err = CloudDoLookup(req, parent, name, &e);
@@ -597,42 +688,70 @@ static void CloudLookup(fuse_req_t req, fuse_ino_t parent,
     }
 }
 
-static void PutNode(struct FuseData *data, shared_ptr<CloudInode> node, uint64_t num)
+/*
+ * Erases the nodes whose last kernel reference was put under a single cacheLock round-trip. A lookup may have
+ * taken a node again since its count dropped to zero, so the count is checked once more under the lock.
+ */
+static void ReleaseNodes(struct FuseData *data, const vector<uint64_t> &inos)
 {
-    std::unique_lock<std::shared_mutex> wLock(data->cacheLock, std::defer_lock);
-    node->refCount -= num;
-    LOGD("%s, put num: %lld,  current refCount: %d",
-         GetAnonyString(node->path).c_str(), (long long)num,  node->refCount.load());
-    if (node->refCount == 0) {
+    vector<shared_ptr<CloudInode>> released;
+    {
+        string batch = "forget:" + to_string(inos.size());
+        WatchdogInput watchdogInput{&batch, FaultOperation::FORGET};
+        FuseWatchdog::Guard guard("CloudFileDaemon_CloudForget", FORGET_TIMEOUT_MS, WatchdogCallback,
+            &watchdogInput);
+        std::unique_lock<std::shared_mutex> wLock(data->cacheLock);
+        for (auto ino : inos) {
+            auto it = data->inodeCache.find(ino);
+            if (it != data->inodeCache.end() && it->second->refCount == 0) {
+                released.push_back(it->second);
+                data->inodeCache.erase(it);
+            }
+        }
+    }
+    for (auto &node : released) {
         LOGD("node released: %s", GetAnonyString(node->path).c_str());
-#ifdef HICOLLIE_ENABLE
-        XcollieInput xcollieInput{node, FaultOperation::FORGET};
-        auto xcollieId = XCollieHelper::SetTimer("CloudFileDaemon_CloudForget", FORGET_TIMEOUT_S,
-            XcollieCallback, &xcollieInput, false);
-#endif
         if (node->mBase != nullptr && (node->mBase->mode & S_IFDIR)) {
-            LOGW("PutNode directory inode, path is %{public}s", GetAnonyString(node->path).c_str());
+            LOGW("released directory inode, path is %{public}s", GetAnonyString(node->path).c_str());
         }
-        string inoKey = node->mBase->cloudId + node->mBase->name;
-        uint64_t cloudId = static_cast<uint64_t>(CloudDisk::CloudFileUtils::DentryHash(inoKey, true));
-        wLock.lock();
-        data->inodeCache.erase(cloudId);
-        wLock.unlock();
-#ifdef HICOLLIE_ENABLE
-        XCollieHelper::CancelTimer(xcollieId);
-#endif
     }
 }
 
+/* Puts kernel references under the shared cacheLock, only the nodes that drop to zero take the write lock. */
+static void PutNodes(struct FuseData *data, size_t count, const struct fuse_forget_data *forgets)
+{
+    vector<uint64_t> releases;
+    {
+        std::shared_lock<std::shared_mutex> rLock(data->cacheLock);
+        for (size_t i = 0; i < count; i++) {
+            shared_ptr<CloudInode> node;
+            if (forgets[i].ino == FUSE_ROOT_ID) {
+                node = data->rootNode;
+            } else {
+                auto it = data->inodeCache.find(static_cast<uint64_t>(forgets[i].ino));
+                node = (it == data->inodeCache.end()) ? nullptr : it->second;
+            }
+            if (node == nullptr) {
+                continue;
+            }
+            if ((node->refCount -= forgets[i].nlookup) == 0 && forgets[i].ino != FUSE_ROOT_ID) {
+                releases.push_back(static_cast<uint64_t>(forgets[i].ino));
+            }
+        }
+    }
+    if (releases.empty()) {
+        return;
+    }
+    ReleaseNodes(data, releases);
+}
+
 static void CloudForget(fuse_req_t req, fuse_ino_t ino,
                         uint64_t nlookup)
 {
     struct FuseData *data = static_cast<struct FuseData *>(fuse_req_userdata(req));
-    shared_ptr<CloudInode> node = GetCloudInode(data, ino);
-    if (node) {
-        LOGD("forget %s, nlookup: %lld", GetAnonyString(node->path).c_str(), (long long)nlookup);
-        PutNode(data, node, nlookup);
-    }
+    struct fuse_forget_data forget = {ino, nlookup};
+    LOGD("forget %lld, nlookup: %lld", (long long)ino, (long long)nlookup);
+    PutNodes(data, 1, &forget);
     fuse_reply_none(req);
 }
 
@@ -640,6 +759,7 @@ static void CloudGetAttr(fuse_req_t req, fuse_ino_t ino,
                          struct fuse_file_info *fi)
 {
     HITRACE_METER_NAME(HITRACE_TAG_FILEMANAGEMENT, __PRETTY_FUNCTION__);
+    FuseIoAccounting::GetInstance().CountStat(req->ctx.uid);
     struct stat buf;
     struct FuseData *data = static_cast<struct FuseData *>(fuse_req_userdata(req));
     (void) fi;
@@ -691,12 +811,7 @@ static string GetAssetPath(shared_ptr<CloudInode> cInode, struct FuseData *data)
 
 static void fuse_inval(fuse_session *se, fuse_ino_t parentIno, fuse_ino_t childIno, const string &childName)
 {
-    auto task = [se, parentIno, childIno, childName] {
-        if (fuse_lowlevel_notify_inval_entry(se, parentIno, childName.c_str(), childName.size())) {
-            fuse_lowlevel_notify_inval_inode(se, childIno, 0, 0);
-        }
-    };
-    ffrt::submit(task, {}, {}, ffrt::task_attr().qos(ffrt_qos_background));
+    FuseInvalDispatcher::GetInstance().InvalEntry(se, parentIno, childIno, childName);
 }
 
 static int CloudOpenOnLocal(struct FuseData *data, shared_ptr<CloudInode> cInode,
@@ -771,7 +886,7 @@ static uint64_t UTCTimeMilliSeconds()
 }
 
 static void DoSessionInit(shared_ptr<CloudInode> cInode, shared_ptr<CloudError> err, shared_ptr<bool> openFinish,
-    shared_ptr<ffrt::condition_variable> cond)
+    shared_ptr<ffrt::condition_variable> cond, bool initialized)
 {
     HITRACE_METER_NAME(HITRACE_TAG_FILEMANAGEMENT, __PRETTY_FUNCTION__);
     auto session = cInode->readSession;
@@ -785,7 +900,8 @@ static void DoSessionInit(shared_ptr<CloudInode> cInode, shared_ptr<CloudError>
         cond->notify_one();
         return;
     }
-    *err = session->InitSession();
+    // a warmed session has already been initialised
+    *err = initialized ? CloudError::CK_NO_ERROR : session->InitSession();
     if (*err == CloudError::CK_NO_ERROR) {
         if (cInode->mBase->fileType != FILE_TYPE_CONTENT) {
             session->Catch(*err, CATCH_TIMEOUT_S);
@@ -933,22 +1049,62 @@ static void LoadCacheFileIndex(shared_ptr<CloudInode> cInode, struct FuseData *d
     cInode->cacheFileIndex = std::move(mp);
 }
 
+/*
+ * Returns false once the session is drained, the caller then runs the task itself. A running task may submit
+ * more, so the session is only drained when none is left.
+ */
+static bool SubmitSessionTask(struct FuseData *data, function<void()> task, ffrt_qos_t qos = ffrt_qos_inherit)
+{
+    auto &tasks = data->tasks;
+    {
+        std::lock_guard<ffrt::mutex> lock(tasks.lock);
+        if (tasks.stopped) {
+            return false;
+        }
+        tasks.running++;
+    }
+    ffrt::submit([data, task] {
+        task();
+        auto &tasks = data->tasks;
+        std::lock_guard<ffrt::mutex> lock(tasks.lock);
+        if (--tasks.running == 0) {
+            tasks.cond.notify_all();
+        }
+    }, {}, {}, ffrt::task_attr().qos(qos));
+    return true;
+}
+
+/* called once the session loop returned, so that no task replies to or reads a destroyed session */
+static void DrainSessionTasks(struct FuseData *data)
+{
+    auto &tasks = data->tasks;
+    std::unique_lock<ffrt::mutex> lock(tasks.lock);
+    tasks.cond.wait(lock, [&tasks] {
+        return tasks.running == 0;
+    });
+    tasks.stopped = true;
+}
+
 static int DoCloudOpen(shared_ptr<CloudInode> cInode, struct fuse_file_info *fi,
-    struct FuseData *data, shared_ptr<CloudFdInfo> cloudFdInfo)
+    struct FuseData *data, shared_ptr<CloudFdInfo> cloudFdInfo, bool initialized)
 {
     auto error = make_shared<CloudError>();
     auto openFinish = make_shared<bool>(false);
     auto cond = make_shared<ffrt::condition_variable>();
 #ifndef SUPPORT_WATCH_LITE
-    ffrt::submit([cInode, error, openFinish, cond, data] {
+    // the task outlives the open when the cloud does not answer in time, and reads the session data
+    auto sessionInit = [cInode, error, openFinish, cond, data, initialized] {
         if (IsVideoType(cInode->mBase->name)) {
             LoadCacheFileIndex(cInode, data);
         }
-        DoSessionInit(cInode, error, openFinish, cond);
-    });
+        DoSessionInit(cInode, error, openFinish, cond, initialized);
+    };
+    if (!SubmitSessionTask(data, sessionInit)) {
+        sessionInit();
+    }
 #else
-    ffrt::submit([cInode, error, openFinish, cond] {
-        DoSessionInit(cInode, error, openFinish, cond);
+    ffrt::submit([cInode, error, openFinish, cond, initialized] {
+        DoSessionInit(cInode, error, openFinish, cond, initialized);
     });
 #endif
     unique_lock lck(cInode->openLock);
@@ -1060,14 +1216,285 @@ static shared_ptr<CloudFile::CloudAssetReadSession> CreateReadSession(shared_ptr
     }
 }
 
+static int64_t SteadyMilliSeconds()
+{
+    return chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void CloseWarmSessions(const vector<shared_ptr<CloudFile::CloudAssetReadSession>> &sessions)
+{
+    for (auto &session : sessions) {
+        session->CancelSession();
+        session->Close(false);
+    }
+}
+
+/* expired sessions are moved to dropped, to be closed out of the warmer lock */
+static void PruneWarmSessionsLocked(SessionWarmer &warmer, int64_t nowMs,
+    vector<shared_ptr<CloudFile::CloudAssetReadSession>> &dropped)
+{
+    for (auto it = warmer.sessions.begin(); it != warmer.sessions.end();) {
+        if (nowMs - it->second.createdMs < WARM_SESSION_TTL_MS) {
+            it++;
+            continue;
+        }
+        dropped.push_back(it->second.session);
+        it = warmer.sessions.erase(it);
+    }
+}
+
+static void StoreWarmSessionLocked(SessionWarmer &warmer, fuse_ino_t ino, WarmSession warm,
+    vector<shared_ptr<CloudFile::CloudAssetReadSession>> &dropped)
+{
+    PruneWarmSessionsLocked(warmer, warm.createdMs, dropped);
+    while (warmer.sessions.size() >= MAX_WARM_SESSIONS) {
+        auto oldest = warmer.sessions.begin();
+        for (auto it = warmer.sessions.begin(); it != warmer.sessions.end(); it++) {
+            if (it->second.createdMs < oldest->second.createdMs) {
+                oldest = it;
+            }
+        }
+        dropped.push_back(oldest->second.session);
+        warmer.sessions.erase(oldest);
+    }
+    warmer.sessions[ino] = std::move(warm);
+}
+
+/* a lookup may have replaced the asset of ino since the session was warmed, such a session is dropped */
+static shared_ptr<CloudFile::CloudAssetReadSession> TakeWarmSession(struct FuseData *data, fuse_ino_t ino,
+    const string &recordId, const MetaBase &mBase)
+{
+    auto &warmer = data->warmer;
+    if (!warmer.enabled) {
+        return nullptr;
+    }
+    shared_ptr<CloudFile::CloudAssetReadSession> session;
+    vector<shared_ptr<CloudFile::CloudAssetReadSession>> dropped;
+    {
+        std::lock_guard<std::mutex> lock(warmer.lock);
+        PruneWarmSessionsLocked(warmer, SteadyMilliSeconds(), dropped);
+        auto it = warmer.sessions.find(ino);
+        if (it != warmer.sessions.end()) {
+            auto &warm = it->second;
+            if (warm.recordId == recordId && warm.size == mBase.size && warm.mtime == mBase.mtime) {
+                session = warm.session;
+            } else {
+                LOGI("drop stale warm session, ino: %{public}llu", static_cast<unsigned long long>(ino));
+                dropped.push_back(warm.session);
+            }
+            warmer.sessions.erase(it);
+        }
+    }
+    CloseWarmSessions(dropped);
+    return session;
+}
+
+/* the children looked up next to ino, after it or before it when the opens walk the directory backwards */
+static vector<fuse_ino_t> PredictNextOpens(SessionWarmer &warmer, fuse_ino_t parent, fuse_ino_t ino)
+{
+    vector<fuse_ino_t> candidates;
+    std::lock_guard<std::mutex> lock(warmer.lock);
+    auto dirIt = warmer.dirs.find(parent);
+    if (dirIt == warmer.dirs.end()) {
+        return candidates;
+    }
+    auto &dir = dirIt->second;
+    dir.lastUse = ++warmer.useClock;
+    auto pos = find(dir.lookups.begin(), dir.lookups.end(), ino);
+    if (pos == dir.lookups.end()) {
+        return candidates;
+    }
+    size_t index = static_cast<size_t>(pos - dir.lookups.begin());
+    auto lastPos = find(dir.lookups.begin(), dir.lookups.end(), dir.lastOpen);
+    bool backward = lastPos != dir.lookups.end() && static_cast<size_t>(lastPos - dir.lookups.begin()) > index;
+    dir.lastOpen = ino;
+    for (size_t step = 1; step <= WARMUP_AHEAD; step++) {
+        if (backward ? index < step : index + step >= dir.lookups.size()) {
+            break;
+        }
+        fuse_ino_t candidate = backward ? dir.lookups[index - step] : dir.lookups[index + step];
+        if (warmer.sessions.count(candidate) != 0 || !warmer.warming.insert(candidate).second) {
+            continue;
+        }
+        candidates.push_back(candidate);
+    }
+    return candidates;
+}
+
+static void WarmReadSession(struct FuseData *data, shared_ptr<CloudInode> cInode, fuse_ino_t ino,
+    shared_ptr<CloudFile::CloudDatabase> database)
+{
+    HITRACE_METER_NAME(HITRACE_TAG_FILEMANAGEMENT, __PRETTY_FUNCTION__);
+    bool needed = false;
+    // the asset the session is warmed for, a lookup may replace mBase meanwhile
+    auto mBase = cInode->mBase;
+    {
+        // an inode being opened or already open has its own session
+        std::shared_lock<ffrt::shared_mutex> rSesLock(cInode->sessionLock, std::try_to_lock);
+        needed = rSesLock.owns_lock() && !cInode->readSession &&
+            (mBase->fileType == FILE_TYPE_CONTENT || !IsLocalFile(data, cInode));
+    }
+    WarmSession warm;
+    if (needed) {
+        warm.recordId = MetaFileMgr::GetInstance().CloudIdToRecordId(mBase->cloudId, IsHdc(data));
+        warm.size = mBase->size;
+        warm.mtime = mBase->mtime;
+        warm.session = CreateReadSession(cInode, database, warm.recordId, data);
+        if (warm.session && warm.session->InitSession() != CloudError::CK_NO_ERROR) {
+            LOGW("warm session failed, path: %{public}s", GetAnonyString(cInode->path).c_str());
+            warm.session = nullptr;
+        }
+    }
+    auto &warmer = data->warmer;
+    vector<shared_ptr<CloudFile::CloudAssetReadSession>> dropped;
+    {
+        std::lock_guard<std::mutex> lock(warmer.lock);
+        warmer.warming.erase(ino);
+        if (warm.session) {
+            warm.createdMs = SteadyMilliSeconds();
+            StoreWarmSessionLocked(warmer, ino, std::move(warm), dropped);
+        }
+    }
+    CloseWarmSessions(dropped);
+}
+
+static void WarmNextReadSessions(struct FuseData *data, fuse_ino_t parent, fuse_ino_t ino,
+    shared_ptr<CloudFile::CloudDatabase> database)
+{
+    auto &warmer = data->warmer;
+    if (!warmer.enabled) {
+        return;
+    }
+    for (auto candidate : PredictNextOpens(warmer, parent, ino)) {
+        auto cInode = FindNode(data, static_cast<uint64_t>(candidate));
+        if (!cInode || !cInode->mBase) {
+            std::lock_guard<std::mutex> lock(warmer.lock);
+            warmer.warming.erase(candidate);
+            continue;
+        }
+        auto warm = [data, cInode, candidate, database] {
+            WarmReadSession(data, cInode, candidate, database);
+        };
+        if (!SubmitSessionTask(data, warm, ffrt_qos_background)) {
+            std::lock_guard<std::mutex> lock(warmer.lock);
+            warmer.warming.erase(candidate);
+        }
+    }
+}
+
+/* the warm sessions nobody opened are closed with the session, after the warm tasks are drained */
+static void CloseAllWarmSessions(struct FuseData *data)
+{
+    auto &warmer = data->warmer;
+    vector<shared_ptr<CloudFile::CloudAssetReadSession>> dropped;
+    {
+        std::lock_guard<std::mutex> lock(warmer.lock);
+        for (auto &it : warmer.sessions) {
+            dropped.push_back(it.second.session);
+        }
+        warmer.sessions.clear();
+        warmer.dirs.clear();
+        warmer.warming.clear();
+    }
+    if (!dropped.empty()) {
+        LOGI("close %{public}zu warm sessions", dropped.size());
+    }
+    CloseWarmSessions(dropped);
+}
+
+static void ReplyOpenFailed(struct FuseData *data, shared_ptr<CloudInode> cInode, fuse_ino_t ino,
+    const vector<PendingOpen> &opens, int err)
+{
+    for (const auto &pending : opens) {
+        EraseCloudFdCache(data, pending.fi.fh);
+        fuse_reply_err(pending.req, err);
+    }
+    fuse_inval(data->se, cInode->parent, ino, cInode->mBase->name);
+}
+
+static void CloudOpenBatch(struct FuseData *data, shared_ptr<CloudInode> cInode, fuse_ino_t ino,
+    vector<PendingOpen> &opens, shared_ptr<CloudFile::CloudDatabase> database)
+{
+    std::unique_lock<ffrt::shared_mutex> wSesLock(cInode->sessionLock);
+    size_t reopenBegin = 0;
+    if (!cInode->readSession || NeedReCloudOpen(data, cInode)) {
+        /*
+         * 'recordType' is fixed to "media" now
+         * 'assetKey' is one of "content"/"lcd"/"thumbnail"
+         */
+        string recordId = MetaFileMgr::GetInstance().CloudIdToRecordId(cInode->mBase->cloudId, IsHdc(data));
+        LOGD("recordId: %s", recordId.c_str());
+        uint64_t startTime = UTCTimeMilliSeconds();
+        auto warmSession = TakeWarmSession(data, ino, recordId, *cInode->mBase);
+        if (warmSession) {
+            LOGI("reuse warm session, path: %{public}s", GetAnonyString(cInode->path).c_str());
+        }
+        cInode->readSession = warmSession ? warmSession : CreateReadSession(cInode, database, recordId, data);
+        if (!cInode->readSession) {
+            ReplyOpenFailed(data, cInode, ino, opens, EPERM);
+            CLOUD_FILE_FAULT_REPORT(CloudFileFaultInfo{PHOTOS_BUNDLE_NAME, FaultOperation::OPEN,
+                FaultType::DRIVERKIT, EPERM, "readSession is null or fix size fail"});
+            return;
+        }
+        cInode->readSession->SetPrepareTraceId(GetPrepareTraceId(data->userId, data->activeBundle));
+        auto ret = DoCloudOpen(cInode, &opens[0].fi, data, opens[0].cloudFdInfo, warmSession != nullptr);
+        UpdateReadStat(cInode, startTime, data->activeBundle);
+        if (ret != 0) {
+            cInode->readSession = nullptr;
+            ReplyOpenFailed(data, cInode, ino, opens, -ret);
+            return;
+        }
+        fuse_reply_open(opens[0].req, &opens[0].fi);
+        reopenBegin = 1;
+    }
+    // the others share the session the first one opened, as if they arrived after it
+    for (size_t i = reopenBegin; i < opens.size(); i++) {
+        HandleReopen(opens[i].req, data, cInode, &opens[i].fi, opens[i].cloudFdInfo);
+    }
+}
+
+static void CloudOpenAsync(struct FuseData *data, shared_ptr<CloudInode> cInode, fuse_ino_t ino,
+    shared_ptr<CloudFile::CloudDatabase> database)
+{
+    HITRACE_METER_NAME(HITRACE_TAG_FILEMANAGEMENT, __PRETTY_FUNCTION__);
+    while (true) {
+        vector<PendingOpen> opens;
+        {
+            std::lock_guard<std::mutex> lock(cInode->pendingOpenLock);
+            opens.swap(cInode->pendingOpens);
+            if (opens.empty()) {
+                cInode->opening = false;
+                return;
+            }
+        }
+        LOGI("open %{public}s for %{public}zu requests", GetAnonyString(cInode->path).c_str(), opens.size());
+        CloudOpenBatch(data, cInode, ino, opens, database);
+    }
+}
+
+static bool TryReopen(fuse_req_t req, struct FuseData *data, shared_ptr<CloudInode> cInode,
+    struct fuse_file_info *fi, shared_ptr<CloudFdInfo> cloudFdInfo)
+{
+    // a release only drops the session under the exclusive lock, so sharing it is enough to take a reference;
+    // the lock is not waited for, as an open task may hold it until the cloud answers
+    std::shared_lock<ffrt::shared_mutex> rSesLock(cInode->sessionLock, std::try_to_lock);
+    if (!rSesLock.owns_lock() || !cInode->readSession || NeedReCloudOpen(data, cInode)) {
+        return false;
+    }
+    HandleReopen(req, data, cInode, fi, cloudFdInfo);
+    return true;
+}
+
+/*
+ * Creating a read session waits for the cloud for up to OPEN_TIMEOUT_S, so it runs on an ffrt task that replies
+ * to the request, and the fuse worker is free for other requests meanwhile. Opens of an inode arriving while its
+ * session is being created are queued and replied by the same task.
+ */
 static void CloudOpenHelper(fuse_req_t req, fuse_ino_t ino, struct fuse_file_info *fi,
     struct FuseData *data, shared_ptr<CloudInode>& cInode, shared_ptr<CloudFdInfo> cloudFdInfo)
 {
     pid_t pid = GetPidFromTid(req->ctx.pid);
-    string recordId = MetaFileMgr::GetInstance().CloudIdToRecordId(cInode->mBase->cloudId, IsHdc(data));
     shared_ptr<CloudFile::CloudDatabase> database = GetDatabase(data);
-    std::unique_lock<ffrt::shared_mutex> wSesLock(cInode->sessionLock, std::defer_lock);
-    string prepareTraceId = GetPrepareTraceId(data->userId, data->activeBundle);
 
     LOGI("%{public}d %{public}d %{public}d open %{public}s", pid, req->ctx.pid, req->ctx.uid,
          GetAnonyString(CloudPath(data, ino)).c_str());
@@ -1078,47 +1505,38 @@ static void CloudOpenHelper(fuse_req_t req, fuse_ino_t ino, struct fuse_file_inf
         fuse_reply_err(req, EPERM);
         return;
     }
-    wSesLock.lock();
-    if (!cInode->readSession || NeedReCloudOpen(data, cInode)) {
-        /*
-         * 'recordType' is fixed to "media" now
-         * 'assetKey' is one of "content"/"lcd"/"thumbnail"
-         */
-        LOGD("recordId: %s", recordId.c_str());
-        uint64_t startTime = UTCTimeMilliSeconds();
-        cInode->readSession = CreateReadSession(cInode, database, recordId, data);
-        if (cInode->readSession) {
-            cInode->readSession->SetPrepareTraceId(prepareTraceId);
-            auto ret = DoCloudOpen(cInode, fi, data, cloudFdInfo);
-            if (ret == 0) {
-                fuse_reply_open(req, fi);
-            } else {
-                EraseCloudFdCache(data, fi->fh);
-                fuse_inval(data->se, cInode->parent, ino, cInode->mBase->name);
-                fuse_reply_err(req, -ret);
-                cInode->readSession = nullptr;
-            }
-            UpdateReadStat(cInode, startTime, data->activeBundle);
-            wSesLock.unlock();
+    WarmNextReadSessions(data, cInode->parent, ino, database);
+    {
+        std::lock_guard<std::mutex> lock(cInode->pendingOpenLock);
+        if (cInode->opening) {
+            cInode->pendingOpens.push_back({req, *fi, cloudFdInfo});
             return;
         }
     }
-    if (!cInode->readSession) {
-        EraseCloudFdCache(data, fi->fh);
-        fuse_inval(data->se, cInode->parent, ino, cInode->mBase->name);
-        fuse_reply_err(req, EPERM);
-        CLOUD_FILE_FAULT_REPORT(CloudFileFaultInfo{PHOTOS_BUNDLE_NAME, FaultOperation::OPEN,
-            FaultType::DRIVERKIT, EPERM, "readSession is null or fix size fail"});
-    } else {
-        HandleReopen(req, data, cInode, fi, cloudFdInfo);
+    if (TryReopen(req, data, cInode, fi, cloudFdInfo)) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(cInode->pendingOpenLock);
+        cInode->pendingOpens.push_back({req, *fi, cloudFdInfo});
+        if (cInode->opening) {
+            return;
+        }
+        cInode->opening = true;
+    }
+    auto openAsync = [data, cInode, ino, database] {
+        CloudOpenAsync(data, cInode, ino, database);
+    };
+    if (!SubmitSessionTask(data, openAsync)) {
+        openAsync();
     }
-    wSesLock.unlock();
 }
 
 static void CloudOpen(fuse_req_t req, fuse_ino_t ino,
                       struct fuse_file_info *fi)
 {
     HITRACE_METER_NAME(HITRACE_TAG_FILEMANAGEMENT, __PRETTY_FUNCTION__);
+    FuseIoAccounting::GetInstance().CountOpen(req->ctx.uid);
     struct FuseData *data = static_cast<struct FuseData *>(fuse_req_userdata(req));
     shared_ptr<CloudInode> cInode = GetCloudInode(data, ino);
     if (!cInode) {
@@ -1228,15 +1646,8 @@ static void CloudForgetMulti(fuse_req_t req, size_t count,
 				struct fuse_forget_data *forgets)
 {
     struct FuseData *data = static_cast<struct FuseData *>(fuse_req_userdata(req));
-    LOGD("forget_multi");
-    for (size_t i = 0; i < count; i++) {
-        shared_ptr<CloudInode> node = GetCloudInode(data, forgets[i].ino);
-        if (!node) {
-            continue;
-        }
-        LOGD("forget (i=%zu) %s, nlookup: %lld", i, GetAnonyString(node->path).c_str(), (long long)forgets[i].nlookup);
-        PutNode(data, node, forgets[i].nlookup);
-    }
+    LOGD("forget_multi, count: %zu", count);
+    PutNodes(data, count, forgets);
     fuse_reply_none(req);
 }
 
@@ -1966,6 +2377,7 @@ static void CloudRead(fuse_req_t req, fuse_ino_t ino, size_t size, off_t off,
 {
     pid_t pid = GetPidFromTid(req->ctx.pid);
     HITRACE_METER_NAME(HITRACE_TAG_FILEMANAGEMENT, __PRETTY_FUNCTION__);
+    FuseIoAccounting::GetInstance().CountRead(req->ctx.uid, size);
     shared_ptr<char> buf = nullptr;
     struct FuseData *data = static_cast<struct FuseData *>(fuse_req_userdata(req));
     shared_ptr<CloudInode> cInode = GetCloudInode(data, ino);
@@ -2031,6 +2443,7 @@ static void CloudReadForWatch(fuse_req_t req, fuse_ino_t ino, size_t size, off_t
 {
     pid_t pid = GetPidFromTid(req->ctx.pid);
     HITRACE_METER_NAME(HITRACE_TAG_FILEMANAGEMENT, __PRETTY_FUNCTION__);
+    FuseIoAccounting::GetInstance().CountRead(req->ctx.uid, size);
     shared_ptr<char> buf = nullptr;
     struct FuseData *data = static_cast<struct FuseData *>(fuse_req_userdata(req));
     shared_ptr<CloudInode> cInode = GetCloudInode(data, ino);
@@ -2154,7 +2567,8 @@ static bool CheckPathForStartFuse(const string &path)
 }
 
 static int SetNewSessionInfo(struct fuse_session *se, struct fuse_loop_config &config,
-                             int32_t devFd, const string &path, int32_t userId)
+                             int32_t devFd, const string &path, int32_t userId,
+                             const function<void()> &drainSession)
 {
     se->fd = devFd;
     se->bufsize = FUSE_BUFFER_SIZE;
@@ -2165,6 +2579,15 @@ static int SetNewSessionInfo(struct fuse_session *se, struct fuse_loop_config &c
 
     fuse_daemonize(true);
     int ret = fuse_session_loop_mt(se, &config);
+    // the session workers are joined, requests still served off them must reply before the channel is closed
+    if (drainSession) {
+        drainSession();
+    }
+    FuseInvalDispatcher::GetInstance().Discard(se);
+    auto invalStats = FuseInvalDispatcher::GetInstance().GetStats();
+    LOGI("inval requested: %{public}" PRIu64 ", issued: %{public}" PRIu64 ", coalesced: %{public}" PRIu64
+        ", overflowed: %{public}" PRIu64 ", dropped: %{public}" PRIu64, invalStats.requested, invalStats.issued,
+        invalStats.coalesced, invalStats.overflowed, invalStats.dropped);
 
     fuse_session_unmount(se);
     LOGI("fuse_session_unmount");
@@ -2192,11 +2615,12 @@ static int SetNewSessionInfo(struct fuse_session *se, struct fuse_loop_config &c
 int32_t FuseManager::StartFuse(int32_t userId, int32_t devFd, const string &path)
 {
     LOGI("FuseManager::StartFuse entry");
-    struct fuse_loop_config config;
+    struct fuse_loop_config config = {};
     struct fuse_args args = FUSE_ARGS_INIT(0, nullptr);
     struct CloudDisk::CloudDiskFuseData cloudDiskData;
     struct FuseData data;
     struct fuse_session *se = nullptr;
+    function<void()> drainSession = nullptr;
     if (!CheckPathForStartFuse(path) || fuse_opt_add_arg(&args, path.c_str())) {
         LOGE("Mount path invalid");
         return -EINVAL;
@@ -2221,7 +2645,15 @@ int32_t FuseManager::StartFuse(int32_t userId, int32_t devFd, const string &path
         }
         cloudDiskData.userId = userId;
         cloudDiskData.se = se;
-        config.max_idle_threads = 1;
+        // every worker reads its own cloned channel, cloud reads and readdirs are moved to the data lane
+        config.clone_fd = 1;
+        config.max_idle_threads = static_cast<unsigned int>(system::GetIntParameter(CLOUD_DISK_IDLE_THREADS_KEY,
+            CLOUD_DISK_IDLE_THREADS, 1, CLOUD_DISK_MAX_IDLE_THREADS));
+        cloudDiskData.dataLane = CloudDisk::FuseRequestLane::CreateDataLane();
+        cloudDiskData.dataLane->Start();
+        drainSession = [&cloudDiskData] {
+            cloudDiskData.dataLane->Stop();
+        };
         std::lock_guard<ffrt::mutex> lock(sessionMutex_);
         sessions_[path] = se;
     } else {
@@ -2233,12 +2665,17 @@ int32_t FuseManager::StartFuse(int32_t userId, int32_t devFd, const string &path
         data.userId = userId;
         data.se = se;
         data.photoBundleName = system::GetParameter(PHOTOS_KEY, "");
+        data.warmer.enabled = system::GetBoolParameter(CLOUD_OPEN_WARMUP_KEY, false);
+        drainSession = [&data] {
+            DrainSessionTasks(&data);
+            CloseAllWarmSessions(&data);
+        };
         SettingDataHelper::GetInstance().SetUserData(userId, &data);
         SettingDataHelper::GetInstance().UpdateActiveBundle(userId);
         config.max_idle_threads = MAX_IDLE_THREADS;
     }
     LOGI("fuse_session_new success, userId: %{public}d", userId);
-    return SetNewSessionInfo(se, config, devFd, path, userId);
+    return SetNewSessionInfo(se, config, devFd, path, userId, drainSession);
 }
 
 struct fuse_session* FuseManager::GetSession(std::string path)
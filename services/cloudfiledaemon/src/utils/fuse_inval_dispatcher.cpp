@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "fuse_inval_dispatcher.h"
+
+#include "ffrt_inner.h"
+#include "utils_log.h"
+
+namespace OHOS {
+namespace FileManagement {
+namespace CloudFile {
+using namespace std;
+namespace {
+    static const uint64_t INVAL_TICK_MS = 5;
+    static const size_t MAX_PENDING_INVAL = 4096;
+}
+
+FuseInvalDispatcher::FuseInvalDispatcher(uint64_t tickMs, size_t maxPending)
+    : tickMs_(tickMs), maxPending_(maxPending)
+{
+}
+
+FuseInvalDispatcher &FuseInvalDispatcher::GetInstance()
+{
+    static FuseInvalDispatcher instance(INVAL_TICK_MS, MAX_PENDING_INVAL);
+    return instance;
+}
+
+void FuseInvalDispatcher::InvalEntry(struct fuse_session *se, fuse_ino_t parent, fuse_ino_t child,
+    const string &name)
+{
+    bool startTick = false;
+    bool flushNow = false;
+    {
+        lock_guard<mutex> lock(mutex_);
+        stats_.requested++;
+        EntryKey key(se, parent, name);
+        auto iter = entries_.find(key);
+        if (iter != entries_.end()) {
+            // the latest inode the name pointed to is the one whose attributes may be stale
+            iter->second = child;
+            stats_.coalesced++;
+            return;
+        }
+        if (entries_.size() >= maxPending_) {
+            stats_.dropped++;
+            return;
+        }
+        entries_.emplace(move(key), child);
+        ScheduleLocked(startTick, flushNow);
+    }
+    Schedule(startTick, flushNow);
+}
+
+void FuseInvalDispatcher::ScheduleLocked(bool &startTick, bool &flushNow)
+{
+    if (entries_.size() >= maxPending_ && !flushQueued_) {
+        stats_.overflowed++;
+        flushQueued_ = true;
+        flushNow = true;
+        return;
+    }
+    if (!tickStarted_) {
+        tickStarted_ = true;
+        startTick = true;
+    }
+}
+
+void FuseInvalDispatcher::Schedule(bool startTick, bool flushNow)
+{
+    if (startTick && ffrt_timer_start(ffrt_qos_background, tickMs_, this, OnTick, false) < 0) {
+        LOGE("start inval timer failed");
+        flushNow = true;
+    }
+    if (flushNow) {
+        ffrt::submit([this] { Flush(); }, {}, {}, ffrt::task_attr().qos(ffrt_qos_background));
+    }
+}
+
+void FuseInvalDispatcher::OnTick(void *data)
+{
+    static_cast<FuseInvalDispatcher *>(data)->Flush();
+}
+
+void FuseInvalDispatcher::Flush()
+{
+    // the batch is taken under sendMutex_, so Discard never returns while a request of its session is in flight
+    lock_guard<mutex> sendLock(sendMutex_);
+    map<EntryKey, fuse_ino_t> entries;
+    {
+        lock_guard<mutex> lock(mutex_);
+        entries.swap(entries_);
+        tickStarted_ = false;
+        flushQueued_ = false;
+    }
+    // hard links and renames queue one inode under several names, it is invalidated once
+    set<InodeKey> inodes;
+    uint64_t issued = 0;
+    uint64_t coalesced = 0;
+    for (const auto &[key, child] : entries) {
+        const auto &[se, parent, name] = key;
+        issued++;
+        if (!fuse_lowlevel_notify_inval_entry(se, parent, name.c_str(), name.size())) {
+            continue;
+        }
+        if (!inodes.emplace(se, child).second) {
+            coalesced++;
+            continue;
+        }
+        issued++;
+        fuse_lowlevel_notify_inval_inode(se, child, 0, 0);
+    }
+    if (issued == 0) {
+        return;
+    }
+    lock_guard<mutex> lock(mutex_);
+    stats_.issued += issued;
+    stats_.coalesced += coalesced;
+}
+
+void FuseInvalDispatcher::Discard(struct fuse_session *se)
+{
+    lock_guard<mutex> sendLock(sendMutex_);
+    lock_guard<mutex> lock(mutex_);
+    auto entryBegin = entries_.lower_bound(EntryKey(se, 0, ""));
+    auto entryEnd = entryBegin;
+    while (entryEnd != entries_.end() && get<0>(entryEnd->first) == se) {
+        entryEnd++;
+    }
+    entries_.erase(entryBegin, entryEnd);
+}
+
+FuseInvalStats FuseInvalDispatcher::GetStats()
+{
+    lock_guard<mutex> lock(mutex_);
+    return stats_;
+}
+} // namespace CloudFile
+} // namespace FileManagement
+} // namespace OHOS
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "fuse_io_accounting.h"
+
+namespace OHOS {
+namespace FileManagement {
+namespace CloudFile {
+using namespace std;
+namespace {
+    static const uint64_t UID_HASH_FACTOR = 0x9E3779B97F4A7C15ULL;
+}
+
+FuseIoAccounting &FuseIoAccounting::GetInstance()
+{
+    static FuseIoAccounting instance;
+    return instance;
+}
+
+FuseIoAccounting::Slot *FuseIoAccounting::FindSlot(uid_t uid, bool claim)
+{
+    uint64_t key = static_cast<uint64_t>(uid) + 1;
+    // app uids differ in their low bits only, so they are spread before probing
+    size_t start = static_cast<size_t>((key * UID_HASH_FACTOR) >> 32);
+    for (size_t i = 0; i < MAX_PROBE; i++) {
+        Slot &slot = slots_[(start + i) % SLOT_COUNT];
+        uint64_t current = slot.key.load(memory_order_acquire);
+        if (current == key) {
+            return &slot;
+        }
+        if (current != 0) {
+            continue;
+        }
+        if (!claim) {
+            return nullptr;
+        }
+        // a slot is never released, so losing the race to the same uid still finds it here
+        if (slot.key.compare_exchange_strong(current, key, memory_order_acq_rel) || current == key) {
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+void FuseIoAccounting::CountRead(uid_t uid, uint64_t bytes)
+{
+    Slot *slot = FindSlot(uid, true);
+    if (slot == nullptr) {
+        uncounted_.fetch_add(1, memory_order_relaxed);
+        return;
+    }
+    slot->reads.fetch_add(1, memory_order_relaxed);
+    slot->readBytes.fetch_add(bytes, memory_order_relaxed);
+}
+
+void FuseIoAccounting::CountOpen(uid_t uid)
+{
+    Slot *slot = FindSlot(uid, true);
+    if (slot == nullptr) {
+        uncounted_.fetch_add(1, memory_order_relaxed);
+        return;
+    }
+    slot->opens.fetch_add(1, memory_order_relaxed);
+}
+
+void FuseIoAccounting::CountStat(uid_t uid)
+{
+    Slot *slot = FindSlot(uid, true);
+    if (slot == nullptr) {
+        uncounted_.fetch_add(1, memory_order_relaxed);
+        return;
+    }
+    slot->stats.fetch_add(1, memory_order_relaxed);
+}
+
+FuseIoCounters FuseIoAccounting::GetCounters(uid_t uid)
+{
+    FuseIoCounters counters;
+    Slot *slot = FindSlot(uid, false);
+    if (slot == nullptr) {
+        return counters;
+    }
+    counters.reads = slot->reads.load(memory_order_relaxed);
+    counters.readBytes = slot->readBytes.load(memory_order_relaxed);
+    counters.opens = slot->opens.load(memory_order_relaxed);
+    counters.stats = slot->stats.load(memory_order_relaxed);
+    return counters;
+}
+
+uint64_t FuseIoAccounting::GetUncountedCount()
+{
+    return uncounted_.load(memory_order_relaxed);
+}
+} // namespace CloudFile
+} // namespace FileManagement
+} // namespace OHOS
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "fuse_watchdog.h"
+
+#include <pthread.h>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+
+#include "utils_log.h"
+
+namespace OHOS {
+namespace FileManagement {
+namespace CloudFile {
+using namespace std;
+namespace {
+    static const chrono::milliseconds WATCHDOG_SCAN_PERIOD = 100ms;
+    static atomic<uint64_t> g_watchdogId{0};
+
+    /* slots of the calling thread, one per watchdog, retired when the thread exits */
+    struct ThreadSlots {
+        vector<pair<uint64_t, shared_ptr<FuseWatchdogSlot>>> slots;
+        ~ThreadSlots()
+        {
+            for (auto &[id, slot] : slots) {
+                slot->retired.store(true, memory_order_release);
+            }
+        }
+    };
+    thread_local ThreadSlots t_threadSlots;
+}
+
+FuseWatchdog::Guard::Guard(const char *name, uint32_t timeoutMs, FuseWatchdogCallback callback, void *arg,
+    FuseWatchdog &watchdog)
+{
+    slot_ = watchdog.Begin(name, timeoutMs, callback, arg);
+}
+
+FuseWatchdog::Guard::~Guard()
+{
+    if (slot_ != nullptr) {
+        End(slot_);
+    }
+}
+
+FuseWatchdog::FuseWatchdog(chrono::milliseconds scanPeriod) : id_(++g_watchdogId), scanPeriod_(scanPeriod)
+{
+}
+
+FuseWatchdog::~FuseWatchdog()
+{
+    unique_lock<mutex> lock(mutex_);
+    stopped_ = true;
+    scanCond_.notify_all();
+    scanCond_.wait(lock, [this] {
+        return !scannerStarted_ || scannerExited_;
+    });
+}
+
+FuseWatchdog &FuseWatchdog::GetInstance()
+{
+    // never destroyed, so that process exit does not wait for the scanner
+    static FuseWatchdog *instance = new FuseWatchdog(WATCHDOG_SCAN_PERIOD);
+    return *instance;
+}
+
+int64_t FuseWatchdog::NowMs()
+{
+    return chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+FuseWatchdogSlot *FuseWatchdog::GetThreadSlot()
+{
+    for (auto &[id, slot] : t_threadSlots.slots) {
+        if (id == id_) {
+            return slot.get();
+        }
+    }
+    auto slot = make_shared<FuseWatchdogSlot>();
+    slot->tid = gettid();
+    t_threadSlots.slots.emplace_back(id_, slot);
+    lock_guard<mutex> lock(mutex_);
+    slots_.push_back(slot);
+    if (!scannerStarted_) {
+        scannerStarted_ = true;
+        thread([this] {
+            pthread_setname_np(pthread_self(), "fuse_watchdog");
+            ScanLoop();
+        }).detach();
+    }
+    return slot.get();
+}
+
+FuseWatchdogSlot *FuseWatchdog::Begin(const char *name, uint32_t timeoutMs, FuseWatchdogCallback callback,
+    void *arg)
+{
+    // the thread keeps its own reference in t_threadSlots for as long as it runs
+    FuseWatchdogSlot *slot = GetThreadSlot();
+    uint64_t state = slot->state.load(memory_order_relaxed);
+    if ((state & PHASE_MASK) != IDLE) {
+        // nested in an operation of the same thread, which already covers it
+        return nullptr;
+    }
+    slot->name.store(name, memory_order_relaxed);
+    slot->timeoutMs.store(timeoutMs, memory_order_relaxed);
+    slot->callback.store(callback, memory_order_relaxed);
+    slot->arg.store(arg, memory_order_relaxed);
+    slot->startMs.store(NowMs(), memory_order_relaxed);
+    uint64_t generation = (state >> PHASE_BITS) + 1;
+    slot->state.store((generation << PHASE_BITS) | ACTIVE, memory_order_release);
+    return slot;
+}
+
+void FuseWatchdog::End(FuseWatchdogSlot *slot)
+{
+    uint64_t generation = slot->state.load(memory_order_relaxed) & ~PHASE_MASK;
+    uint64_t active = generation | ACTIVE;
+    if (slot->state.compare_exchange_strong(active, generation | IDLE, memory_order_acq_rel)) {
+        return;
+    }
+    // the scanner claimed this operation, its callback may still use the arg owned by the caller
+    while ((slot->state.load(memory_order_acquire) & PHASE_MASK) == REPORTING) {
+        this_thread::yield();
+    }
+    slot->state.store(generation | IDLE, memory_order_release);
+}
+
+void FuseWatchdog::ScanLoop()
+{
+    unique_lock<mutex> lock(mutex_);
+    while (!stopped_) {
+        scanCond_.wait_for(lock, scanPeriod_, [this] {
+            return stopped_;
+        });
+        if (stopped_) {
+            break;
+        }
+        lock.unlock();
+        Scan(NowMs());
+        lock.lock();
+    }
+    scannerExited_ = true;
+    scanCond_.notify_all();
+}
+
+void FuseWatchdog::Scan(int64_t nowMs)
+{
+    vector<shared_ptr<FuseWatchdogSlot>> slots;
+    {
+        lock_guard<mutex> lock(mutex_);
+        for (auto it = slots_.begin(); it != slots_.end();) {
+            if ((*it)->retired.load(memory_order_acquire)) {
+                it = slots_.erase(it);
+                continue;
+            }
+            slots.push_back(*it);
+            it++;
+        }
+    }
+    for (auto &slot : slots) {
+        uint64_t state = slot->state.load(memory_order_acquire);
+        if ((state & PHASE_MASK) != ACTIVE) {
+            continue;
+        }
+        int64_t elapsedMs = nowMs - slot->startMs.load(memory_order_relaxed);
+        if (elapsedMs < static_cast<int64_t>(slot->timeoutMs.load(memory_order_relaxed))) {
+            continue;
+        }
+        const char *name = slot->name.load(memory_order_relaxed);
+        auto callback = slot->callback.load(memory_order_relaxed);
+        void *arg = slot->arg.load(memory_order_relaxed);
+        uint64_t generation = state & ~PHASE_MASK;
+        // fails when the operation ended or was replaced since the fields were read
+        if (!slot->state.compare_exchange_strong(state, generation | REPORTING, memory_order_acq_rel)) {
+            continue;
+        }
+        overruns_++;
+        LOGE("%{public}s of thread %{public}d runs over %{public}lld ms", name, slot->tid,
+            static_cast<long long>(elapsedMs));
+        if (callback != nullptr) {
+            callback(arg);
+        }
+        slot->state.store(generation | REPORTED, memory_order_release);
+    }
+}
+
+uint64_t FuseWatchdog::GetOverrunCount()
+{
+    return overruns_.load();
+}
+} // namespace CloudFile
+} // namespace FileManagement
+} // namespace OHOS
@@ -21,6 +21,7 @@
 #include <ctime>
 #include "cloud_pref_impl.h"
 #include "cycle_task.h"
+#include "cycle_task_scheduler.h"
 
 namespace OHOS {
 namespace FileManagement {
@@ -35,12 +36,15 @@ public:
 
 private:
     void InitTasks();
+    void AddCycleTask(std::shared_ptr<CycleTask> task, CycleTaskScheduler::ResourceClass resourceClass,
+        int64_t budgetMs, const std::vector<std::string> &dependencies = {});
     void SetRunableBundleNames();
 
     int32_t userId_{0};
     std::time_t setUpTime_{0};
     std::shared_ptr<CloudFile::DataSyncManager> dataSyncManager_;
     std::vector<std::shared_ptr<CycleTask>> cycleTasks_ {};
+    std::vector<CycleTaskScheduler::TaskSpec> taskSpecs_ {};
 };
 
 } // namespace CloudSync
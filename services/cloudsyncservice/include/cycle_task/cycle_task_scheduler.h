@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_CLOUD_SYNC_SERVICE_CYCLE_TASK_SCHEDULER_H
+#define OHOS_CLOUD_SYNC_SERVICE_CYCLE_TASK_SCHEDULER_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace OHOS {
+namespace FileManagement {
+namespace CloudSync {
+
+/*
+ * Runs the cycle tasks of one window as a dependency graph.
+ *
+ * Every task declares a resource class, a priority, a time budget and the names of the tasks
+ * it has to wait for. Ready tasks are started in priority order on their own thread as long as
+ * the parallel limit and the shared I/O budget allow it, so cheap tasks are not queued behind
+ * long directory sweeps. Run() blocks until every task has finished or been skipped.
+ */
+class CycleTaskScheduler {
+public:
+    enum class ResourceClass {
+        LIGHT,
+        DATABASE,
+        IO,
+    };
+
+    enum class TaskState {
+        PENDING,
+        RUNNING,
+        FINISHED,
+        SKIPPED,
+    };
+
+    struct TaskSpec {
+        std::string name;
+        ResourceClass resourceClass{ResourceClass::LIGHT};
+        /* Smaller value is started first among ready tasks. */
+        int32_t priority{0};
+        /* Expected duration, a task running longer is reported as over budget; 0 means no budget. */
+        int64_t budgetMs{0};
+        std::vector<std::string> dependencies;
+        std::function<void()> run;
+    };
+
+    struct TaskMetric {
+        std::string name;
+        ResourceClass resourceClass{ResourceClass::LIGHT};
+        TaskState state{TaskState::PENDING};
+        int64_t startMs{0};
+        int64_t durationMs{0};
+        bool overBudget{false};
+    };
+
+    struct Options {
+        uint32_t maxParallel{DEFAULT_MAX_PARALLEL};
+        /* Sum of GetIoCost() over running tasks may not exceed this, a single task always fits. */
+        uint32_t ioBudget{DEFAULT_IO_BUDGET};
+        /* Monotonic milliseconds, steady_clock when empty. */
+        std::function<int64_t()> clock;
+    };
+
+    static constexpr uint32_t DEFAULT_MAX_PARALLEL = 3;
+    static constexpr uint32_t DEFAULT_IO_BUDGET = 2;
+
+    explicit CycleTaskScheduler(const Options &options);
+    ~CycleTaskScheduler() = default;
+    CycleTaskScheduler(const CycleTaskScheduler&) = delete;
+    CycleTaskScheduler& operator=(const CycleTaskScheduler&) = delete;
+
+    int32_t AddTask(const TaskSpec &spec);
+    void Run();
+    std::vector<TaskMetric> GetMetrics();
+    static uint32_t GetIoCost(ResourceClass resourceClass);
+
+private:
+    struct Node {
+        TaskSpec spec;
+        TaskMetric metric;
+        uint32_t waitingDeps{0};
+        std::vector<size_t> dependents;
+    };
+
+    void ResolveDependencies();
+    bool PickReadyTask(size_t &index);
+    void Dispatch(size_t index, std::vector<std::thread> &workers);
+    void FinishTask(size_t index);
+    void SkipPendingTasks();
+    int64_t Now() const;
+
+    Options options_;
+    std::vector<Node> nodes_;
+    std::mutex mutex_;
+    std::condition_variable finishCv_;
+    uint32_t running_{0};
+    uint32_t ioInUse_{0};
+};
+} // namespace CloudSync
+} // namespace FileManagement
+} // namespace OHOS
+#endif // OHOS_CLOUD_SYNC_SERVICE_CYCLE_TASK_SCHEDULER_H
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_CLOUD_SYNC_SERVICE_DIR_TREE_SCANNER_H
+#define OHOS_CLOUD_SYNC_SERVICE_DIR_TREE_SCANNER_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+
+namespace OHOS {
+namespace FileManagement {
+namespace CloudSync {
+
+/*
+ * Shared directory walker for the cycle tasks that sweep large trees (chown, space report).
+ *
+ * Entries are read with fdopendir/readdir and stat'ed with fstatat relative to the parent
+ * directory fd, so no full path is rebuilt per entry. fstatat is skipped whenever d_type is
+ * enough for the caller. The first level below the root is split into units that a bounded
+ * pool of workers consumes; units are ordered by name, which lets the caller persist a cursor
+ * and resume an interrupted scan after the last unit that finished in order.
+ */
+class DirTreeScanner {
+public:
+    enum class ScanResult {
+        COMPLETED,
+        STOPPED,
+        DEPTH_LIMIT,
+        OPEN_ROOT_FAILED,
+    };
+
+    struct Entry {
+        int32_t dirFd{-1};
+        const char *name{nullptr};
+        const std::string *parentPath{nullptr};
+        uint32_t depth{0};
+        unsigned char type{0};
+        const struct stat *st{nullptr};
+
+        std::string GetPath() const;
+        bool IsDir() const;
+        bool IsReg() const;
+    };
+
+    /* All callbacks may be invoked concurrently from different workers, workerId is in [0, workerCount). */
+    struct Callbacks {
+        /* Whether an entry of this d_type needs fstatat; DT_UNKNOWN entries are always stat'ed. */
+        std::function<bool(unsigned char type)> needStat;
+        /* Called for every entry except "." and "..", returns whether a directory entry is descended into. */
+        std::function<bool(const Entry &entry, uint32_t workerId)> onEntry;
+        std::function<void(const std::string &path, int32_t err, uint32_t workerId)> onError;
+        std::function<bool()> shouldStop;
+        /* Called with the name of the last first-level unit finished in order. */
+        std::function<void(const std::string &cursor)> onCheckpoint;
+    };
+
+    struct Options {
+        uint32_t workerCount{1};
+        uint32_t maxDepth{UINT32_MAX};
+        /* Name of the last finished first-level unit of a previous scan, units up to it are skipped. */
+        std::string cursor;
+    };
+
+    DirTreeScanner(const Options &options, const Callbacks &callbacks);
+    ~DirTreeScanner() = default;
+    DirTreeScanner(const DirTreeScanner&) = delete;
+    DirTreeScanner& operator=(const DirTreeScanner&) = delete;
+
+    ScanResult Scan(const std::string &rootPath);
+    static uint32_t GetDefaultWorkerCount();
+
+private:
+    struct Unit {
+        std::string name;
+        unsigned char type{0};
+    };
+
+    bool CollectUnits(int32_t rootFd, const std::string &rootPath);
+    void RunWorker(int32_t rootFd, const std::string &rootPath, uint32_t workerId);
+    bool VisitEntry(int32_t dirFd, const char *name, unsigned char type, const std::string &parentPath,
+        uint32_t depth, uint32_t workerId);
+    void ScanSubDir(int32_t parentFd, const char *name, const std::string &path, uint32_t depth, uint32_t workerId);
+    void FinishUnit(size_t index);
+    bool IsStopped();
+    void SetResult(ScanResult result);
+
+    Options options_;
+    Callbacks callbacks_;
+    std::vector<Unit> units_;
+    std::vector<bool> unitDone_;
+    size_t watermark_{0};
+    std::mutex unitMutex_;
+    size_t checkpointed_{0};
+    std::mutex checkpointMutex_;
+    std::atomic<size_t> nextUnit_{0};
+    std::atomic<bool> stopped_{false};
+    std::atomic<ScanResult> result_{ScanResult::COMPLETED};
+};
+} // namespace CloudSync
+} // namespace FileManagement
+} // namespace OHOS
+#endif // OHOS_CLOUD_SYNC_SERVICE_DIR_TREE_SCANNER_H
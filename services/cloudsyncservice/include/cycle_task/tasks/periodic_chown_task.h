@@ -16,6 +16,8 @@
 #ifndef OHOS_CLOUD_SYNC_SERVICE_PERIODIC_CHOWN_TASK_H
 #define OHOS_CLOUD_SYNC_SERVICE_PERIODIC_CHOWN_TASK_H
 
+#include <atomic>
+#include <mutex>
 #include <string>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -23,6 +25,7 @@
 
 #include "cloud_pref_impl.h"
 #include "cycle_task.h"
+#include "dir_tree_scanner.h"
 
 namespace OHOS {
 namespace FileManagement {
@@ -43,11 +46,17 @@ private:
     std::string GetTargetDirectory(int32_t userId, int32_t index);
     int32_t ValidateAndChownDirectory(const std::string& path);
     void ChangeUidToMedia(const std::string& path, mode_t mode, const struct stat& st);
+    void ChangeUidToMediaAt(int32_t dirFd, const char* name, mode_t mode, const struct stat& st);
+    void AddChownedFile(mode_t mode, const struct stat& st);
+    DirTreeScanner::ScanResult ScanWithCursor(const std::string& path, const std::string& cursorKey,
+        DirTreeScanner::Callbacks& callbacks);
+    bool CountAndCheckCondition(std::atomic<int32_t>& batchCount, std::atomic<bool>& conditionStop);
     bool CheckChownCondition();
     bool CheckAllDirectoriesDone();
     void InitializeDirectoryTemplates();
     std::string GenerateDoneKey(const std::string& dirPath);
     std::string GenerateTimestampKey(const std::string& dirPath);
+    std::string GenerateCursorKey(int32_t index, const std::string& suffix);
     std::string GenerateKeyWithSuffix(const std::string& dirPath, const std::string& suffix);
     bool ShouldChownFile(const struct stat& st, int64_t dirTimestamp);
     void ReportChownFilesResult(const std::string& path, int32_t result);
@@ -56,6 +65,7 @@ private:
     std::unique_ptr<CloudPrefImpl> periodicChownConfig_;
     int32_t fileCount_ = 0;
     int64_t totalSize_ = 0;
+    std::mutex countMutex_;
     static constexpr int32_t BATCH_SIZE = 100;
     std::vector<std::string> directoryTemplates_;
     std::vector<std::string> directoryKeys_;
@@ -108,6 +108,8 @@ public:
                            std::vector<std::string> &failCloudId) override;
     ErrCode BatchDentryFileInsert(const std::vector<DentryFileInfoObj> &fileInfo,
                                   std::vector<std::string> &failCloudId) override;
+    ErrCode BatchDentryFileInsertChunk(const DentryFileBatchObj &batch,
+                                       std::vector<std::string> &failCloudId) override;
     ErrCode StartDowngrade(const std::string &bundleName, const sptr<IRemoteObject> &downloadCallback) override;
     ErrCode StopDowngrade(const std::string &bundleName) override;
     ErrCode StartTransfer(const std::string &bundleName, const std::string &targetUri,
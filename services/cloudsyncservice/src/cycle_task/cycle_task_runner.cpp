@@ -57,32 +57,65 @@ CycleTaskRunner::CycleTaskRunner(std::shared_ptr<CloudFile::DataSyncManager> dat
     SetRunableBundleNames();
 }
 
+namespace {
+using ResourceClass = CycleTaskScheduler::ResourceClass;
+constexpr int64_t LIGHT_TASK_BUDGET_MS = 60 * 1000;
+constexpr int64_t DATABASE_TASK_BUDGET_MS = 5 * 60 * 1000;
+constexpr int64_t IO_TASK_BUDGET_MS = 10 * 60 * 1000;
+} // namespace
+
 void CycleTaskRunner::StartTask()
 {
 #ifdef EMULATOR
     return;
 #endif
 
-    for (const auto &task_data : cycleTasks_) {
-        task_data->RunTask(userId_);
+    CycleTaskScheduler scheduler(CycleTaskScheduler::Options{});
+    for (const auto &spec : taskSpecs_) {
+        scheduler.AddTask(spec);
     }
+    scheduler.Run();
+}
+
+void CycleTaskRunner::AddCycleTask(std::shared_ptr<CycleTask> task, ResourceClass resourceClass,
+    int64_t budgetMs, const std::vector<std::string> &dependencies)
+{
+    CycleTaskScheduler::TaskSpec spec;
+    spec.name = task->GetTaskName();
+    spec.resourceClass = resourceClass;
+    // cheap tasks first, so they are not queued behind the directory sweeps
+    spec.priority = static_cast<int32_t>(CycleTaskScheduler::GetIoCost(resourceClass));
+    spec.budgetMs = budgetMs;
+    spec.dependencies = dependencies;
+    spec.run = [task, userId = userId_]() { task->RunTask(userId); };
+    taskSpecs_.push_back(std::move(spec));
+    cycleTasks_.emplace_back(task);
 }
 
 void CycleTaskRunner::InitTasks()
 {
     // push tasks here
-    cycleTasks_.emplace_back(std::make_shared<PeriodicCleanTask>(dataSyncManager_));
-    cycleTasks_.emplace_back(std::make_shared<OptimizeCacheTask>(dataSyncManager_));
-    cycleTasks_.emplace_back(std::make_shared<OptimizeStorageTask>(dataSyncManager_));
-    cycleTasks_.emplace_back(std::make_shared<DfsSpaceReportTask>(dataSyncManager_));
-    cycleTasks_.emplace_back(std::make_shared<SaveSubscriptionTask>(dataSyncManager_));
-    cycleTasks_.emplace_back(std::make_shared<ReportStatisticsTask>(dataSyncManager_));
-    cycleTasks_.emplace_back(std::make_shared<DatabaseBackupTask>(dataSyncManager_));
-    cycleTasks_.emplace_back(std::make_shared<DatabaseSupplementTask>(dataSyncManager_));
-    cycleTasks_.emplace_back(std::make_shared<PeriodicChownTask>(dataSyncManager_));
+    AddCycleTask(std::make_shared<PeriodicCleanTask>(dataSyncManager_), ResourceClass::IO, IO_TASK_BUDGET_MS);
+    AddCycleTask(std::make_shared<OptimizeCacheTask>(dataSyncManager_), ResourceClass::IO, IO_TASK_BUDGET_MS);
+    AddCycleTask(std::make_shared<OptimizeStorageTask>(dataSyncManager_), ResourceClass::IO, IO_TASK_BUDGET_MS);
+    AddCycleTask(std::make_shared<DfsSpaceReportTask>(dataSyncManager_), ResourceClass::IO, IO_TASK_BUDGET_MS);
+    AddCycleTask(std::make_shared<SaveSubscriptionTask>(dataSyncManager_), ResourceClass::LIGHT,
+        LIGHT_TASK_BUDGET_MS);
+    AddCycleTask(std::make_shared<ReportStatisticsTask>(dataSyncManager_), ResourceClass::DATABASE,
+        DATABASE_TASK_BUDGET_MS);
+    auto backupTask = std::make_shared<DatabaseBackupTask>(dataSyncManager_);
+    AddCycleTask(backupTask, ResourceClass::DATABASE, DATABASE_TASK_BUDGET_MS);
+    AddCycleTask(std::make_shared<DatabaseSupplementTask>(dataSyncManager_), ResourceClass::DATABASE,
+        DATABASE_TASK_BUDGET_MS, {backupTask->GetTaskName()});
+    AddCycleTask(std::make_shared<PeriodicChownTask>(dataSyncManager_), ResourceClass::IO, IO_TASK_BUDGET_MS);
 
     // do periodic check task last
-    cycleTasks_.emplace_back(std::make_shared<PeriodicCheckTask>(dataSyncManager_));
+    std::vector<std::string> allTasks;
+    for (const auto &task : cycleTasks_) {
+        allTasks.push_back(task->GetTaskName());
+    }
+    AddCycleTask(std::make_shared<PeriodicCheckTask>(dataSyncManager_), ResourceClass::LIGHT, LIGHT_TASK_BUDGET_MS,
+        allTasks);
 }
 
 static int32_t GetString(const string &key, string &val, NativeRdb::ResultSet &resultSet)
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cycle_task_scheduler.h"
+
+#include <chrono>
+
+#include "dfs_error.h"
+#include "utils_log.h"
+
+namespace OHOS {
+namespace FileManagement {
+namespace CloudSync {
+using namespace std;
+
+namespace {
+constexpr uint32_t LIGHT_IO_COST = 0;
+constexpr uint32_t DATABASE_IO_COST = 1;
+constexpr uint32_t HEAVY_IO_COST = 2;
+} // namespace
+
+CycleTaskScheduler::CycleTaskScheduler(const Options &options) : options_(options)
+{
+    if (options_.maxParallel == 0) {
+        options_.maxParallel = 1;
+    }
+}
+
+uint32_t CycleTaskScheduler::GetIoCost(ResourceClass resourceClass)
+{
+    switch (resourceClass) {
+        case ResourceClass::DATABASE:
+            return DATABASE_IO_COST;
+        case ResourceClass::IO:
+            return HEAVY_IO_COST;
+        default:
+            return LIGHT_IO_COST;
+    }
+}
+
+int64_t CycleTaskScheduler::Now() const
+{
+    if (options_.clock != nullptr) {
+        return options_.clock();
+    }
+    return chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int32_t CycleTaskScheduler::AddTask(const TaskSpec &spec)
+{
+    if (spec.name.empty() || spec.run == nullptr) {
+        LOGE("invalid task spec");
+        return E_INVAL_ARG;
+    }
+    lock_guard<mutex> lock(mutex_);
+    for (const auto &node : nodes_) {
+        if (node.spec.name == spec.name) {
+            LOGE("task %{public}s already added", spec.name.c_str());
+            return E_INVAL_ARG;
+        }
+    }
+    Node node;
+    node.spec = spec;
+    node.metric.name = spec.name;
+    node.metric.resourceClass = spec.resourceClass;
+    nodes_.push_back(move(node));
+    return E_OK;
+}
+
+void CycleTaskScheduler::ResolveDependencies()
+{
+    for (size_t index = 0; index < nodes_.size(); index++) {
+        for (const auto &dependency : nodes_[index].spec.dependencies) {
+            size_t depIndex = 0;
+            while (depIndex < nodes_.size() && nodes_[depIndex].spec.name != dependency) {
+                depIndex++;
+            }
+            if (depIndex == nodes_.size() || depIndex == index) {
+                LOGW("task %{public}s ignores dependency %{public}s", nodes_[index].spec.name.c_str(),
+                    dependency.c_str());
+                continue;
+            }
+            nodes_[depIndex].dependents.push_back(index);
+            nodes_[index].waitingDeps++;
+        }
+    }
+}
+
+bool CycleTaskScheduler::PickReadyTask(size_t &index)
+{
+    if (running_ >= options_.maxParallel) {
+        return false;
+    }
+    bool found = false;
+    for (size_t i = 0; i < nodes_.size(); i++) {
+        const Node &node = nodes_[i];
+        if (node.metric.state != TaskState::PENDING || node.waitingDeps != 0) {
+            continue;
+        }
+        uint32_t cost = GetIoCost(node.spec.resourceClass);
+        if (ioInUse_ != 0 && ioInUse_ + cost > options_.ioBudget) {
+            continue;
+        }
+        if (!found || node.spec.priority < nodes_[index].spec.priority) {
+            index = i;
+            found = true;
+        }
+    }
+    return found;
+}
+
+void CycleTaskScheduler::Dispatch(size_t index, vector<thread> &workers)
+{
+    Node &node = nodes_[index];
+    node.metric.state = TaskState::RUNNING;
+    node.metric.startMs = Now();
+    running_++;
+    ioInUse_ += GetIoCost(node.spec.resourceClass);
+    LOGI("start task %{public}s, running:%{public}u, io in use:%{public}u", node.spec.name.c_str(), running_,
+        ioInUse_);
+    workers.emplace_back([this, index, run = node.spec.run]() {
+        run();
+        FinishTask(index);
+    });
+}
+
+void CycleTaskScheduler::FinishTask(size_t index)
+{
+    lock_guard<mutex> lock(mutex_);
+    Node &node = nodes_[index];
+    node.metric.state = TaskState::FINISHED;
+    node.metric.durationMs = Now() - node.metric.startMs;
+    node.metric.overBudget = node.spec.budgetMs > 0 && node.metric.durationMs > node.spec.budgetMs;
+    running_--;
+    ioInUse_ -= GetIoCost(node.spec.resourceClass);
+    for (size_t dependent : node.dependents) {
+        nodes_[dependent].waitingDeps--;
+    }
+    if (node.metric.overBudget) {
+        LOGW("task %{public}s cost %{public}lld ms, over budget %{public}lld ms", node.spec.name.c_str(),
+            static_cast<long long>(node.metric.durationMs), static_cast<long long>(node.spec.budgetMs));
+    } else {
+        LOGI("task %{public}s cost %{public}lld ms", node.spec.name.c_str(),
+            static_cast<long long>(node.metric.durationMs));
+    }
+    finishCv_.notify_all();
+}
+
+void CycleTaskScheduler::SkipPendingTasks()
+{
+    for (auto &node : nodes_) {
+        if (node.metric.state == TaskState::PENDING) {
+            LOGE("task %{public}s skipped, dependencies can not be satisfied", node.spec.name.c_str());
+            node.metric.state = TaskState::SKIPPED;
+        }
+    }
+}
+
+void CycleTaskScheduler::Run()
+{
+    vector<thread> workers;
+    unique_lock<mutex> lock(mutex_);
+    ResolveDependencies();
+    while (true) {
+        size_t index = 0;
+        while (PickReadyTask(index)) {
+            Dispatch(index, workers);
+        }
+        if (running_ == 0) {
+            break;
+        }
+        finishCv_.wait(lock);
+    }
+    SkipPendingTasks();
+    lock.unlock();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
+vector<CycleTaskScheduler::TaskMetric> CycleTaskScheduler::GetMetrics()
+{
+    lock_guard<mutex> lock(mutex_);
+    vector<TaskMetric> metrics;
+    metrics.reserve(nodes_.size());
+    for (const auto &node : nodes_) {
+        metrics.push_back(node.metric);
+    }
+    return metrics;
+}
+} // namespace CloudSync
+} // namespace FileManagement
+} // namespace OHOS
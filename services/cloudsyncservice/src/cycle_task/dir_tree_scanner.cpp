@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dir_tree_scanner.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <thread>
+#include <unistd.h>
+
+#include "utils_log.h"
+
+namespace OHOS {
+namespace FileManagement {
+namespace CloudSync {
+using namespace std;
+
+namespace {
+constexpr uint32_t MAX_WORKER_COUNT = 4;
+constexpr int32_t DIR_OPEN_FLAGS = O_RDONLY | O_DIRECTORY | O_CLOEXEC;
+
+bool IsDotDir(const char *name)
+{
+    return name != nullptr && (strcmp(name, ".") == 0 || strcmp(name, "..") == 0);
+}
+
+string JoinPath(const string &parent, const char *name)
+{
+    if (parent.empty() || parent.back() == '/') {
+        return parent + name;
+    }
+    return parent + "/" + name;
+}
+} // namespace
+
+string DirTreeScanner::Entry::GetPath() const
+{
+    if (parentPath == nullptr || name == nullptr) {
+        return "";
+    }
+    return JoinPath(*parentPath, name);
+}
+
+bool DirTreeScanner::Entry::IsDir() const
+{
+    return type == DT_DIR;
+}
+
+bool DirTreeScanner::Entry::IsReg() const
+{
+    return type == DT_REG;
+}
+
+DirTreeScanner::DirTreeScanner(const Options &options, const Callbacks &callbacks)
+    : options_(options), callbacks_(callbacks)
+{
+    if (options_.workerCount == 0) {
+        options_.workerCount = 1;
+    }
+}
+
+uint32_t DirTreeScanner::GetDefaultWorkerCount()
+{
+    uint32_t cpuCount = thread::hardware_concurrency();
+    return std::clamp<uint32_t>(cpuCount / 2, 1, MAX_WORKER_COUNT);
+}
+
+void DirTreeScanner::SetResult(ScanResult result)
+{
+    ScanResult expected = ScanResult::COMPLETED;
+    result_.compare_exchange_strong(expected, result);
+    stopped_.store(true);
+}
+
+bool DirTreeScanner::IsStopped()
+{
+    if (stopped_.load(memory_order_relaxed)) {
+        return true;
+    }
+    if (callbacks_.shouldStop != nullptr && callbacks_.shouldStop()) {
+        SetResult(ScanResult::STOPPED);
+        return true;
+    }
+    return false;
+}
+
+DirTreeScanner::ScanResult DirTreeScanner::Scan(const string &rootPath)
+{
+    if (IsStopped()) {
+        return result_.load();
+    }
+    int32_t rootFd = openat(AT_FDCWD, rootPath.c_str(), DIR_OPEN_FLAGS);
+    if (rootFd < 0) {
+        int32_t err = errno;
+        LOGE("open root failed, path:%{public}s, errno:%{public}d", GetAnonyStringStrictly(rootPath).c_str(), err);
+        if (callbacks_.onError != nullptr) {
+            callbacks_.onError(rootPath, err, 0);
+        }
+        return ScanResult::OPEN_ROOT_FAILED;
+    }
+    if (!CollectUnits(rootFd, rootPath)) {
+        close(rootFd);
+        return result_.load();
+    }
+
+    uint32_t workerCount = static_cast<uint32_t>(min<size_t>(options_.workerCount, units_.size()));
+    vector<thread> workers;
+    for (uint32_t workerId = 1; workerId < workerCount; workerId++) {
+        workers.emplace_back([this, rootFd, &rootPath, workerId]() { RunWorker(rootFd, rootPath, workerId); });
+    }
+    RunWorker(rootFd, rootPath, 0);
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    close(rootFd);
+    return result_.load();
+}
+
+bool DirTreeScanner::CollectUnits(int32_t rootFd, const string &rootPath)
+{
+    int32_t fd = dup(rootFd);
+    if (fd < 0) {
+        LOGE("dup root fd failed, errno:%{public}d", errno);
+        if (callbacks_.onError != nullptr) {
+            callbacks_.onError(rootPath, errno, 0);
+        }
+        return false;
+    }
+    DIR *dir = fdopendir(fd);
+    if (dir == nullptr) {
+        int32_t err = errno;
+        close(fd);
+        LOGE("fdopendir root failed, path:%{public}s, errno:%{public}d",
+            GetAnonyStringStrictly(rootPath).c_str(), err);
+        if (callbacks_.onError != nullptr) {
+            callbacks_.onError(rootPath, err, 0);
+        }
+        return false;
+    }
+    struct dirent *entry = nullptr;
+    for (errno = 0; (entry = readdir(dir)) != nullptr; errno = 0) {
+        if (IsDotDir(entry->d_name)) {
+            continue;
+        }
+        if (IsStopped()) {
+            break;
+        }
+        if (!options_.cursor.empty() && options_.cursor.compare(entry->d_name) >= 0) {
+            continue;
+        }
+        units_.push_back({entry->d_name, entry->d_type});
+    }
+    if (!stopped_.load() && errno != 0) {
+        LOGE("readdir root failed, path:%{public}s, errno:%{public}d", GetAnonyStringStrictly(rootPath).c_str(), errno);
+        if (callbacks_.onError != nullptr) {
+            callbacks_.onError(rootPath, errno, 0);
+        }
+    }
+    closedir(dir);
+    if (stopped_.load()) {
+        return false;
+    }
+    sort(units_.begin(), units_.end(), [](const Unit &lhs, const Unit &rhs) { return lhs.name < rhs.name; });
+    unitDone_.assign(units_.size(), false);
+    watermark_ = 0;
+    checkpointed_ = 0;
+    nextUnit_.store(0);
+    return true;
+}
+
+void DirTreeScanner::RunWorker(int32_t rootFd, const string &rootPath, uint32_t workerId)
+{
+    while (true) {
+        size_t index = nextUnit_.fetch_add(1);
+        if (index >= units_.size() || IsStopped()) {
+            return;
+        }
+        const Unit &unit = units_[index];
+        // a unit the stop cut short, even from onEntry, is not finished and is scanned again on resume
+        if (!VisitEntry(rootFd, unit.name.c_str(), unit.type, rootPath, 1, workerId)) {
+            return;
+        }
+        FinishUnit(index);
+    }
+}
+
+bool DirTreeScanner::VisitEntry(int32_t dirFd, const char *name, unsigned char type, const string &parentPath,
+    uint32_t depth, uint32_t workerId)
+{
+    if (IsStopped()) {
+        return false;
+    }
+    struct stat st {};
+    Entry entry;
+    entry.dirFd = dirFd;
+    entry.name = name;
+    entry.parentPath = &parentPath;
+    entry.depth = depth;
+    entry.type = type;
+    bool needStat = type == DT_UNKNOWN || callbacks_.needStat == nullptr || callbacks_.needStat(type);
+    if (needStat) {
+        if (fstatat(dirFd, name, &st, AT_SYMLINK_NOFOLLOW) != 0) {
+            int32_t err = errno;
+            string path = JoinPath(parentPath, name);
+            LOGE("fstatat failed, path:%{public}s, errno:%{public}d", GetAnonyStringStrictly(path).c_str(), err);
+            if (callbacks_.onError != nullptr) {
+                callbacks_.onError(path, err, workerId);
+            }
+            return true;
+        }
+        entry.type = IFTODT(st.st_mode);
+        entry.st = &st;
+    }
+    bool descend = callbacks_.onEntry == nullptr || callbacks_.onEntry(entry, workerId);
+    if (descend && entry.IsDir()) {
+        ScanSubDir(dirFd, name, JoinPath(parentPath, name), depth, workerId);
+    }
+    return !IsStopped();
+}
+
+void DirTreeScanner::ScanSubDir(int32_t parentFd, const char *name, const string &path, uint32_t depth,
+    uint32_t workerId)
+{
+    if (depth > options_.maxDepth) {
+        LOGE("exceeds deep limit, path:%{public}s", GetAnonyStringStrictly(path).c_str());
+        SetResult(ScanResult::DEPTH_LIMIT);
+        return;
+    }
+    if (IsStopped()) {
+        return;
+    }
+    int32_t fd = openat(parentFd, name, DIR_OPEN_FLAGS | O_NOFOLLOW);
+    if (fd < 0) {
+        int32_t err = errno;
+        LOGE("openat failed, path:%{public}s, errno:%{public}d", GetAnonyStringStrictly(path).c_str(), err);
+        if (callbacks_.onError != nullptr) {
+            callbacks_.onError(path, err, workerId);
+        }
+        return;
+    }
+    DIR *dir = fdopendir(fd);
+    if (dir == nullptr) {
+        int32_t err = errno;
+        close(fd);
+        LOGE("fdopendir failed, path:%{public}s, errno:%{public}d", GetAnonyStringStrictly(path).c_str(), err);
+        if (callbacks_.onError != nullptr) {
+            callbacks_.onError(path, err, workerId);
+        }
+        return;
+    }
+    struct dirent *entry = nullptr;
+    for (errno = 0; (entry = readdir(dir)) != nullptr; errno = 0) {
+        if (IsDotDir(entry->d_name)) {
+            continue;
+        }
+        if (!VisitEntry(dirfd(dir), entry->d_name, entry->d_type, path, depth + 1, workerId)) {
+            break;
+        }
+    }
+    if (!stopped_.load() && errno != 0) {
+        int32_t err = errno;
+        LOGE("readdir failed, path:%{public}s, errno:%{public}d", GetAnonyStringStrictly(path).c_str(), err);
+        if (callbacks_.onError != nullptr) {
+            callbacks_.onError(path, err, workerId);
+        }
+    }
+    closedir(dir);
+}
+
+void DirTreeScanner::FinishUnit(size_t index)
+{
+    size_t watermark = 0;
+    {
+        lock_guard<mutex> lock(unitMutex_);
+        unitDone_[index] = true;
+        size_t oldWatermark = watermark_;
+        while (watermark_ < unitDone_.size() && unitDone_[watermark_]) {
+            watermark_++;
+        }
+        if (watermark_ == oldWatermark || callbacks_.onCheckpoint == nullptr) {
+            return;
+        }
+        watermark = watermark_;
+    }
+    // persisted out of unitMutex_ so that the other workers keep finishing units, a stale cursor is skipped
+    lock_guard<mutex> lock(checkpointMutex_);
+    if (watermark <= checkpointed_) {
+        return;
+    }
+    checkpointed_ = watermark;
+    callbacks_.onCheckpoint(units_[watermark - 1].name);
+}
+} // namespace CloudSync
+} // namespace FileManagement
+} // namespace OHOS
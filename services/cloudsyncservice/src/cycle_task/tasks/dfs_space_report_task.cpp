@@ -15,13 +15,14 @@
 
 #include "dfs_space_report_task.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cerrno>
 #include <cstdint>
-#include <cstring>
 #include <dirent.h>
 #include <iomanip>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
@@ -31,8 +32,10 @@
 #include "cloud_file_fault_event.h"
 #include "battery_status.h"
 #include "data_sync_const.h"
+#include "device_status_snapshot.h"
 #include "dfsu_timer.h"
 #include "dfs_error.h"
+#include "dir_tree_scanner.h"
 #include "screen_status.h"
 #include "system_load.h"
 #include "task_state_manager.h"
@@ -159,11 +162,6 @@ struct ReportStats {
     ScanStopReason stopped{ScanStopReason::NOT_STOPPED};
 };
 
-static bool IsDotDir(const char *name)
-{
-    return name != nullptr && (strcmp(name, ".") == 0 || strcmp(name, "..") == 0);
-}
-
 static void AddUint64(uint64_t &value, uint64_t addValue)
 {
     if (UINT64_MAX - value < addValue) {
@@ -227,12 +225,19 @@ static bool IsDfsSpaceReportConditionSatisfied()
         SystemLoadStatus::IsSystemLoadAllowed(STOPPED_IN_OTHER, PowerMgr::ThermalLevel::NORMAL);
 }
 
+// Per-entry variant of IsDfsSpaceReportConditionSatisfied, reads the listener-maintained status word only.
+static bool IsDfsSpaceReportSnapshotSatisfied()
+{
+    return DeviceStatusSnapshot::IsIdleCharging(MIN_BATTERY_CAPACITY,
+        static_cast<int32_t>(PowerMgr::ThermalLevel::NORMAL));
+}
+
 static ScanStopReason GetScanStopReason(const atomic_bool &stopScan)
 {
     if (ShouldStopScan(stopScan)) {
         return ScanStopReason::TIMEOUT;
     }
-    if (!IsDfsSpaceReportConditionSatisfied()) {
+    if (!IsDfsSpaceReportSnapshotSatisfied()) {
         return ScanStopReason::CONDITION_CHANGED;
     }
     return ScanStopReason::NOT_STOPPED;
@@ -278,64 +283,75 @@ static void AddBadBucket(const char *bucketName, MediaWrongUidStat &uidStat)
     uidStat.badBuckets += bucketIdStr;
 }
 
-static string JoinPath(const string &parent, const char *name)
+static void MergeWorkerStat(const DfsDirStat &workerStat, DfsDirStat &stat)
 {
-    if (parent.empty() || parent.back() == '/') {
-        return parent + name;
-    }
-    return parent + "/" + name;
+    AddUint64(stat.fileBlocksBytes, workerStat.fileBlocksBytes);
+    AddUint64(stat.dirBlocksBytes, workerStat.dirBlocksBytes);
+    stat.errors += workerStat.errors;
 }
 
-template<typename Stat>
-static void ScanDfsUidTree(const string &rootPath, Stat &stat, const atomic_bool &stopScan, uint32_t depth = 0)
+static void MergeWorkerStat(const MediaWrongUidStat &workerStat, MediaWrongUidStat &stat)
 {
-    ScanStopReason stopReason = GetScanStopReason(stopScan);
-    if (IsScanStopped(stopReason)) {
-        stat.stopped = stopReason;
-        return;
-    }
-    if (depth > MAX_SCAN_DEPTH) {
-        stat.stopped = ScanStopReason::DEPTH_LIMIT;
-        LOGE("exceeds deep limit, path:%{public}s", GetAnonyStringStrictly(rootPath).c_str());
-        return;
-    }
+    AddUint64(stat.blocksBytes, workerStat.blocksBytes);
+    stat.errors += workerStat.errors;
+}
 
-    DIR *dir = opendir(rootPath.c_str());
-    if (dir == nullptr) {
-        stat.errors++;
-        LOGE("opendir failed, path:%{public}s, errno:%{public}d", GetAnonyStringStrictly(rootPath).c_str(), errno);
-        return;
+static bool NeedScanStat(unsigned char type)
+{
+    // Only regular files and directories carry dfs blocks, other types are skipped without fstatat.
+    return type == DT_REG || type == DT_DIR;
+}
+
+static void ApplyScanResult(DirTreeScanner::ScanResult result, const atomic<ScanStopReason> &stopReason,
+    ScanStopReason &stopped)
+{
+    if (result == DirTreeScanner::ScanResult::DEPTH_LIMIT) {
+        stopped = ScanStopReason::DEPTH_LIMIT;
+    } else if (result == DirTreeScanner::ScanResult::STOPPED) {
+        stopped = stopReason.load();
     }
-    struct dirent *entry = nullptr;
-    for (errno = 0; (entry = readdir(dir)) != nullptr; errno = 0) {
-        if (IsDotDir(entry->d_name)) {
-            continue;
-        }
-        stopReason = GetScanStopReason(stopScan);
-        if (IsScanStopped(stopReason)) {
-            stat.stopped = stopReason;
-            break;
-        }
-        string childPath = JoinPath(rootPath, entry->d_name);
-        struct stat childStat {};
-        if (lstat(childPath.c_str(), &childStat) != 0) {
-            stat.errors++;
-            LOGE("lstat failed, path:%{public}s, err:%{public}d", GetAnonyStringStrictly(childPath).c_str(), errno);
-            continue;
+}
+
+static DirTreeScanner::Callbacks BuildScanCallbacks(const atomic_bool &stopScan, atomic<ScanStopReason> &stopReason)
+{
+    DirTreeScanner::Callbacks callbacks;
+    callbacks.needStat = NeedScanStat;
+    callbacks.shouldStop = [&stopScan, &stopReason]() {
+        ScanStopReason reason = GetScanStopReason(stopScan);
+        if (!IsScanStopped(reason)) {
+            return false;
         }
-        AddDfsUidBlocks(childStat, stat);
-        if (S_ISDIR(childStat.st_mode)) {
-            ScanDfsUidTree(childPath, stat, stopScan, depth + 1);
-            if (IsScanStopped(stat.stopped)) {
-                break;
-            }
+        ScanStopReason expected = ScanStopReason::NOT_STOPPED;
+        stopReason.compare_exchange_strong(expected, reason);
+        return true;
+    };
+    return callbacks;
+}
+
+template<typename Stat>
+static void ScanDfsUidTree(const string &rootPath, Stat &stat, const atomic_bool &stopScan)
+{
+    DirTreeScanner::Options options;
+    options.workerCount = DirTreeScanner::GetDefaultWorkerCount();
+    options.maxDepth = MAX_SCAN_DEPTH;
+    vector<Stat> workerStats(options.workerCount);
+    atomic<ScanStopReason> stopReason {ScanStopReason::NOT_STOPPED};
+    DirTreeScanner::Callbacks callbacks = BuildScanCallbacks(stopScan, stopReason);
+    callbacks.onEntry = [&workerStats](const DirTreeScanner::Entry &entry, uint32_t workerId) {
+        if (entry.st != nullptr) {
+            AddDfsUidBlocks(*entry.st, workerStats[workerId]);
         }
+        return true;
+    };
+    callbacks.onError = [&workerStats](const string &, int32_t, uint32_t workerId) {
+        workerStats[workerId].errors++;
+    };
+    DirTreeScanner scanner(options, callbacks);
+    DirTreeScanner::ScanResult result = scanner.Scan(rootPath);
+    for (const auto &workerStat : workerStats) {
+        MergeWorkerStat(workerStat, stat);
     }
-    if (!IsScanStopped(stat.stopped) && errno != 0) {
-        stat.errors++;
-        LOGE("readdir, path:%{public}s, err:%{public}d", GetAnonyStringStrictly(rootPath).c_str(), errno);
-    }
-    closedir(dir);
+    ApplyScanResult(result, stopReason, stat.stopped);
 }
 
 static DfsDirStat ScanDir(const string &rootPath, const atomic_bool &stopScan)
@@ -345,52 +361,58 @@ static DfsDirStat ScanDir(const string &rootPath, const atomic_bool &stopScan)
     return dirStat;
 }
 
+static bool CompareBucketName(const string &lhs, const string &rhs)
+{
+    if (lhs.size() != rhs.size()) {
+        return lhs.size() < rhs.size();
+    }
+    return lhs < rhs;
+}
+
 static MediaWrongUidStat ScanMediaWrongUidDirs(const string &parentPath, const atomic_bool &stopScan)
 {
     MediaWrongUidStat uidStat;
-    DIR *dir = opendir(parentPath.c_str());
-    if (dir == nullptr) {
-        uidStat.errors++;
-        LOGE("opendir media parent failed, path:%{public}s, errno:%{public}d",
-            GetAnonyStringStrictly(parentPath).c_str(), errno);
-        return uidStat;
-    }
-    struct dirent *entry = nullptr;
-    for (errno = 0; (entry = readdir(dir)) != nullptr; errno = 0) {
-        if (IsDotDir(entry->d_name)) {
-            continue;
-        }
-        ScanStopReason stopReason = GetScanStopReason(stopScan);
-        if (IsScanStopped(stopReason)) {
-            uidStat.stopped = stopReason;
-            break;
-        }
-        string childPath = JoinPath(parentPath, entry->d_name);
-        struct stat childStat {};
-        if (lstat(childPath.c_str(), &childStat) != 0) {
-            uidStat.errors++;
-            LOGE("lstat media entry failed, path:%{public}s, errno:%{public}d",
-                GetAnonyStringStrictly(childPath).c_str(), errno);
-            continue;
+    DirTreeScanner::Options options;
+    options.workerCount = DirTreeScanner::GetDefaultWorkerCount();
+    // Buckets sit at depth 1 below the media parent, the depth limit applies inside each bucket.
+    options.maxDepth = MAX_SCAN_DEPTH + 1;
+    vector<MediaWrongUidStat> workerStats(options.workerCount);
+    vector<string> badBuckets;
+    mutex bucketMutex;
+    atomic<ScanStopReason> stopReason {ScanStopReason::NOT_STOPPED};
+    DirTreeScanner::Callbacks callbacks = BuildScanCallbacks(stopScan, stopReason);
+    callbacks.onEntry = [&workerStats, &badBuckets, &bucketMutex](const DirTreeScanner::Entry &entry,
+        uint32_t workerId) {
+        if (entry.depth > 1) {
+            if (entry.st != nullptr) {
+                AddDfsUidBlocks(*entry.st, workerStats[workerId]);
+            }
+            return true;
         }
         // Only buckets owned by the dfs uid are the real anomaly (dfs service leaking into media
         // storage); descend into them and only them, ignoring root/system/other-uid directories.
-        if (!S_ISDIR(childStat.st_mode) || childStat.st_uid != DFS_UID) {
-            continue;
-        }
-        uidStat.badFirstLevelDirs++;
-        AddBadBucket(entry->d_name, uidStat);
-        ScanDfsUidTree(childPath, uidStat, stopScan);
-        if (IsScanStopped(uidStat.stopped)) {
-            break;
+        if (entry.st == nullptr || !S_ISDIR(entry.st->st_mode) || entry.st->st_uid != DFS_UID) {
+            return false;
         }
+        workerStats[workerId].badFirstLevelDirs++;
+        lock_guard<mutex> lock(bucketMutex);
+        badBuckets.emplace_back(entry.name);
+        return true;
+    };
+    callbacks.onError = [&workerStats](const string &, int32_t, uint32_t workerId) {
+        workerStats[workerId].errors++;
+    };
+    DirTreeScanner scanner(options, callbacks);
+    DirTreeScanner::ScanResult result = scanner.Scan(parentPath);
+    for (const auto &workerStat : workerStats) {
+        MergeWorkerStat(workerStat, uidStat);
+        uidStat.badFirstLevelDirs += workerStat.badFirstLevelDirs;
     }
-    if (!IsScanStopped(uidStat.stopped) && errno != 0) {
-        uidStat.errors++;
-        LOGE("readdir media parent failed, path:%{public}s, errno:%{public}d",
-            GetAnonyStringStrictly(parentPath).c_str(), errno);
+    sort(badBuckets.begin(), badBuckets.end(), CompareBucketName);
+    for (const auto &bucket : badBuckets) {
+        AddBadBucket(bucket.c_str(), uidStat);
     }
-    closedir(dir);
+    ApplyScanResult(result, stopReason, uidStat.stopped);
     return uidStat;
 }
 
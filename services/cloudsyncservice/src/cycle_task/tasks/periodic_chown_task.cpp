@@ -20,6 +20,7 @@
 #include <cinttypes>
 #include <cstring>
 #include <dirent.h>
+#include <fcntl.h>
 #include <filesystem>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -153,6 +154,36 @@ int32_t PeriodicChownTask::ChownAllDirectories(int32_t userId)
     return E_OK;
 }
 
+DirTreeScanner::ScanResult PeriodicChownTask::ScanWithCursor(const std::string& path, const std::string& cursorKey,
+    DirTreeScanner::Callbacks& callbacks)
+{
+    DirTreeScanner::Options options;
+    options.workerCount = DirTreeScanner::GetDefaultWorkerCount();
+    if (!cursorKey.empty()) {
+        periodicChownConfig_->GetString(cursorKey, options.cursor);
+        callbacks.onCheckpoint = [this, cursorKey](const std::string& cursor) {
+            periodicChownConfig_->SetString(cursorKey, cursor);
+        };
+    }
+    if (!options.cursor.empty()) {
+        LOGI("resume scan of %{public}s after cursor", GetAnonyStringStrictly(path).c_str());
+    }
+    DirTreeScanner scanner(options, callbacks);
+    DirTreeScanner::ScanResult result = scanner.Scan(path);
+    if (result == DirTreeScanner::ScanResult::COMPLETED && !cursorKey.empty()) {
+        periodicChownConfig_->Delete(cursorKey);
+    }
+    return result;
+}
+
+bool PeriodicChownTask::CountAndCheckCondition(std::atomic<int32_t>& batchCount, std::atomic<bool>& conditionStop)
+{
+    if ((batchCount.fetch_add(1) + 1) % BATCH_SIZE == 0 && !CheckChownCondition()) {
+        conditionStop.store(true);
+    }
+    return !conditionStop.load();
+}
+
 int32_t PeriodicChownTask::ChownFiles(const std::string& path, int32_t index)
 {
     LOGI("Start chown files in directory: %{public}s", GetAnonyStringStrictly(path).c_str());
@@ -166,48 +197,49 @@ int32_t PeriodicChownTask::ChownFiles(const std::string& path, int32_t index)
         return E_PATH;
     }
     periodicChownConfig_->GetLong(timestampKey, dirTimestamp);
-    std::error_code ec;
-    int32_t batchCount = 0;
-    
-    auto it = filesystem::recursive_directory_iterator(
-        path, filesystem::directory_options::skip_permission_denied, ec);
-    if (ec) {
-        LOGE("failed to create iterator, ec=%{public}d", ec.value());
-        return E_PATH;
-    }
-    auto end = filesystem::recursive_directory_iterator();
-    for (; it != end; it.increment(ec)) {
-        if (ec) {
-            LOGW("iterator error, ec=%{public}d", ec.value());
-            ec.clear();
-            continue;
-        }
-        
-        std::string filePath = it->path().string();
-        struct stat st{};
-        if (stat(filePath.c_str(), &st) != 0) {
-            LOGE("stat failed for file: %{public}s, errno: %{public}d",
-                GetAnonyStringStrictly(filePath).c_str(), errno);
-            continue;
-        }
-        
-        if (!ShouldChownFile(st, dirTimestamp)) {
-            continue;
+
+    std::atomic<int32_t> batchCount{0};
+    std::atomic<bool> conditionStop{false};
+    DirTreeScanner::Callbacks callbacks;
+    // Directories are descended by d_type alone, only regular files need their owner and mtime.
+    callbacks.needStat = [](unsigned char type) { return type == DT_REG; };
+    callbacks.shouldStop = [&conditionStop]() { return conditionStop.load(std::memory_order_relaxed); };
+    callbacks.onEntry = [this, dirTimestamp, &batchCount, &conditionStop](const DirTreeScanner::Entry& entry,
+        uint32_t) {
+        if (entry.st == nullptr || !ShouldChownFile(*entry.st, dirTimestamp)) {
+            return true;
         }
-        if (batchCount >= (BATCH_SIZE - 1) && !CheckChownCondition()) {
-            LOGI("CheckChownCondition failed, stop processing files");
-            ReportChownFilesResult(path, E_STOP);
-            return E_STOP;
+        if (!CountAndCheckCondition(batchCount, conditionStop)) {
+            return false;
         }
-        
-        ChangeUidToMedia(filePath, MODE_REG, st);
-        batchCount = (batchCount + 1) % BATCH_SIZE;
+        ChangeUidToMediaAt(entry.dirFd, entry.name, MODE_REG, *entry.st);
+        return true;
+    };
+    DirTreeScanner::ScanResult result = ScanWithCursor(path, GenerateCursorKey(index, "_file_cursor"),
+        callbacks);
+    if (result == DirTreeScanner::ScanResult::OPEN_ROOT_FAILED) {
+        return E_PATH;
     }
-    
+    if (result == DirTreeScanner::ScanResult::STOPPED) {
+        LOGI("CheckChownCondition failed, stop processing files");
+        ReportChownFilesResult(path, E_STOP);
+        return E_STOP;
+    }
+
     ReportChownFilesResult(path, E_OK);
     return E_OK;
 }
 
+void PeriodicChownTask::AddChownedFile(mode_t mode, const struct stat& st)
+{
+    if (mode != MODE_REG) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(countMutex_);
+    fileCount_++;
+    totalSize_ += st.st_size;
+}
+
 void PeriodicChownTask::ChangeUidToMedia(const std::string& path, mode_t mode, const struct stat& st)
 {
     if ((st.st_mode & MODE_MASK) != mode) {
@@ -221,10 +253,23 @@ void PeriodicChownTask::ChangeUidToMedia(const std::string& path, mode_t mode, c
         LOGE("ChangeUidToMedia chown failed, err err is %{public}d", errno);
     }
 
-    if (mode == MODE_REG) {
-        fileCount_++;
-        totalSize_ += st.st_size;
+    AddChownedFile(mode, st);
+}
+
+void PeriodicChownTask::ChangeUidToMediaAt(int32_t dirFd, const char* name, mode_t mode, const struct stat& st)
+{
+    if ((st.st_mode & MODE_MASK) != mode) {
+        if (fchmodat(dirFd, name, mode, 0) != 0) {
+            LOGE("ChangeUidToMediaAt chmod failed, err err is %{public}d", errno);
+            return;
+        }
     }
+
+    if (fchownat(dirFd, name, MEDIA_UID, static_cast<gid_t>(-1), AT_SYMLINK_NOFOLLOW) != 0) {
+        LOGE("ChangeUidToMediaAt chown failed, err err is %{public}d", errno);
+    }
+
+    AddChownedFile(mode, st);
 }
 
 std::string PeriodicChownTask::GetTargetDirectory(int32_t userId, int32_t index)
@@ -276,38 +321,30 @@ int32_t PeriodicChownTask::ProcessSingleDirectory(const std::string& path, int32
         return ret;
     }
 
-    std::error_code ec;
-    int32_t batchCount = 0;
-    auto it = filesystem::recursive_directory_iterator(
-        path, filesystem::directory_options::skip_permission_denied, ec);
-    if (ec) {
-        LOGE("failed to create iterator, ec=%{public}d", ec.value());
-        return E_PATH;
-    }
-    auto end = filesystem::recursive_directory_iterator();
-    for (; it != end; it.increment(ec)) {
-        if (ec) {
-            LOGW("iterator error, ec=%{public}d", ec.value());
-            ec.clear();
-            continue;
+    std::atomic<int32_t> batchCount{0};
+    std::atomic<bool> conditionStop{false};
+    DirTreeScanner::Callbacks callbacks;
+    // Only directories are chowned in this pass, files are skipped by d_type without fstatat.
+    callbacks.needStat = [](unsigned char type) { return type == DT_DIR; };
+    callbacks.shouldStop = [&conditionStop]() { return conditionStop.load(std::memory_order_relaxed); };
+    callbacks.onEntry = [this, &batchCount, &conditionStop](const DirTreeScanner::Entry& entry, uint32_t) {
+        if (entry.st == nullptr || !S_ISDIR(entry.st->st_mode) || entry.st->st_uid != DFS_UID) {
+            return true;
         }
-        
-        std::string entryPath = it->path().string();
-        struct stat st{};
-        if (stat(entryPath.c_str(), &st) != 0) {
-            LOGE("stat failed for directory: %{public}s, errno: %{public}d",
-                GetAnonyStringStrictly(entryPath).c_str(), errno);
-            continue;
-        }
-        
-        if (S_ISDIR(st.st_mode) && st.st_uid == DFS_UID) {
-            if (batchCount >= (BATCH_SIZE - 1) && !CheckChownCondition()) {
-                LOGI("CheckChownCondition failed, stop processing directories");
-                return E_STOP;
-            }
-            ChangeUidToMedia(entryPath, MODE_DIR, st);
-            batchCount = (batchCount + 1) % BATCH_SIZE;
+        if (!CountAndCheckCondition(batchCount, conditionStop)) {
+            return false;
         }
+        ChangeUidToMediaAt(entry.dirFd, entry.name, MODE_DIR, *entry.st);
+        return true;
+    };
+    DirTreeScanner::ScanResult result = ScanWithCursor(path, GenerateCursorKey(index, "_dir_cursor"),
+        callbacks);
+    if (result == DirTreeScanner::ScanResult::OPEN_ROOT_FAILED) {
+        return E_PATH;
+    }
+    if (result == DirTreeScanner::ScanResult::STOPPED) {
+        LOGI("CheckChownCondition failed, stop processing directories");
+        return E_STOP;
     }
     
     LOGI("Chown directory completed: %{public}s", GetAnonyStringStrictly(path).c_str());
@@ -358,6 +395,14 @@ std::string PeriodicChownTask::GenerateTimestampKey(const std::string& dirPath)
     return GenerateKeyWithSuffix(dirPath, "_timestamp");
 }
 
+std::string PeriodicChownTask::GenerateCursorKey(int32_t index, const std::string& suffix)
+{
+    if (index < 0 || index >= static_cast<int32_t>(directoryTemplates_.size())) {
+        return "";
+    }
+    return GenerateKeyWithSuffix(directoryTemplates_[index], suffix);
+}
+
 std::string PeriodicChownTask::GenerateKeyWithSuffix(const std::string& dirPath, const std::string& suffix)
 {
     std::string path = dirPath;
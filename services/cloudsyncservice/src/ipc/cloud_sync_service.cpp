@@ -17,6 +17,7 @@
 #include <cstdint>
 #include <memory>
 #include <sys/xattr.h>
+#include <thread>
 #include <unistd.h>
 
 #include "accesstoken_kit.h"
@@ -62,6 +63,8 @@ using namespace CloudFile;
 constexpr int32_t MIN_USER_ID = 100;
 constexpr int LOAD_SA_TIMEOUT_MS = 4000;
 constexpr int MAX_PATH_SIZE = 20;
+constexpr size_t PARALLEL_XATTR_THRESHOLD = 4;
+constexpr int MAX_XATTR_WORKERS = 3;
 constexpr int QOS_LEVEL_RT = 7;
 constexpr mode_t DEFAULT_UMASK = 0002;
 const std::string CLOUDFILESERVICE_BUNDLENAME = "cloudfileservice";
@@ -743,6 +746,17 @@ int32_t CloudSyncService::BatchDentryFileInsert(const std::vector<DentryFileInfo
     return ret;
 }
 
+int32_t CloudSyncService::BatchDentryFileInsertChunk(const DentryFileBatchObj &batch,
+                                                     std::vector<std::string> &failCloudId)
+{
+    LOGI("Begin BatchDentryFileInsertChunk, count: %{public}zu", batch.fileInfo.size());
+    RETURN_ON_ERR(CheckPermissions(PERM_CLOUD_SYNC, true));
+
+    int32_t ret = dataSyncManager_->BatchDentryFileInsert(batch.fileInfo, failCloudId);
+    LOGI("End BatchDentryFileInsertChunk");
+    return ret;
+}
+
 int32_t CloudSyncService::CleanCacheInner(const std::string &uri)
 {
     LOGI("Begin CleanCacheInner");
@@ -1535,10 +1549,9 @@ int32_t CloudSyncService::IsFinishPull(bool &finishFlag)
     return dataSyncManager_->IsFinishPull(userId, bundleName, finishFlag);
 }
 
-static std::vector<uint8_t> GetXattrValue(const std::string &path, const std::string &name)
+static std::vector<uint8_t> GetXattrValue(const std::string &path, const std::string &name, int32_t callerUserId)
 {
     // realpath
-    auto callerUserId = DfsuAccessTokenHelper::GetUserId();
     const string mediaPrefix = "/storage/media/local/";
     const string hmfsPrefix = "/data/service/el2/" + to_string(callerUserId) + "/hmdfs/account/";
 
@@ -1583,18 +1596,35 @@ int32_t CloudSyncService::GetAclXattrBatch(const bool isAccess, const std::vecto
         return E_INVAL_ARG;
     }
     std::string aclXattr = isAccess ? ACL_XATTR_ACCESS : ACL_XATTR_DEFAULT;
-    for (const auto &path : filePaths) {
-        XattrResult res;
-        res.isSuccess = false;
-
-        auto value = GetXattrValue(path, aclXattr);
+    // resolved once for the batch instead of once per path
+    auto callerUserId = DfsuAccessTokenHelper::GetUserId();
+    std::vector<XattrResult> results(filePaths.size());
+    auto readXattr = [&](size_t index) {
+        results[index].isSuccess = false;
+        auto value = GetXattrValue(filePaths[index], aclXattr, callerUserId);
         if (!value.empty()) {
-            res.isSuccess = true;
-            res.xattrValue = std::move(value);
+            results[index].isSuccess = true;
+            results[index].xattrValue = std::move(value);
+        }
+    };
+    if (filePaths.size() < PARALLEL_XATTR_THRESHOLD) {
+        for (size_t index = 0; index < filePaths.size(); index++) {
+            readXattr(index);
+        }
+    } else {
+        // a small fixed pool, the reads are short and a wide fan-out only contends on the same inodes
+        ffrt::queue xattrQueue(ffrt::queue_concurrent, "acl_xattr_read_queue",
+                               ffrt::queue_attr().max_concurrency(MAX_XATTR_WORKERS));
+        std::vector<ffrt::task_handle> handles;
+        for (size_t index = 0; index < filePaths.size(); index++) {
+            handles.push_back(xattrQueue.submit_h([&readXattr, index]() { readXattr(index); }));
+        }
+        for (auto &handle : handles) {
+            xattrQueue.wait(handle);
         }
-
-        aclXattrResults.push_back(std::move(res));
     }
+    aclXattrResults.insert(aclXattrResults.end(), std::make_move_iterator(results.begin()),
+        std::make_move_iterator(results.end()));
 
     return E_OK;
 }
@@ -15,10 +15,16 @@
 
 #ifndef FILEMANAGEMENT_DFS_HI_AUDIT_H
 #define FILEMANAGEMENT_DFS_HI_AUDIT_H
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdio>
+#include <memory>
 #include <mutex>
-#include <sstream>
+#include <string>
 #include <sys/stat.h>
+#include <thread>
+#include <vector>
 
 #include "nocopyable.h"
 
@@ -38,39 +44,95 @@ struct AuditLog {
                "operationStatus, operationCount, extend\n";
     }
 
+    void AppendTo(std::string &out) const
+    {
+        out.append(cause).append(", ").append(isUserBehavior ? "1" : "0").append(", ").append(operationType)
+            .append(", ").append(operationScenario).append(", ").append(operationStatus).append(", ")
+            .append(std::to_string(operationCount)).append(", ").append(extend);
+    }
+
+    // the length AppendTo adds, six ", " separators and the one char isUserBehavior flag are fixed
+    size_t Length() const
+    {
+        constexpr size_t fixedLength = 13;
+        return cause.size() + operationType.size() + operationScenario.size() + operationStatus.size() +
+            std::to_string(operationCount).size() + extend.size() + fixedLength;
+    }
+
     const std::string ToString() const
     {
-        std::ostringstream oss;
-        oss << cause << ", " << std::to_string(isUserBehavior) << ", " << operationType << ", " << operationScenario <<
-            ", " << operationStatus << ", " << std::to_string(operationCount) << ", " << extend;
-        return oss.str();
+        std::string str;
+        AppendTo(str);
+        return str;
     }
 };
 
+/*
+ * Bounded multi producer, single consumer queue of formatted audit records. Push never blocks, it fails
+ * when the ring is full. Only the writer thread pops.
+ */
+class AuditRecordRing : public NoCopyable {
+public:
+    explicit AuditRecordRing(size_t capacity);
+    bool TryPush(std::string &&record);
+    bool TryPop(std::string &record);
+
+private:
+    struct Slot {
+        std::atomic<size_t> seq {0};
+        std::string record;
+    };
+
+    size_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+    std::atomic<size_t> head_ {0};
+    size_t tail_ = 0;
+};
+
 class HiAudit : public NoCopyable {
 public:
     static HiAudit& GetInstance();
     void Write(const AuditLog& auditLog);
     void WriteStart(const std::string &funcName);
     void WriteEnd(const std::string &funcName, int32_t ret);
+    // blocks until every record queued before the call is written, or the timeout passes, called on SA stop
+    void Flush();
 
 private:
     HiAudit();
     ~HiAudit();
 
     void Init();
+    void WriterLoop();
+    void DrainRecords();
+    void AppendRecord(const std::string &record);
+    void FlushBuffer();
     void GetWriteFilePath();
     void WriteToFile(const std::string& log);
     uint64_t GetMilliseconds();
     std::string GetFormattedTimestamp(time_t timeStamp, const std::string& format);
     std::string GetFormattedTimestampEndWithMilli();
     void CleanOldAuditFile();
-    void ZipAuditLog();
+    std::string RenameAuditLog();
+    void ZipArchivedLog(const std::string &archiveName);
 
 private:
+    // guards the file and the write buffer, only the writer thread takes it on the hot path
     std::mutex mutex_;
+    std::condition_variable writerCv_;
+    std::condition_variable flushedCv_;
     int writeFd_ = -1; // -1: init fd
     std::atomic<uint32_t> writeLogSize_ = 0;
+    std::string writeBuffer_;
+    std::vector<std::string> pendingArchives_;
+    AuditRecordRing ring_;
+    std::atomic<uint64_t> enqueuedCount_ = 0;
+    std::atomic<uint64_t> droppedCount_ = 0;
+    std::atomic<bool> flushRequested_ = false;
+    uint64_t flushedCount_ = 0;
+    uint64_t reportedDropCount_ = 0;
+    bool stop_ = false;
+    std::thread writer_;
 };
 } // namespace OHOS
 #endif // FILEMANAGEMENT_DFS_HI_AUDIT_H
\ No newline at end of file
@@ -37,6 +37,7 @@ private:
     using ExecuteFunc = void (DaemonExecute::*)(const AppExecFwk::InnerEvent::Pointer &event);
     void ExecutePushAsset(const AppExecFwk::InnerEvent::Pointer &event);
     void PushAssetInner(int32_t userId, const sptr<AssetObj> &assetObj);
+    void PushAssetStream(int32_t socketId, const std::vector<std::string> &fileList, const sptr<AssetObj> &assetObj);
     void ExecuteRequestSendFile(const AppExecFwk::InnerEvent::Pointer &event);
     int32_t RequestSendFileInner(const std::string &srcUri,
                                  const std::string &dstPath,
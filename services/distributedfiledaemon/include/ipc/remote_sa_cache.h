@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FILEMANAGEMENT_DFS_SERVICE_REMOTE_SA_CACHE_H
+#define FILEMANAGEMENT_DFS_SERVICE_REMOTE_SA_CACHE_H
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "i_daemon.h"
+#include "iremote_object.h"
+#include "refbase.h"
+
+namespace OHOS {
+namespace Storage {
+namespace DistributedFile {
+/*
+ * Keeps the daemon proxy of every peer we copied from, so repeated copies skip the samgr lookup.
+ * An entry lives until the remote object dies or the device goes offline.
+ */
+class RemoteSaCache {
+public:
+    using Loader = std::function<sptr<IDaemon>(const std::string &networkId)>;
+
+    static RemoteSaCache &GetInstance();
+
+    sptr<IDaemon> GetOrLoad(const std::string &networkId, const Loader &loader);
+    void Invalidate(const std::string &networkId);
+    void Clear();
+    size_t Size();
+
+private:
+    class RemoteSaDeathRecipient : public IRemoteObject::DeathRecipient {
+    public:
+        explicit RemoteSaDeathRecipient(const std::string &networkId) : networkId_(networkId) {}
+        ~RemoteSaDeathRecipient() = default;
+        void OnRemoteDied(const wptr<IRemoteObject> &remote) override;
+
+    private:
+        std::string networkId_;
+    };
+
+    struct Entry {
+        sptr<IDaemon> daemon;
+        sptr<IRemoteObject> object;
+        sptr<RemoteSaDeathRecipient> recipient;
+    };
+
+    RemoteSaCache() = default;
+    ~RemoteSaCache() = default;
+    void OnRemoteDied(const std::string &networkId, const sptr<IRemoteObject> &diedObject);
+    static void ReleaseEntry(Entry &entry);
+
+    std::mutex cacheMutex_;
+    std::map<std::string, Entry> cache_;
+};
+} // namespace DistributedFile
+} // namespace Storage
+} // namespace OHOS
+#endif // FILEMANAGEMENT_DFS_SERVICE_REMOTE_SA_CACHE_H
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef FILEMANAGEMENT_DFS_SERVICE_URI_BATCH_RESOLVER_H
+#define FILEMANAGEMENT_DFS_SERVICE_URI_BATCH_RESOLVER_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace OHOS {
+namespace Storage {
+namespace DistributedFile {
+/*
+ * Validates and resolves large uri lists on a few worker threads. Results keep the input order and
+ * the reported failure is always the one with the lowest index, as a serial loop would have found it.
+ */
+class UriBatchResolver {
+public:
+    enum class UriState : int32_t {
+        VALID = 0,
+        BUNDLE_MISMATCH,
+        RESOLVE_FAILED,
+        INVALID_PATH,
+        IS_FOLDER,
+    };
+
+    struct FileListResult {
+        UriState state{UriState::VALID};
+        size_t failedIndex{0};
+        int32_t resolveRet{0};
+        std::vector<std::string> physicalPaths;
+    };
+
+    /* Returns the lowest index rejected by isValid, or count when every index passes. */
+    static size_t FindFirstInvalid(size_t count, const std::function<bool(size_t index)> &isValid);
+
+    /*
+     * Resolves app file uris of one bundle. Uris sharing a parent directory under the same authority
+     * resolve the sandbox prefix once, media and docs uris are always resolved one by one.
+     */
+    static void ResolveFileList(const std::vector<std::string> &uris, int32_t userId,
+        const std::string &srcBundleName, FileListResult &result);
+};
+} // namespace DistributedFile
+} // namespace Storage
+} // namespace OHOS
+#endif // FILEMANAGEMENT_DFS_SERVICE_URI_BATCH_RESOLVER_H
@@ -24,6 +24,7 @@
 #include <thread>
 #include <unistd.h>
 #include <unordered_set>
+#include <vector>
 
 #include "dfs_radar.h"
 #include "radar_report.h"
@@ -107,7 +108,15 @@ private:
     }
 
     void PollRun();
+    /*
+     * Blocks on notifyFd until it reports one of events, then drains every pending notify. The loop only
+     * wakes up for kernel notifies or WakeUpPollThread, tests feed it a pipe in place of the hmdfs node.
+     */
+    void NotifyLoop(int notifyFd, short events);
+    void WakeUpPollThread();
     void HandleAllNotify(int fd);
+    bool ReadNotifyBatch(int fd, std::vector<NotifyParam> &pending);
+    static void CoalesceNotify(std::vector<NotifyParam> &pending);
     void NotifyHandler(NotifyParam &param);
     uint8_t GetSecurityMode();
 
@@ -116,6 +125,8 @@ private:
     std::atomic<bool> isRunning_ {true};
     std::mutex pollThreadMutex_;
     std::unique_ptr<std::thread> pollThread_ {nullptr};
+    std::mutex wakeFdMutex_;
+    int wakeFd_ {-1};
     std::function<void(NotifyParam &)> GetSessionCallback_ {nullptr};
     std::function<void(const std::string &cid)> CloseSessionCallback_ {nullptr};
 };
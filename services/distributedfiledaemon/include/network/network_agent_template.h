@@ -19,6 +19,7 @@
 #include <list>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <vector>
 #include <string_view>
 
@@ -28,6 +29,7 @@
 #include "dfsu_thread.h"
 #include "mountpoint/mount_point.h"
 #include "network/kernel_talker.h"
+#include "network/reconnect_scheduler.h"
 #include "network/session_pool.h"
 #include "network/softbus/softbus_session_dispatcher.h"
 #include "nlohmann/json.hpp"
@@ -50,7 +52,8 @@ public:
               mountPoint,
               [&](NotifyParam &param) { GetSessionProcess(param); },
               [&](const std::string &cid) { CloseSessionForOneDevice(cid); })),
-          sessionPool_(kernerlTalker_)
+          sessionPool_(kernerlTalker_),
+          reconnectScheduler_([this](const std::string &cid, uint32_t attempt) { ReconnectLater(cid, attempt); })
     {
     }
     virtual ~NetworkAgentTemplate() {}
@@ -81,7 +84,12 @@ private:
     void NotifyHandler(NotifyParam &param);
     void GetSessionProcess(NotifyParam &param);
     void GetSession(const std::string &cid);
-    
+    void ReconnectLater(const std::string &cid, uint32_t attempt);
+    void ReconnectInner(std::string cid, uint32_t attempt);
+    void ConnectDeviceByP2PInner(std::string cid, uint32_t attempt);
+    void CancelReconnect(const std::string &cid);
+    void GiveUpReconnect(const std::string &cid);
+
     void CloseSessionForOneDeviceInner(std::string cid);
     void GetSessionProcessInner(NotifyParam param);
 
@@ -89,6 +97,10 @@ private:
     std::list<Utils::DfsuThread> tasks_;
     std::shared_ptr<KernelTalker> kernerlTalker_;
     SessionPool sessionPool_;
+    std::mutex reconnectMutex_;
+    // cids whose pending reconnect comes from an hmdfs get session notify, the rest are p2p online connects
+    std::set<std::string> sessionReconnects_;
+    ReconnectScheduler reconnectScheduler_;
 };
 } // namespace DistributedFile
 } // namespace Storage
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RECONNECT_SCHEDULER_H
+#define RECONNECT_SCHEDULER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace Storage {
+namespace DistributedFile {
+struct BackoffPolicy {
+    uint32_t maxAttempts {5};
+    std::chrono::milliseconds baseDelay {250};
+    std::chrono::milliseconds maxDelay {2000};
+    // each delay is spread uniformly over [delay * (1 - ratio), delay * (1 + ratio)]
+    uint32_t jitterPercent {20};
+};
+
+/*
+ * Runs reconnect attempts of a peer on a timer thread with exponential backoff and jitter. Attempt 0 is
+ * due at once, attempt n waits about baseDelay * 2^(n - 1). One attempt is pending per cid at most, a new
+ * schedule replaces the old one. Callbacks run on the timer thread and should only hand work off.
+ */
+class ReconnectScheduler final : protected NoCopyable {
+public:
+    using Callback = std::function<void(const std::string &cid, uint32_t attempt)>;
+
+    explicit ReconnectScheduler(Callback callback, BackoffPolicy policy = {});
+    ~ReconnectScheduler();
+
+    /* Returns false once attempt reaches policy.maxAttempts, the caller should give up then. */
+    bool Schedule(const std::string &cid, uint32_t attempt);
+    void Cancel(const std::string &cid);
+    void CancelAll();
+    std::chrono::milliseconds GetBackoffDelay(uint32_t attempt);
+
+private:
+    struct Pending {
+        uint32_t attempt {0};
+        std::chrono::steady_clock::time_point due;
+    };
+
+    void TimerLoop();
+
+    Callback callback_;
+    BackoffPolicy policy_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::map<std::string, Pending> pending_;
+    std::mt19937 random_;
+    bool running_ {false};
+    std::thread timer_;
+};
+} // namespace DistributedFile
+} // namespace Storage
+} // namespace OHOS
+#endif // RECONNECT_SCHEDULER_H
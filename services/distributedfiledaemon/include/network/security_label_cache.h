@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SECURITY_LABEL_CACHE_H
+#define SECURITY_LABEL_CACHE_H
+
+#include <list>
+#include <mutex>
+#include <sys/stat.h>
+#include <unordered_map>
+
+namespace OHOS {
+namespace Storage {
+namespace DistributedFile {
+/*
+ * Remembers the security label of a file by device and inode. An entry is only trusted while the ctime
+ * of the file is unchanged, setting the label xattr always moves it. Files changed within the last
+ * second are never stored, the ctime clock is too coarse to tell a later relabel apart.
+ */
+class SecurityLabelCache final {
+public:
+    static SecurityLabelCache &GetInstance();
+
+    bool Lookup(const struct stat &st, int32_t &label);
+    void Store(const struct stat &st, int32_t label);
+    void Clear();
+    size_t Size();
+
+private:
+    static constexpr size_t MAX_ENTRIES = 16384;
+
+    struct InodeKey {
+        dev_t dev;
+        ino_t ino;
+        bool operator==(const InodeKey &other) const
+        {
+            return dev == other.dev && ino == other.ino;
+        }
+    };
+    struct InodeKeyHash {
+        size_t operator()(const InodeKey &key) const
+        {
+            return std::hash<uint64_t>()(static_cast<uint64_t>(key.ino)) ^
+                (std::hash<uint64_t>()(static_cast<uint64_t>(key.dev)) << 1);
+        }
+    };
+    struct Entry {
+        struct timespec ctime;
+        int32_t label;
+        std::list<InodeKey>::iterator lruIter;
+    };
+
+    SecurityLabelCache() = default;
+
+    std::mutex mutex_;
+    std::list<InodeKey> lru_;
+    std::unordered_map<InodeKey, Entry, InodeKeyHash> entries_;
+};
+} // namespace DistributedFile
+} // namespace Storage
+} // namespace OHOS
+#endif // SECURITY_LABEL_CACHE_H
@@ -21,6 +21,8 @@
 #include <mutex>
 #include <set>
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 #include "network/base_session.h"
 #include "network/kernel_talker.h"
@@ -40,11 +42,24 @@ public:
     void SinkOffline(const std::string &cid);
     bool FindSocketId(int32_t socketId);
 private:
+    using SessionIter = std::list<std::shared_ptr<BaseSession>>::iterator;
+    template<typename Key>
+    using SessionIndex = std::unordered_map<Key, std::vector<SessionIter>>;
+
     std::recursive_mutex sessionPoolLock_;
     std::list<std::shared_ptr<BaseSession>> usrSpaceSessionPool_;
+    /*
+     * Secondary indexes over usrSpaceSessionPool_, each bucket in pool order. Every insert and erase goes
+     * through AddSessionToPool and EraseSessionFromPool so they never drift from the list.
+     */
+    SessionIndex<int32_t> fdIndex_;
+    SessionIndex<int32_t> socketIdIndex_;
+    SessionIndex<std::string> cidIndex_;
     std::shared_ptr<KernelTalker> &talker_;
 
     void AddSessionToPool(std::shared_ptr<BaseSession> session);
+    void EraseSessionFromPool(SessionIter iter);
+    std::shared_ptr<BaseSession> FindSessionByFd(const int32_t fd);
     bool FindCid(const std::string &cid);
 };
 } // namespace DistributedFile
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FILEMANAGEMENT_DFS_SERVICE_ASSET_MOVE_PLANNER_H
+#define FILEMANAGEMENT_DFS_SERVICE_ASSET_MOVE_PLANNER_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace Storage {
+namespace DistributedFile {
+struct AssetMoveStats {
+    uint32_t openCount = 0;
+    uint32_t mkdirCount = 0;
+    uint32_t renameCount = 0;
+};
+
+/*
+ * Moves received asset files to their final place. The moves are grouped by target directory, every
+ * directory is opened or created once with mkdirat relative to its parent fd and the files are moved with
+ * renameat between the cached directory fds. Execute stops at the first failure like the old per file loop.
+ */
+class AssetMovePlanner final : public NoCopyable {
+public:
+    AssetMovePlanner() = default;
+    ~AssetMovePlanner();
+
+    bool AddMove(const std::string &srcPath, const std::string &dstPath);
+    bool Execute(mode_t dirMode);
+    const AssetMoveStats &GetStats() const
+    {
+        return stats_;
+    }
+
+private:
+    struct Move {
+        std::string srcDir;
+        std::string srcName;
+        std::string dstDir;
+        std::string dstName;
+    };
+
+    static bool SplitPath(const std::string &path, std::string &dir, std::string &name);
+    int OpenDir(const std::string &dir, bool create, mode_t dirMode);
+    void CloseDirs();
+
+    std::vector<Move> moves_;
+    std::map<std::string, int> dirFds_;
+    AssetMoveStats stats_;
+};
+} // namespace DistributedFile
+} // namespace Storage
+} // namespace OHOS
+#endif // FILEMANAGEMENT_DFS_SERVICE_ASSET_MOVE_PLANNER_H
@@ -22,6 +22,7 @@
 #include <string>
 #include <vector>
 
+#include "network/softbus/softbus_socket_registry.h"
 #include "transport/socket.h"
 #include "transport/trans_type.h"
 
@@ -51,7 +52,6 @@ public:
     void CloseSessionWithSessionName(const std::string sessionName);
     static std::string GetSessionName(int32_t sessionId);
     static void OnSinkSessionOpened(int32_t sessionId, PeerSocketInfo info);
-    void RemoveNetworkId(int32_t socketId);
     void CopyOnStop(const std::string &peerNetworkId);
 
 private:
@@ -61,15 +61,9 @@ private:
     bool IsService(std::string &sessionName);
 
     std::mutex socketMutex_;
-    static std::mutex clientSessNameMapMutex_;
-    static std::map<int32_t, std::string> clientSessNameMap_;
-    static std::mutex serverIdMapMutex_;
-    static std::map<std::string, int32_t> serverIdMap_;
+    static SoftBusSocketRegistry registry_;
     static inline const std::string SERVICE_NAME{"ohos.storage.distributedfile.daemon"};
     std::map<DFS_CHANNEL_ROLE, ISocketListener> sessionListener_;
-
-    static std::mutex networkIdMapMutex_;
-    static std::map<int32_t, std::string> networkIdMap_;
 };
 } // namespace DistributedFile
 } // namespace Storage
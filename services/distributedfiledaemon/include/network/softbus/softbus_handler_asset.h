@@ -48,6 +48,8 @@ public:
 
     int32_t AssetBind(const std::string &dstNetworkId, int32_t &socketId, int32_t userId);
     int32_t AssetSendFile(int32_t socketId, const std::string& sendFile, bool isSingleFile);
+    // sends the files in one transfer straight from their place, at most MAX_SEND_FILE_NUM of them
+    int32_t AssetSendFiles(int32_t socketId, const std::vector<std::string> &sendFiles);
     void CloseAssetBind(int32_t socketId);
     void OnAssetRecvBind(int32_t socketId, const std::string &srcNetWorkId);
 
@@ -72,7 +74,10 @@ public:
     bool MkDirRecurse(const std::string& path, mode_t mode);
 
     void RemoveFile(const std::string &path, bool isRemove = true);
+
+    static constexpr size_t MAX_SEND_FILE_NUM = 500;
 private:
+    int32_t SendAssetFiles(int32_t socketId, const std::vector<std::string> &sendFiles, bool isSingleFile);
     std::string GetDstFile(const std::string &file,
                            const std::string &srcBundleName,
                            const std::string &dstBundleName,
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FILEMANAGEMENT_DFS_SERVICE_SOFTBUS_SOCKET_REGISTRY_H
+#define FILEMANAGEMENT_DFS_SERVICE_SOFTBUS_SOCKET_REGISTRY_H
+
+#include <cstdint>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "nocopyable.h"
+
+namespace OHOS {
+namespace Storage {
+namespace DistributedFile {
+/*
+ * Sockets of the copy channel. Client and sink sockets are kept by socket id together with their session
+ * name and peer network id, both of which are indexed back to the socket ids, so that teardown of a peer or
+ * a session only visits its own sockets. Server sockets are kept by session name. All lookups share one
+ * reader-writer lock, the indexes never disagree with the socket table.
+ */
+class SoftBusSocketRegistry final : public NoCopyable {
+public:
+    SoftBusSocketRegistry() = default;
+    ~SoftBusSocketRegistry() = default;
+
+    void AddServer(const std::string &sessionName, int32_t serverId);
+    bool RemoveServer(const std::string &sessionName, int32_t &serverId);
+    bool HasServer(const std::string &sessionName);
+    size_t ServerCount();
+
+    void AddSocket(int32_t socketId, const std::string &sessionName, const std::string &networkId);
+    bool RemoveSocket(int32_t socketId, std::string &idlePeer);
+    bool GetSessionName(int32_t socketId, std::string &sessionName);
+    bool GetFirstSocket(const std::string &sessionName, int32_t &socketId);
+    std::vector<int32_t> GetSocketsByNetworkId(const std::string &networkId);
+    size_t SocketCount();
+
+    void Clear();
+
+private:
+    struct SocketEntry {
+        std::string sessionName;
+        std::string networkId;
+    };
+    using SocketIndex = std::unordered_map<std::string, std::set<int32_t>>;
+
+    static void Unindex(SocketIndex &index, const std::string &key, int32_t socketId);
+    void EraseSocketLocked(std::unordered_map<int32_t, SocketEntry>::iterator iter);
+
+    std::shared_mutex mutex_;
+    std::unordered_map<std::string, int32_t> servers_;
+    std::unordered_map<int32_t, SocketEntry> sockets_;
+    SocketIndex sessionIndex_;
+    SocketIndex networkIndex_;
+};
+} // namespace DistributedFile
+} // namespace Storage
+} // namespace OHOS
+#endif // FILEMANAGEMENT_DFS_SERVICE_SOFTBUS_SOCKET_REGISTRY_H
@@ -28,6 +28,7 @@
 #include "radar_report.h"
 #include "dfsu_exception.h"
 #include "ipc/i_daemon.h"
+#include "ipc/remote_sa_cache.h"
 #include "ipc_skeleton.h"
 #include "iremote_object.h"
 #include "iservice_registry.h"
@@ -157,6 +158,7 @@ void DeviceManagerAgent::QuitGroup(shared_ptr<MountPoint> smp)
 
 void DeviceManagerAgent::OfflineAllDevice()
 {
+    RemoteSaCache::GetInstance().Clear();
     unique_lock<mutex> lock(mpToNetworksMutex_);
     for (auto [ignore, net] : cidNetTypeRecord_) {
         if (net == nullptr) {
@@ -204,6 +206,7 @@ void DeviceManagerAgent::OnDeviceOffline(const DistributedHardware::DmDeviceInfo
         "Device Offline, networkid:" + Utils::GetAnonyString(deviceInfo.networkId)};
     RadarReportAdapter::GetInstance().ReportLinkConnectionAdapter(radarInfo);
 
+    RemoteSaCache::GetInstance().Invalidate(deviceInfo.networkId);
     DeviceInfo info(deviceInfo);
     unique_lock<mutex> lock(mpToNetworksMutex_);
     auto it = cidNetTypeRecord_.find(info.cid_);
@@ -264,6 +267,7 @@ int32_t DeviceManagerAgent::OnDeviceP2POnline(const DistributedHardware::DmDevic
 int32_t DeviceManagerAgent::OnDeviceP2POffline(const DistributedHardware::DmDeviceInfo &deviceInfo)
 {
     LOGI("OnDeviceP2POffline  begin networkId %{public}s", Utils::GetAnonyString(deviceInfo.networkId).c_str());
+    RemoteSaCache::GetInstance().Invalidate(deviceInfo.networkId);
     DeviceInfo info(deviceInfo);
 
     unique_lock<mutex> lock(mpToNetworksMutex_);
@@ -15,10 +15,12 @@
 
 #include "hi_audit.h"
 
+#include <algorithm>
+#include <cinttypes>
+#include <climits>
+#include <ctime>
 #include <dirent.h>
 #include <fcntl.h>
-#include <iomanip>
-#include <sstream>
 #include <unistd.h>
 
 #include "utils_log.h"
@@ -35,23 +37,82 @@ struct HiAuditConfig {
 
 const HiAuditConfig HIAUDIT_CONFIG = {
     "/data/log/hiaudit/distributedfiledaemon/", "distributedfiledaemon", 2 * 1024, 3 * 1024 * 1024, 10};
-constexpr int8_t MILLISECONDS_LENGTH = 3;
 constexpr int64_t SEC_TO_MILLISEC = 1000;
 constexpr int MAX_TIME_BUFF = 64; // 64 : for example 2026-12-25-10-43-
 constexpr int32_t HIAUDIT_E_OK = 0;
 const std::string HIAUDIT_LOG_NAME = HIAUDIT_CONFIG.logPath + HIAUDIT_CONFIG.logName + "_audit.csv";
+const std::string HIAUDIT_RECORD_HEAD = ", " + HIAUDIT_CONFIG.logName + ", NO, ";
 constexpr const char *HIAUDIT_SUCC = "SUCC";
 constexpr const char *HIAUDIT_STATUS_SUCC = "SUCCESS";
 constexpr const char *HIAUDIT_STATUS_FAIL = "FAIL";
 constexpr const char *HIAUDIT_OP_TYPE = "DFS";
+constexpr size_t RING_CAPACITY = 4096;
+// the producer that fills this many slots wakes the writer, smaller batches wait for the interval
+constexpr uint64_t WAKE_UP_BATCH = 256;
+constexpr size_t WRITE_CHUNK_SIZE = 64 * 1024;
+constexpr std::chrono::milliseconds FLUSH_INTERVAL(500);
+constexpr std::chrono::seconds FLUSH_TIMEOUT(3);
 
-HiAudit::HiAudit()
+AuditRecordRing::AuditRecordRing(size_t capacity) : mask_(capacity - 1), slots_(new Slot[capacity])
+{
+    for (size_t i = 0; i < capacity; ++i) {
+        slots_[i].seq.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool AuditRecordRing::TryPush(std::string &&record)
+{
+    size_t pos = head_.load(std::memory_order_relaxed);
+    Slot *slot = nullptr;
+    while (true) {
+        slot = &slots_[pos & mask_];
+        size_t seq = slot->seq.load(std::memory_order_acquire);
+        auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = head_.load(std::memory_order_relaxed);
+        }
+    }
+    slot->record = std::move(record);
+    slot->seq.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool AuditRecordRing::TryPop(std::string &record)
+{
+    Slot &slot = slots_[tail_ & mask_];
+    if (slot.seq.load(std::memory_order_acquire) != tail_ + 1) {
+        return false;
+    }
+    record.swap(slot.record);
+    slot.record.clear();
+    slot.seq.store(tail_ + mask_ + 1, std::memory_order_release);
+    ++tail_;
+    return true;
+}
+
+HiAudit::HiAudit() : ring_(RING_CAPACITY)
 {
     Init();
+    writeBuffer_.reserve(WRITE_CHUNK_SIZE + HIAUDIT_CONFIG.logSize);
+    writer_ = std::thread(&HiAudit::WriterLoop, this);
 }
 
 HiAudit::~HiAudit()
 {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    writerCv_.notify_one();
+    if (writer_.joinable()) {
+        writer_.join();
+    }
     if (writeFd_ >= 0) {
         fdsan_close_with_tag(writeFd_, LOG_DOMAIN);
     }
@@ -105,29 +166,48 @@ std::string HiAudit::GetFormattedTimestamp(time_t timeStamp, const std::string&
 
 std::string HiAudit::GetFormattedTimestampEndWithMilli()
 {
+    // the second part only changes once a second, keep it per thread to skip localtime_r and strftime
+    thread_local int64_t cachedSeconds = -1;
+    thread_local char cachedDate[MAX_TIME_BUFF] = {0};
     uint64_t milliSeconds = GetMilliseconds();
-    std::string formattedTimeStamp = GetFormattedTimestamp(milliSeconds, "%Y%m%d%H%M%S");
-    std::stringstream ss;
-    ss << formattedTimeStamp;
-    milliSeconds = milliSeconds % SEC_TO_MILLISEC;
-    ss << std::setfill('0') << std::setw(MILLISECONDS_LENGTH) << milliSeconds;
-    return ss.str();
+    auto seconds = static_cast<int64_t>(milliSeconds / SEC_TO_MILLISEC);
+    if (seconds != cachedSeconds) {
+        time_t timeSeconds = static_cast<time_t>(seconds);
+        struct tm result {};
+        if (localtime_r(&timeSeconds, &result) == nullptr ||
+            strftime(cachedDate, MAX_TIME_BUFF, "%Y%m%d%H%M%S", &result) == 0) {
+            cachedDate[0] = '\0';
+        }
+        cachedSeconds = seconds;
+    }
+    char timeStamp[MAX_TIME_BUFF] = {0};
+    int ret = snprintf(timeStamp, MAX_TIME_BUFF, "%s%03" PRIu64, cachedDate, milliSeconds % SEC_TO_MILLISEC);
+    return ret > 0 ? std::string(timeStamp) : std::string();
 }
 
 void HiAudit::Write(const AuditLog& auditLog)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (writeLogSize_ == 0) {
-        WriteToFile(auditLog.TitleString());
-    }
-    std::string writeLog = GetFormattedTimestampEndWithMilli() + ", " +
-        HIAUDIT_CONFIG.logName + ", NO, " + auditLog.ToString();
-    LOGD("write %{public}s.", writeLog.c_str());
+    std::string writeLog = GetFormattedTimestampEndWithMilli();
+    // the record sits in a ring slot until the writer drains it, so reserve only what it takes
+    size_t length = std::min<size_t>(writeLog.size() + HIAUDIT_RECORD_HEAD.size() + auditLog.Length(),
+        HIAUDIT_CONFIG.logSize);
+    writeLog.reserve(length + 1);
+    writeLog.append(HIAUDIT_RECORD_HEAD);
+    auditLog.AppendTo(writeLog);
     if (writeLog.length() > HIAUDIT_CONFIG.logSize) {
-        writeLog = writeLog.substr(0, HIAUDIT_CONFIG.logSize);
+        writeLog.resize(HIAUDIT_CONFIG.logSize);
+    }
+    writeLog.push_back('\n');
+    if (!ring_.TryPush(std::move(writeLog))) {
+        droppedCount_.fetch_add(1, std::memory_order_relaxed);
+        flushRequested_.store(true, std::memory_order_relaxed);
+        writerCv_.notify_one();
+        return;
+    }
+    if ((enqueuedCount_.fetch_add(1, std::memory_order_relaxed) + 1) % WAKE_UP_BATCH == 0) {
+        flushRequested_.store(true, std::memory_order_relaxed);
+        writerCv_.notify_one();
     }
-    writeLog = writeLog + "\n";
-    WriteToFile(writeLog);
 }
 
 void HiAudit::WriteStart(const std::string &funcName)
@@ -144,6 +224,83 @@ void HiAudit::WriteEnd(const std::string &funcName, int32_t ret)
     Write(auditLog);
 }
 
+void HiAudit::Flush()
+{
+    uint64_t target = enqueuedCount_.load();
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (flushedCount_ >= target) {
+        return;
+    }
+    flushRequested_ = true;
+    writerCv_.notify_one();
+    if (!flushedCv_.wait_for(lock, FLUSH_TIMEOUT, [this, target] { return flushedCount_ >= target || stop_; })) {
+        LOGW("flush audit log timeout, target: %{public}" PRIu64 ", flushed: %{public}" PRIu64 ".",
+            target, flushedCount_);
+    }
+}
+
+void HiAudit::WriterLoop()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_) {
+        writerCv_.wait_for(lock, FLUSH_INTERVAL, [this] { return stop_ || flushRequested_.load(); });
+        flushRequested_ = false;
+        DrainRecords();
+    }
+}
+
+void HiAudit::DrainRecords()
+{
+    std::string record;
+    uint64_t drained = 0;
+    while (ring_.TryPop(record)) {
+        AppendRecord(record);
+        ++drained;
+    }
+    if (drained == 0 && pendingArchives_.empty()) {
+        return;
+    }
+    FlushBuffer();
+    flushedCount_ += drained;
+    flushedCv_.notify_all();
+
+    // the new file is already in place, compress the old one after the backlog is on disk
+    for (const auto &archiveName : pendingArchives_) {
+        ZipArchivedLog(archiveName);
+        CleanOldAuditFile();
+    }
+    pendingArchives_.clear();
+    uint64_t dropped = droppedCount_.load(std::memory_order_relaxed);
+    if (dropped != reportedDropCount_) {
+        LOGW("audit ring full, dropped records: %{public}" PRIu64 ".", dropped - reportedDropCount_);
+        reportedDropCount_ = dropped;
+    }
+}
+
+void HiAudit::AppendRecord(const std::string &record)
+{
+    if (writeLogSize_ + writeBuffer_.size() >= HIAUDIT_CONFIG.fileSize) {
+        FlushBuffer();
+        GetWriteFilePath();
+    }
+    if (writeLogSize_ == 0 && writeBuffer_.empty()) {
+        writeBuffer_.append(AuditLog().TitleString());
+    }
+    writeBuffer_.append(record);
+    if (writeBuffer_.size() >= WRITE_CHUNK_SIZE) {
+        FlushBuffer();
+    }
+}
+
+void HiAudit::FlushBuffer()
+{
+    if (writeBuffer_.empty()) {
+        return;
+    }
+    WriteToFile(writeBuffer_);
+    writeBuffer_.clear();
+}
+
 void HiAudit::GetWriteFilePath()
 {
     if (writeLogSize_ < HIAUDIT_CONFIG.fileSize) {
@@ -155,8 +312,11 @@ void HiAudit::GetWriteFilePath()
         writeFd_ = -1; // -1 : for close fd
     }
 
-    ZipAuditLog();
-    CleanOldAuditFile();
+    // only the rename happens here, zipping and cleaning are left to the writer once the buffer is out
+    std::string archiveName = RenameAuditLog();
+    if (!archiveName.empty()) {
+        pendingArchives_.push_back(archiveName);
+    }
     writeFd_ = open(HIAUDIT_LOG_NAME.c_str(), O_CREAT | O_TRUNC | O_RDWR,
         S_IRUSR | S_IWUSR | S_IRGRP);
     if (writeFd_ < 0) {
@@ -172,40 +332,33 @@ void HiAudit::CleanOldAuditFile()
 {
     uint32_t zipFileCount = 0;
     std::string oldestAuditFile;
+    time_t oldestMtime = 0;
     DIR* dir = opendir(HIAUDIT_CONFIG.logPath.c_str());
     if (dir == nullptr) {
         LOGE("failed open dir, errno: %{public}d.", errno);
         return;
     }
+    const std::string zipTag = ".zip";
     struct dirent *ptr = nullptr;
     while ((ptr = readdir(dir)) != nullptr) {
         std::string subName = std::string(ptr->d_name);
-        std::string zipTag = ".zip";
-        if (subName.find(HIAUDIT_CONFIG.logName) == 0 &&
-            subName.find(zipTag) == subName.length() - zipTag.length()) {
-            zipFileCount = zipFileCount + 1;
-            if (oldestAuditFile.empty()) {
-                oldestAuditFile = HIAUDIT_CONFIG.logPath + subName;
-                continue;
-            }
-            struct stat st;
-            if (stat((HIAUDIT_CONFIG.logPath + subName).c_str(), &st) != 0) {
-                LOGE("stat failed, errno: %{public}d, file: %{public}s.", errno, subName.c_str());
-                continue;
-            }
-            struct stat oldestSt;
-            if (stat(oldestAuditFile.c_str(), &oldestSt) != 0) {
-                oldestAuditFile = "";
-                LOGE("stat failed, errno: %{public}d, file: %{public}s.", errno, oldestAuditFile.c_str());
-                continue;
-            }
-            if (st.st_mtime < oldestSt.st_mtime) {
-                oldestAuditFile = HIAUDIT_CONFIG.logPath + subName;
-            }
+        if (subName.find(HIAUDIT_CONFIG.logName) != 0 || subName.length() < zipTag.length() ||
+            subName.compare(subName.length() - zipTag.length(), zipTag.length(), zipTag) != 0) {
+            continue;
+        }
+        zipFileCount = zipFileCount + 1;
+        struct stat st;
+        if (fstatat(dirfd(dir), ptr->d_name, &st, 0) != 0) {
+            LOGE("stat failed, errno: %{public}d, file: %{public}s.", errno, subName.c_str());
+            continue;
+        }
+        if (oldestAuditFile.empty() || st.st_mtime < oldestMtime) {
+            oldestAuditFile = HIAUDIT_CONFIG.logPath + subName;
+            oldestMtime = st.st_mtime;
         }
     }
     closedir(dir);
-    if (zipFileCount > HIAUDIT_CONFIG.fileCount) {
+    if (zipFileCount > HIAUDIT_CONFIG.fileCount && !oldestAuditFile.empty()) {
         remove(oldestAuditFile.c_str());
     }
 }
@@ -218,31 +371,43 @@ void HiAudit::WriteToFile(const std::string& content)
         return;
     }
     size_t len = content.length();
-    int ret = write(writeFd_, content.c_str(), len);
-    if (ret < 0 || ret != len) {
-        LOGE("write failed, len: %{public}zd, ret: %{public}d, errno: %{public}d.", len, ret, errno);
+    size_t written = 0;
+    while (written < len) {
+        ssize_t ret = write(writeFd_, content.c_str() + written, len - written);
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret <= 0) {
+            LOGE("write failed, len: %{public}zu, written: %{public}zu, errno: %{public}d.", len, written, errno);
+            break;
+        }
+        written += static_cast<size_t>(ret);
     }
-    len = (ret > 0) ? ret : 0;
-    writeLogSize_ = writeLogSize_ + len;
+    writeLogSize_ = writeLogSize_ + written;
 }
 
-void HiAudit::ZipAuditLog()
+std::string HiAudit::RenameAuditLog()
 {
-    std::string zipFileName = HIAUDIT_CONFIG.logPath + HIAUDIT_CONFIG.logName + "_audit_" +
+    std::string archiveName = HIAUDIT_CONFIG.logPath + HIAUDIT_CONFIG.logName + "_audit_" +
         GetFormattedTimestampEndWithMilli();
-    if (std::rename(HIAUDIT_LOG_NAME.c_str(), (zipFileName + ".csv").c_str()) != 0) {
+    if (std::rename(HIAUDIT_LOG_NAME.c_str(), (archiveName + ".csv").c_str()) != 0) {
         LOGW("rename audit log file failed, errno: %{public}d.", errno);
-        return;
+        return "";
     }
-    zipFile compressZip = Storage::DistributedFile::ZipUtil::CreateZipFile(zipFileName + ".zip");
+    return archiveName;
+}
+
+void HiAudit::ZipArchivedLog(const std::string &archiveName)
+{
+    zipFile compressZip = Storage::DistributedFile::ZipUtil::CreateZipFile(archiveName + ".zip");
     if (compressZip == nullptr) {
         LOGW("open zip file failed.");
         return;
     }
-    if (Storage::DistributedFile::ZipUtil::AddFileInZip(compressZip, zipFileName + ".csv",
+    if (Storage::DistributedFile::ZipUtil::AddFileInZip(compressZip, archiveName + ".csv",
         Storage::DistributedFile::KeepStatus::KEEP_NONE_PARENT_PATH) == 0) {
-        remove((zipFileName + ".csv").c_str());
+        remove((archiveName + ".csv").c_str());
     }
     Storage::DistributedFile::ZipUtil::CloseZipFile(compressZip);
 }
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
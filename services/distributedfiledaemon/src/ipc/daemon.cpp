@@ -55,10 +55,12 @@
 #include "network/softbus/softbus_session_pool.h"
 #include "radar_report.h"
 #include "remote_file_share.h"
+#include "remote_sa_cache.h"
 #include "sandbox_helper.h"
 #include "system_ability_definition.h"
 #include "system_notifier.h"
 #include "trans_mananger.h"
+#include "uri_batch_resolver.h"
 #include "utils_directory.h"
 #include "utils_log.h"
 
@@ -178,6 +180,7 @@ void Daemon::OnStop()
     AllConnectManager::GetInstance().UnInitAllConnectManager();
     RadarReportAdapter::GetInstance().ReportDfxStatistics();
     RadarReportAdapter::GetInstance().UnInitRadar();
+    HiAudit::GetInstance().Flush();
     LOGI("Stop finished successfully");
 }
 
@@ -670,7 +673,8 @@ int32_t Daemon::CopyBaseOnRPC(const std::string &srcUri,
                               const sptr<IFileTransListener> &listenerCallback,
                               HmdfsInfo &info)
 {
-    auto daemon = GetRemoteSA(srcNetworkId);
+    auto daemon = RemoteSaCache::GetInstance().GetOrLoad(srcNetworkId,
+        [this](const std::string &networkId) { return GetRemoteSA(networkId); });
     if (daemon == nullptr) {
         LOGE("Daemon is nullptr");
         return E_SA_LOAD_FAILED;
@@ -1236,16 +1240,17 @@ int32_t Daemon::GetDfsUrisDirFromLocal(const std::vector<std::string> &uriList,
         HiAudit::GetInstance().WriteEnd("GetDfsUrisDirFromLocal", E_PERMISSION_DENIED);
         return E_PERMISSION_DENIED;
     }
-    for (const auto &uri : uriList) {
-        if (!FileSizeUtils::IsFilePathValid(FileSizeUtils::GetRealUri(uri))) {
-            LOGE("path: %{public}s is forbidden", Utils::GetAnonyString(uri).c_str());
-            info = {"GetDfsUrisDirFromLocal", ReportLevel::INTERFACE, DfxBizStage::GENERATE_DIS_URI,
-                DEFAULT_PKGNAME, "", E_ILLEGAL_URI, "path is forbidde"};
-            RadarReportAdapter::GetInstance().ReportGenerateDisUriAdapter(info);
-            RadarReportAdapter::GetInstance().SetUserStatistics(GENERATE_DIS_URI_FAIL_CNT);
-            HiAudit::GetInstance().WriteEnd("GetDfsUrisDirFromLocal", OHOS::FileManagement::E_ILLEGAL_URI);
-            return OHOS::FileManagement::E_ILLEGAL_URI;
-        }
+    size_t invalidIndex = UriBatchResolver::FindFirstInvalid(uriList.size(), [&uriList](size_t index) {
+        return FileSizeUtils::IsFilePathValid(FileSizeUtils::GetRealUri(uriList[index]));
+    });
+    if (invalidIndex < uriList.size()) {
+        LOGE("path: %{public}s is forbidden", Utils::GetAnonyString(uriList[invalidIndex]).c_str());
+        info = {"GetDfsUrisDirFromLocal", ReportLevel::INTERFACE, DfxBizStage::GENERATE_DIS_URI,
+            DEFAULT_PKGNAME, "", E_ILLEGAL_URI, "path is forbidde"};
+        RadarReportAdapter::GetInstance().ReportGenerateDisUriAdapter(info);
+        RadarReportAdapter::GetInstance().SetUserStatistics(GENERATE_DIS_URI_FAIL_CNT);
+        HiAudit::GetInstance().WriteEnd("GetDfsUrisDirFromLocal", OHOS::FileManagement::E_ILLEGAL_URI);
+        return OHOS::FileManagement::E_ILLEGAL_URI;
     }
     auto ret = AppFileService::ModuleRemoteFileShare::RemoteFileShare::GetDfsUrisDirFromLocal(uriList, userId,
                                                                                               uriToDfsUriMaps);
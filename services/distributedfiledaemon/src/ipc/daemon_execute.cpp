@@ -31,6 +31,7 @@
 #include "network/softbus/softbus_session_pool.h"
 #include "refbase.h"
 #include "sandbox_helper.h"
+#include "uri_batch_resolver.h"
 #include "utils_directory.h"
 #include "utils_log.h"
 
@@ -151,6 +152,11 @@ void DaemonExecute::PushAssetInner(int32_t userId, const sptr<AssetObj> &assetOb
         return ;
     }
 
+    if (fileList.size() > 1 && fileList.size() <= SoftBusHandlerAsset::MAX_SEND_FILE_NUM) {
+        PushAssetStream(socketId, fileList, assetObj);
+        return;
+    }
+
     std::string sendFileName;
     bool isSingleFile;
     auto ret = HandleZip(fileList, assetObj, sendFileName, isSingleFile);
@@ -179,6 +185,26 @@ void DaemonExecute::PushAssetInner(int32_t userId, const sptr<AssetObj> &assetOb
     RadarReportAdapter::GetInstance().SetUserStatistics(FILE_ACCESS_SUCC_CNT);
 }
 
+void DaemonExecute::PushAssetStream(int32_t socketId,
+                                    const std::vector<std::string> &fileList,
+                                    const sptr<AssetObj> &assetObj)
+{
+    // the files go out in one transfer read from their place, nothing is staged in a temporary zip
+    auto taskId = assetObj->srcBundleName_ + assetObj->sessionId_;
+    SoftBusAssetSendListener::AddFileMap(taskId, fileList[0], true);
+    auto ret = SoftBusHandlerAsset::GetInstance().AssetSendFiles(socketId, fileList);
+    if (ret != E_OK) {
+        LOGE("PushAssetStream send files fail, ret %{public}d", ret);
+        HandlePushAssetFail(socketId, assetObj);
+        RadarParaInfo info = {"PushAssetStream", ReportLevel::INTERFACE, DfxBizStage::PUSH_ASSERT,
+            DEFAULT_PKGNAME, assetObj->dstNetworkId_, ret, "send files fail"};
+        RadarReportAdapter::GetInstance().ReportFileAccessAdapter(info);
+        RadarReportAdapter::GetInstance().SetUserStatistics(FILE_ACCESS_FAIL_CNT);
+        return;
+    }
+    RadarReportAdapter::GetInstance().SetUserStatistics(FILE_ACCESS_SUCC_CNT);
+}
+
 void DaemonExecute::ExecuteRequestSendFile(const AppExecFwk::InnerEvent::Pointer &event)
 {
     if (event == nullptr) {
@@ -318,39 +344,34 @@ std::vector<std::string> DaemonExecute::GetFileList(const std::vector<std::strin
                                                     int32_t userId,
                                                     const std::string &srcBundleName)
 {
-    std::vector<std::string> fileList;
-    for (const auto &uri : uris) {
-        size_t pos = uri.find(srcBundleName);
-        if (pos == std::string::npos) {
+    UriBatchResolver::FileListResult result;
+    UriBatchResolver::ResolveFileList(uris, userId, srcBundleName, result);
+    switch (result.state) {
+        case UriBatchResolver::UriState::BUNDLE_MISMATCH:
             LOGE("srcBundleName not find in uri.");
             return {};
-        }
-
-        std::string physicalPath;
-        int32_t ret = SandboxHelper::GetPhysicalPath(uri, std::to_string(userId), physicalPath);
-        if (ret != E_OK) {
-            LOGE("invalid uri, ret = %{public}d", ret);
+        case UriBatchResolver::UriState::RESOLVE_FAILED: {
+            LOGE("invalid uri, ret = %{public}d", result.resolveRet);
             RadarParaInfo info = {"GetFileList", ReportLevel::INNER, DfxBizStage::PUSH_ASSERT,
                 "AFS", "", DEFAULT_ERR, "uri err"};
             RadarReportAdapter::GetInstance().ReportFileAccessAdapter(info);
             return {};
         }
-        if (!SandboxHelper::CheckValidPath(physicalPath)) {
+        case UriBatchResolver::UriState::INVALID_PATH: {
             LOGE("invalid path");
             RadarParaInfo info = {"GetFileList", ReportLevel::INNER, DfxBizStage::PUSH_ASSERT,
                 "AFS", "", DEFAULT_ERR, "path err"};
             RadarReportAdapter::GetInstance().ReportFileAccessAdapter(info);
             return {};
         }
-        if (OHOS::Storage::DistributedFile::Utils::IsFolder(physicalPath)) {
+        case UriBatchResolver::UriState::IS_FOLDER:
             LOGE("uri is folder are not supported now.");
             return {};
-        }
-
-        fileList.emplace_back(physicalPath);
+        default:
+            break;
     }
-    LOGI("GetFileList success, file num is %{public}s", std::to_string(fileList.size()).c_str());
-    return fileList;
+    LOGI("GetFileList success, file num is %{public}s", std::to_string(result.physicalPaths.size()).c_str());
+    return std::move(result.physicalPaths);
 }
 
 int32_t DaemonExecute::HandleZip(const std::vector<std::string> &fileList,
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "remote_sa_cache.h"
+
+#include "utils_directory.h"
+#include "utils_log.h"
+
+namespace OHOS {
+namespace Storage {
+namespace DistributedFile {
+RemoteSaCache &RemoteSaCache::GetInstance()
+{
+    static RemoteSaCache instance;
+    return instance;
+}
+
+sptr<IDaemon> RemoteSaCache::GetOrLoad(const std::string &networkId, const Loader &loader)
+{
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        auto iter = cache_.find(networkId);
+        if (iter != cache_.end()) {
+            if (!iter->second.object->IsObjectDead()) {
+                return iter->second.daemon;
+            }
+            ReleaseEntry(iter->second);
+            cache_.erase(iter);
+        }
+    }
+    if (loader == nullptr) {
+        return nullptr;
+    }
+    // samgr may block on the remote side, never hold the cache lock across the load
+    auto daemon = loader(networkId);
+    if (daemon == nullptr || daemon->AsObject() == nullptr) {
+        return daemon;
+    }
+    Entry entry{daemon, daemon->AsObject(), nullptr};
+    if (entry.object->IsProxyObject()) {
+        entry.recipient = new (std::nothrow) RemoteSaDeathRecipient(networkId);
+        if (entry.recipient == nullptr || !entry.object->AddDeathRecipient(entry.recipient)) {
+            LOGW("watch remote sa failed, skip cache, networkId: %{public}s",
+                Utils::GetAnonyString(networkId).c_str());
+            return daemon;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    auto [iter, inserted] = cache_.emplace(networkId, entry);
+    if (!inserted) {
+        // a concurrent copy loaded the same peer first, keep its proxy
+        ReleaseEntry(entry);
+        return iter->second.daemon;
+    }
+    LOGI("remote sa cached, networkId: %{public}s", Utils::GetAnonyString(networkId).c_str());
+    return daemon;
+}
+
+void RemoteSaCache::Invalidate(const std::string &networkId)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    auto iter = cache_.find(networkId);
+    if (iter == cache_.end()) {
+        return;
+    }
+    LOGI("remote sa invalidated, networkId: %{public}s", Utils::GetAnonyString(networkId).c_str());
+    ReleaseEntry(iter->second);
+    cache_.erase(iter);
+}
+
+void RemoteSaCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    for (auto &[networkId, entry] : cache_) {
+        ReleaseEntry(entry);
+    }
+    cache_.clear();
+}
+
+size_t RemoteSaCache::Size()
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    return cache_.size();
+}
+
+void RemoteSaCache::OnRemoteDied(const std::string &networkId, const sptr<IRemoteObject> &diedObject)
+{
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    auto iter = cache_.find(networkId);
+    if (iter == cache_.end() || iter->second.object != diedObject) {
+        return;
+    }
+    LOGI("remote sa died, networkId: %{public}s", Utils::GetAnonyString(networkId).c_str());
+    cache_.erase(iter);
+}
+
+void RemoteSaCache::ReleaseEntry(Entry &entry)
+{
+    if (entry.recipient != nullptr && entry.object != nullptr) {
+        entry.object->RemoveDeathRecipient(entry.recipient);
+    }
+}
+
+void RemoteSaCache::RemoteSaDeathRecipient::OnRemoteDied(const wptr<IRemoteObject> &remote)
+{
+    sptr<IRemoteObject> diedRemote = remote.promote();
+    if (diedRemote == nullptr) {
+        LOGE("remote sa died notify nullptr");
+        return;
+    }
+    RemoteSaCache::GetInstance().OnRemoteDied(networkId_, diedRemote);
+}
+} // namespace DistributedFile
+} // namespace Storage
+} // namespace OHOS
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "uri_batch_resolver.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <unordered_map>
+
+#include "dfs_error.h"
+#include "sandbox_helper.h"
+#include "utils_directory.h"
+#include "utils_log.h"
+
+namespace OHOS {
+namespace Storage {
+namespace DistributedFile {
+using namespace OHOS::AppFileService;
+using namespace OHOS::FileManagement;
+using namespace std;
+namespace {
+constexpr size_t PARALLEL_THRESHOLD = 64;
+constexpr size_t MAX_WORKERS = 4;
+constexpr size_t NO_GROUP = static_cast<size_t>(-1);
+const string FILE_SCHEME = "file://";
+const string FILE_MANAGER_AUTHORITY = "docs";
+const string MEDIA_AUTHORITY = "media";
+
+/*
+ * Splits an app uri into its parent directory uri and file name. Uris that need decoding, carry a query
+ * or point into media or docs are left to SandboxHelper as a whole.
+ */
+bool SplitParent(const string &uri, string &parentUri, string &name)
+{
+    if (uri.compare(0, FILE_SCHEME.size(), FILE_SCHEME) != 0) {
+        return false;
+    }
+    size_t authorityEnd = uri.find('/', FILE_SCHEME.size());
+    if (authorityEnd == string::npos || authorityEnd == FILE_SCHEME.size()) {
+        return false;
+    }
+    string authority = uri.substr(FILE_SCHEME.size(), authorityEnd - FILE_SCHEME.size());
+    if (authority == MEDIA_AUTHORITY || authority == FILE_MANAGER_AUTHORITY) {
+        return false;
+    }
+    if (uri.find_first_of("?#%", authorityEnd) != string::npos) {
+        return false;
+    }
+    size_t lastSlash = uri.rfind('/');
+    if (lastSlash <= authorityEnd) {
+        return false;
+    }
+    name = uri.substr(lastSlash + 1);
+    if (name.empty() || name == "." || name == "..") {
+        return false;
+    }
+    parentUri = uri.substr(0, lastSlash);
+    return true;
+}
+} // namespace
+
+size_t UriBatchResolver::FindFirstInvalid(size_t count, const function<bool(size_t index)> &isValid)
+{
+    atomic<size_t> next{0};
+    atomic<size_t> firstInvalid{count};
+    // indexes are claimed in ascending order, so once a claim passes the lowest failure nothing is left to check
+    auto worker = [&next, &firstInvalid, count, &isValid]() {
+        for (size_t index = next++; index < count && index < firstInvalid.load(); index = next++) {
+            if (isValid(index)) {
+                continue;
+            }
+            size_t current = firstInvalid.load();
+            while (index < current && !firstInvalid.compare_exchange_weak(current, index)) {
+            }
+        }
+    };
+    size_t workerCount = count < PARALLEL_THRESHOLD ? 1 : min(MAX_WORKERS, count / PARALLEL_THRESHOLD);
+    vector<thread> workers;
+    for (size_t i = 1; i < workerCount; i++) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto &thread : workers) {
+        thread.join();
+    }
+    return firstInvalid.load();
+}
+
+void UriBatchResolver::ResolveFileList(const vector<string> &uris, int32_t userId, const string &srcBundleName,
+    FileListResult &result)
+{
+    size_t count = uris.size();
+    vector<string> names(count);
+    vector<size_t> uriGroups(count, NO_GROUP);
+    vector<string> groupUris;
+    vector<size_t> groupSizes;
+    unordered_map<string, size_t> groupIndexes;
+    for (size_t i = 0; i < count; i++) {
+        string parentUri;
+        if (!SplitParent(uris[i], parentUri, names[i])) {
+            continue;
+        }
+        auto [iter, inserted] = groupIndexes.emplace(parentUri, groupUris.size());
+        if (inserted) {
+            groupUris.push_back(parentUri);
+            groupSizes.push_back(0);
+        }
+        uriGroups[i] = iter->second;
+        groupSizes[iter->second]++;
+    }
+
+    string userIdStr = to_string(userId);
+    vector<string> groupPaths(groupUris.size());
+    vector<int32_t> groupRets(groupUris.size(), E_OK);
+    FindFirstInvalid(groupUris.size(), [&](size_t group) {
+        // a lone file gains nothing from resolving its directory first
+        if (groupSizes[group] > 1) {
+            groupRets[group] = SandboxHelper::GetPhysicalPath(groupUris[group], userIdStr, groupPaths[group]);
+        } else {
+            groupRets[group] = E_INVAL_ARG;
+        }
+        return true;
+    });
+
+    vector<UriState> states(count, UriState::VALID);
+    vector<int32_t> rets(count, E_OK);
+    result.physicalPaths.assign(count, "");
+    result.failedIndex = FindFirstInvalid(count, [&](size_t i) {
+        const string &uri = uris[i];
+        if (uri.find(srcBundleName) == string::npos) {
+            states[i] = UriState::BUNDLE_MISMATCH;
+            return false;
+        }
+        string &physicalPath = result.physicalPaths[i];
+        size_t group = uriGroups[i];
+        if (group != NO_GROUP && groupRets[group] == E_OK) {
+            physicalPath = groupPaths[group] + "/" + names[i];
+        } else {
+            rets[i] = SandboxHelper::GetPhysicalPath(uri, userIdStr, physicalPath);
+            if (rets[i] != E_OK) {
+                states[i] = UriState::RESOLVE_FAILED;
+                return false;
+            }
+        }
+        if (!SandboxHelper::CheckValidPath(physicalPath)) {
+            states[i] = UriState::INVALID_PATH;
+            return false;
+        }
+        if (Utils::IsFolder(physicalPath)) {
+            states[i] = UriState::IS_FOLDER;
+            return false;
+        }
+        return true;
+    });
+    if (result.failedIndex < count) {
+        result.state = states[result.failedIndex];
+        result.resolveRet = rets[result.failedIndex];
+        result.physicalPaths.clear();
+        return;
+    }
+    result.state = UriState::VALID;
+    result.resolveRet = E_OK;
+}
+} // namespace DistributedFile
+} // namespace Storage
+} // namespace OHOS
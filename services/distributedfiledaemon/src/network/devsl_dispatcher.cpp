@@ -15,11 +15,16 @@
 
 #include "network/devsl_dispatcher.h"
 
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include "device_manager.h"
 #include "device/device_manager_agent.h"
 #include "dfs_radar.h"
 #include "radar_report.h"
 #include "ipc/i_daemon.h"
+#include "network/security_label_cache.h"
 #include "securec.h"
 #include "security_label.h"
 #include "softbus_bus_center.h"
@@ -31,6 +36,47 @@ namespace DistributedFile {
 std::mutex DevslDispatcher::mutex;
 std::map<std::string, int32_t> DevslDispatcher::devslMap_;
 
+namespace {
+/* Keeps the parent directory of the last path open, files of one directory are then found without a full walk. */
+class ParentDirCursor {
+public:
+    ~ParentDirCursor()
+    {
+        Close();
+    }
+
+    bool Stat(const std::string &path, struct stat &st)
+    {
+        size_t pos = path.rfind('/');
+        if (pos == std::string::npos || pos + 1 == path.size()) {
+            return stat(path.c_str(), &st) == 0;
+        }
+        std::string dir = (pos == 0) ? "/" : path.substr(0, pos);
+        if (dir != dir_) {
+            Close();
+            dir_ = dir;
+            dirFd_ = open(dir_.c_str(), O_PATH | O_DIRECTORY | O_CLOEXEC);
+        }
+        if (dirFd_ < 0) {
+            return stat(path.c_str(), &st) == 0;
+        }
+        return fstatat(dirFd_, path.c_str() + pos + 1, &st, 0) == 0;
+    }
+
+private:
+    void Close()
+    {
+        if (dirFd_ >= 0) {
+            close(dirFd_);
+            dirFd_ = -1;
+        }
+    }
+
+    std::string dir_;
+    int dirFd_ = -1;
+};
+} // namespace
+
 int32_t DevslDispatcher::Start()
 {
     int32_t status = DATASL_OnStart();
@@ -98,8 +144,23 @@ bool DevslDispatcher::CompareDevslWithLocal(const std::string &peerNetworkId, co
         return false;
     }
 
-    for (auto path : paths) {
-        auto securityLabel = GetSecurityLabel(path);
+    // a cached label costs one stat relative to the open parent directory instead of a full xattr read
+    ParentDirCursor cursor;
+    auto &labelCache = SecurityLabelCache::GetInstance();
+    for (const auto &path : paths) {
+        struct stat st = {};
+        bool hasStat = cursor.Stat(path, st);
+        int32_t securityLabel = -1;
+        if (!hasStat || !labelCache.Lookup(st, securityLabel)) {
+            securityLabel = GetSecurityLabel(path);
+            /*
+             * stored under the identity stat'ed before the read: relabelling, renaming or unlinking that file
+             * changes its ctime, so a label read from whatever replaced it is never found for it again
+             */
+            if (hasStat && securityLabel >= 0) {
+                labelCache.Store(st, securityLabel);
+            }
+        }
         if (securityLabel < 0) {
             LOGE("localDevsl < 0");
             RadarParaInfo info = {"CompareDevslWithLocal", ReportLevel::INNER, DfxBizStage::SOFTBUS_COPY,
@@ -14,6 +14,11 @@
  */
 
 #include "network/kernel_talker.h"
+
+#include <cstring>
+#include <sys/eventfd.h>
+#include <unordered_map>
+
 #include "device/device_manager_agent.h"
 #include "dfs_error.h"
 #include "network/devsl_dispatcher.h"
@@ -27,10 +32,9 @@ namespace DistributedFile {
 using namespace std;
 
 constexpr int KEY_MAX_LEN = 32;
-constexpr int POLL_TIMEOUT_MS = 200;
-constexpr int NONE_EVENT = -1;
-constexpr int READ_EVENT = 1;
-constexpr int TIME_OUT_EVENT = 0;
+constexpr int POLL_INFINITE = -1;
+constexpr nfds_t POLL_FD_CNT = 2;
+constexpr size_t NOTIFY_BATCH_SIZE = 64;
 constexpr int RESEVERD_SIZE = 17;
 constexpr uint8_t NORMAL_MODE = 0;
 constexpr uint8_t IT_SECURITY_MODE = 1;
@@ -194,6 +198,7 @@ void KernelTalker::CreatePollThread()
 void KernelTalker::WaitForPollThreadExited()
 {
     isRunning_ = false;
+    WakeUpPollThread();
     std::lock_guard lock(pollThreadMutex_);
     if (pollThread_ == nullptr) {
         LOGE("pollTread is null");
@@ -236,44 +241,143 @@ void KernelTalker::PollRun()
     fdsan_exchange_owner_tag(cmdFd, 0, new_tag);
     LOGI("Open node file success");
 
-    while (isRunning_) {
-        fileFd.fd = cmdFd;
-        fileFd.events = POLLPRI;
-        fileFd.revents = 0;
-        int ret = poll(&fileFd, 1, POLL_TIMEOUT_MS);
-        switch (ret) {
-            case NONE_EVENT:
-                LOGI("none event, poll exit");
-                break;
-            case TIME_OUT_EVENT:
-                break;
-            case READ_EVENT:
-                HandleAllNotify(cmdFd);
-                break;
-            default:
-                LOGI("poll exit");
-        }
-    }
+    NotifyLoop(cmdFd, POLLPRI);
     fdsan_close_with_tag(cmdFd, new_tag);
     LOGI("exit");
     return;
 }
 
+void KernelTalker::NotifyLoop(int notifyFd, short events)
+{
+    int wakeFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (wakeFd < 0) {
+        LOGE("create wake fd failed %{public}d", errno);
+        return;
+    }
+    {
+        // publish the wake fd before isRunning_ is checked, so a stop request can never be missed
+        std::lock_guard<std::mutex> lock(wakeFdMutex_);
+        wakeFd_ = wakeFd;
+    }
+
+    struct pollfd fileFds[POLL_FD_CNT] = {
+        { .fd = notifyFd, .events = events, .revents = 0 },
+        { .fd = wakeFd, .events = POLLIN, .revents = 0 },
+    };
+    while (isRunning_) {
+        fileFds[0].revents = 0;
+        fileFds[1].revents = 0;
+        int ret = poll(fileFds, POLL_FD_CNT, POLL_INFINITE);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            LOGE("poll failed %{public}d, poll exit", errno);
+            break;
+        }
+        if (fileFds[1].revents & POLLIN) {
+            eventfd_t value = 0;
+            eventfd_read(wakeFd, &value);
+            continue;
+        }
+        // sysfs reports a changed node as POLLPRI | POLLERR
+        if (fileFds[0].revents & (events | POLLERR)) {
+            HandleAllNotify(notifyFd);
+        }
+        if (fileFds[0].revents & (POLLHUP | POLLNVAL)) {
+            LOGE("notify fd hang up, revents:%{public}d, poll exit", fileFds[0].revents);
+            break;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(wakeFdMutex_);
+    wakeFd_ = -1;
+    close(wakeFd);
+}
+
+void KernelTalker::WakeUpPollThread()
+{
+    std::lock_guard<std::mutex> lock(wakeFdMutex_);
+    if (wakeFd_ < 0) {
+        return;
+    }
+    if (eventfd_write(wakeFd_, 1) != 0) {
+        LOGE("wake up poll thread failed %{public}d", errno);
+    }
+}
+
 void KernelTalker::HandleAllNotify(int fd)
 {
-    NotifyParam param;
+    std::vector<NotifyParam> pending;
+    pending.reserve(NOTIFY_BATCH_SIZE);
 
     while (isRunning_) {
-        lseek(fd, 0, SEEK_SET);
-        param.notify = NOTIFY_NONE;
-        int readSize = read(fd, &param, sizeof(NotifyParam));
-        if ((readSize < (int)sizeof(NotifyParam)) || (param.notify == NOTIFY_NONE)) {
+        bool drained = ReadNotifyBatch(fd, pending);
+        if (drained || pending.size() >= NOTIFY_BATCH_SIZE) {
+            CoalesceNotify(pending);
+            for (auto &param : pending) {
+                NotifyHandler(param);
+            }
+            pending.clear();
+        }
+        if (drained) {
             return;
         }
-        NotifyHandler(param);
     }
 }
 
+/*
+ * Appends the records of one read to pending and returns true once nothing is left. The hmdfs node hands
+ * out a single record per read and needs a rewind in between, a stream fd may return many at once.
+ */
+bool KernelTalker::ReadNotifyBatch(int fd, std::vector<NotifyParam> &pending)
+{
+    size_t offset = pending.size();
+    size_t room = NOTIFY_BATCH_SIZE > offset ? NOTIFY_BATCH_SIZE - offset : 1;
+    pending.resize(offset + room);
+    lseek(fd, 0, SEEK_SET);
+    ssize_t readSize = read(fd, pending.data() + offset, room * sizeof(NotifyParam));
+    size_t count = readSize > 0 ? static_cast<size_t>(readSize) / sizeof(NotifyParam) : 0;
+    if (readSize > 0 && static_cast<size_t>(readSize) % sizeof(NotifyParam) != 0) {
+        LOGE("drop partial notify, readSize:%{public}zd", readSize);
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (pending[offset + i].notify == NOTIFY_NONE) {
+            pending.resize(offset + i);
+            return true;
+        }
+    }
+    pending.resize(offset + count);
+    return count == 0;
+}
+
+/*
+ * Drops a notify that repeats the previous one kept for the same cid. Order between different notifies
+ * of one cid is kept, so an offline followed by a new get session still reaches both callbacks.
+ */
+void KernelTalker::CoalesceNotify(std::vector<NotifyParam> &pending)
+{
+    std::unordered_map<std::string, size_t> lastKept;
+    size_t kept = 0;
+    for (size_t i = 0; i < pending.size(); i++) {
+        NotifyParam &param = pending[i];
+        std::string cid(param.remoteCid, strnlen(param.remoteCid, CID_MAX_LEN));
+        auto iter = lastKept.find(cid);
+        if (iter != lastKept.end() && pending[iter->second].notify == param.notify &&
+            pending[iter->second].fd == param.fd) {
+            continue;
+        }
+        if (kept != i) {
+            pending[kept] = param;
+        }
+        lastKept[cid] = kept++;
+    }
+    if (kept != pending.size()) {
+        LOGI("coalesced notify, %{public}zu to %{public}zu", pending.size(), kept);
+    }
+    pending.resize(kept);
+}
+
 void KernelTalker::NotifyHandler(NotifyParam &param)
 {
     int cmd = param.notify;
@@ -27,8 +27,6 @@ namespace Storage {
 namespace DistributedFile {
 using namespace std;
 namespace {
-constexpr int OPEN_SESSSION_DELAY_TIME = 100;
-constexpr int32_t NOTIFY_GET_SESSION_WAITING_TIME = 2;
 constexpr int32_t VALID_MOUNT_PATH_LEN = 16;
 } // namespace
 
@@ -52,14 +50,35 @@ void NetworkAgentTemplate::Stop()
     LOGI("Stop Enter");
     StopTopHalf();
     StopBottomHalf();
+    reconnectScheduler_.CancelAll();
+    {
+        std::lock_guard<std::mutex> lock(reconnectMutex_);
+        sessionReconnects_.clear();
+    }
     kernerlTalker_->WaitForPollThreadExited();
 }
 
 void NetworkAgentTemplate::ConnectDeviceByP2PAsync(const DeviceInfo info)
 {
     LOGI("ConnectDeviceByP2PAsync Enter");
-    std::this_thread::sleep_for(std::chrono::milliseconds(OPEN_SESSSION_DELAY_TIME));
-    OpenSession(info, LINK_TYPE_P2P);
+    ConnectDeviceByP2PInner(info.GetCid(), 0);
+}
+
+void NetworkAgentTemplate::ConnectDeviceByP2PInner(std::string cid, uint32_t attempt)
+{
+    DeviceInfo deviceInfo;
+    deviceInfo.SetCid(cid);
+    if (OpenSession(deviceInfo, LINK_TYPE_P2P) == FileManagement::E_OK) {
+        return;
+    }
+    // the p2p link may still be coming up, retry from the timer instead of sleeping on the command thread
+    {
+        std::lock_guard<std::mutex> lock(reconnectMutex_);
+        sessionReconnects_.erase(cid);
+    }
+    if (!reconnectScheduler_.Schedule(cid, attempt + 1)) {
+        LOGE("connect by p2p failed, cid:%{public}s", Utils::GetAnonyString(cid).c_str());
+    }
 }
 
 void NetworkAgentTemplate::DisconnectAllDevices()
@@ -79,6 +98,7 @@ void NetworkAgentTemplate::DisconnectDeviceByP2P(const std::string networkId)
 void NetworkAgentTemplate::DisconnectDeviceByP2PHmdfs(const std::string networkId)
 {
     LOGI("DeviceOffline, networkId:%{public}s", Utils::GetAnonyString(networkId).c_str());
+    CancelReconnect(networkId);
     sessionPool_.ReleaseSession(networkId, true);
     ConnectCount::GetInstance().NotifyRemoteReverseObj(networkId, ON_STATUS_OFFLINE);
     ConnectCount::GetInstance().RemoveConnect(networkId);
@@ -98,6 +118,7 @@ void NetworkAgentTemplate::CloseSessionForOneDevice(const string &cid)
 
 void NetworkAgentTemplate::CloseSessionForOneDeviceInner(std::string cid)
 {
+    CancelReconnect(cid);
     sessionPool_.ReleaseSession(cid, true);
     ConnectCount::GetInstance().NotifyRemoteReverseObj(cid, ON_STATUS_OFFLINE);
     ConnectCount::GetInstance().NotifyFileStatusChange(
@@ -152,22 +173,71 @@ void NetworkAgentTemplate::GetSessionProcessInner(NotifyParam param)
 
 void NetworkAgentTemplate::GetSession(const string &cid)
 {
-    std::this_thread::sleep_for(std::chrono::seconds(NOTIFY_GET_SESSION_WAITING_TIME));
+    // try at once, a link that is still usable comes back without any wait
+    ReconnectInner(cid, 0);
+}
+
+void NetworkAgentTemplate::ReconnectInner(std::string cid, uint32_t attempt)
+{
+    if (attempt > 0 && !ConnectCount::GetInstance().CheckCount(cid)) {
+        LOGI("connection released while waiting, cid:%{public}s", Utils::GetAnonyString(cid).c_str());
+        sessionPool_.SinkOffline(cid);
+        return;
+    }
     DeviceInfo deviceInfo;
     deviceInfo.SetCid(cid);
     try {
         if (OpenSession(deviceInfo, LINK_TYPE_P2P) == FileManagement::E_OK) {
             return;
         }
+        {
+            std::lock_guard<std::mutex> lock(reconnectMutex_);
+            sessionReconnects_.insert(cid);
+        }
+        if (reconnectScheduler_.Schedule(cid, attempt + 1)) {
+            LOGW("reget session failed, retry later, attempt:%{public}u", attempt);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(reconnectMutex_);
+            sessionReconnects_.erase(cid);
+        }
         LOGE("reget session failed");
-        sessionPool_.SinkOffline(cid);
-        ConnectCount::GetInstance().NotifyRemoteReverseObj(cid, ON_STATUS_OFFLINE);
-        ConnectCount::GetInstance().RemoveConnect(cid);
-        DeviceManagerAgent::GetInstance()->UMountDfsDocs(cid, cid.substr(0, VALID_MOUNT_PATH_LEN), true);
+        GiveUpReconnect(cid);
     } catch (const DfsuException &e) {
         LOGE("reget session failed, code: %{public}d", e.code());
     }
 }
+
+// runs on the scheduler timer, hand the attempt back to the command queue
+void NetworkAgentTemplate::ReconnectLater(const std::string &cid, uint32_t attempt)
+{
+    bool isSessionReconnect = false;
+    {
+        std::lock_guard<std::mutex> lock(reconnectMutex_);
+        isSessionReconnect = sessionReconnects_.erase(cid) > 0;
+    }
+    auto cmd = make_unique<DfsuCmd<NetworkAgentTemplate, std::string, uint32_t>>(
+        isSessionReconnect ? &NetworkAgentTemplate::ReconnectInner : &NetworkAgentTemplate::ConnectDeviceByP2PInner,
+        cid, attempt);
+    cmd->UpdateOption({.tryTimes_ = 1});
+    Recv(move(cmd));
+}
+
+void NetworkAgentTemplate::CancelReconnect(const std::string &cid)
+{
+    reconnectScheduler_.Cancel(cid);
+    std::lock_guard<std::mutex> lock(reconnectMutex_);
+    sessionReconnects_.erase(cid);
+}
+
+void NetworkAgentTemplate::GiveUpReconnect(const std::string &cid)
+{
+    sessionPool_.SinkOffline(cid);
+    ConnectCount::GetInstance().NotifyRemoteReverseObj(cid, ON_STATUS_OFFLINE);
+    ConnectCount::GetInstance().RemoveConnect(cid);
+    DeviceManagerAgent::GetInstance()->UMountDfsDocs(cid, cid.substr(0, VALID_MOUNT_PATH_LEN), true);
+}
 } // namespace DistributedFile
 } // namespace Storage
 } // namespace OHOS
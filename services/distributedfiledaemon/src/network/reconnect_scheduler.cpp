@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "network/reconnect_scheduler.h"
+
+#include <algorithm>
+
+#include "utils_directory.h"
+#include "utils_log.h"
+
+namespace OHOS {
+namespace Storage {
+namespace DistributedFile {
+using namespace std;
+namespace {
+constexpr uint32_t PERCENT = 100;
+constexpr uint32_t MAX_SHIFT = 16;
+} // namespace
+
+ReconnectScheduler::ReconnectScheduler(Callback callback, BackoffPolicy policy)
+    : callback_(callback), policy_(policy), random_(random_device()())
+{
+}
+
+ReconnectScheduler::~ReconnectScheduler()
+{
+    {
+        lock_guard<mutex> lock(mutex_);
+        pending_.clear();
+        running_ = false;
+    }
+    cv_.notify_one();
+    if (timer_.joinable()) {
+        timer_.join();
+    }
+}
+
+chrono::milliseconds ReconnectScheduler::GetBackoffDelay(uint32_t attempt)
+{
+    if (attempt == 0) {
+        return chrono::milliseconds(0);
+    }
+    int64_t delayMs = policy_.baseDelay.count() << min(attempt - 1, MAX_SHIFT);
+    auto delay = chrono::milliseconds(min<int64_t>(delayMs, policy_.maxDelay.count()));
+    int64_t spread = delay.count() * min(policy_.jitterPercent, PERCENT) / PERCENT;
+    if (spread == 0) {
+        return delay;
+    }
+    uniform_int_distribution<int64_t> jitter(-spread, spread);
+    return delay + chrono::milliseconds(jitter(random_));
+}
+
+bool ReconnectScheduler::Schedule(const string &cid, uint32_t attempt)
+{
+    if (attempt >= policy_.maxAttempts) {
+        LOGE("reconnect attempts exhausted, cid:%{public}s", Utils::GetAnonyString(cid).c_str());
+        return false;
+    }
+    lock_guard<mutex> lock(mutex_);
+    auto delay = GetBackoffDelay(attempt);
+    pending_[cid] = { attempt, chrono::steady_clock::now() + delay };
+    LOGI("reconnect scheduled, cid:%{public}s, attempt:%{public}u, delay:%{public}lld ms",
+        Utils::GetAnonyString(cid).c_str(), attempt, static_cast<long long>(delay.count()));
+    // the timer thread is started by the first reconnect and lives as long as the scheduler
+    if (!running_) {
+        running_ = true;
+        timer_ = thread(&ReconnectScheduler::TimerLoop, this);
+        return true;
+    }
+    cv_.notify_one();
+    return true;
+}
+
+void ReconnectScheduler::Cancel(const string &cid)
+{
+    lock_guard<mutex> lock(mutex_);
+    if (pending_.erase(cid) > 0) {
+        LOGI("reconnect canceled, cid:%{public}s", Utils::GetAnonyString(cid).c_str());
+    }
+}
+
+void ReconnectScheduler::CancelAll()
+{
+    lock_guard<mutex> lock(mutex_);
+    pending_.clear();
+}
+
+void ReconnectScheduler::TimerLoop()
+{
+    unique_lock<mutex> lock(mutex_);
+    while (running_) {
+        if (pending_.empty()) {
+            cv_.wait(lock);
+            continue;
+        }
+        auto next = min_element(pending_.begin(), pending_.end(),
+            [](const auto &lhs, const auto &rhs) { return lhs.second.due < rhs.second.due; });
+        if (next->second.due > chrono::steady_clock::now()) {
+            cv_.wait_until(lock, next->second.due);
+            continue;
+        }
+        string cid = next->first;
+        uint32_t attempt = next->second.attempt;
+        pending_.erase(next);
+        lock.unlock();
+        callback_(cid, attempt);
+        lock.lock();
+    }
+}
+} // namespace DistributedFile
+} // namespace Storage
+} // namespace OHOS
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "network/security_label_cache.h"
+
+#include <ctime>
+
+namespace OHOS {
+namespace Storage {
+namespace DistributedFile {
+namespace {
+constexpr time_t RACY_WINDOW_SEC = 1;
+} // namespace
+
+SecurityLabelCache &SecurityLabelCache::GetInstance()
+{
+    static SecurityLabelCache instance;
+    return instance;
+}
+
+bool SecurityLabelCache::Lookup(const struct stat &st, int32_t &label)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = entries_.find({st.st_dev, st.st_ino});
+    if (iter == entries_.end()) {
+        return false;
+    }
+    Entry &entry = iter->second;
+    if (entry.ctime.tv_sec != st.st_ctim.tv_sec || entry.ctime.tv_nsec != st.st_ctim.tv_nsec) {
+        lru_.erase(entry.lruIter);
+        entries_.erase(iter);
+        return false;
+    }
+    lru_.splice(lru_.begin(), lru_, entry.lruIter);
+    label = entry.label;
+    return true;
+}
+
+void SecurityLabelCache::Store(const struct stat &st, int32_t label)
+{
+    struct timespec now = {};
+    clock_gettime(CLOCK_REALTIME, &now);
+    if (st.st_ctim.tv_sec + RACY_WINDOW_SEC >= now.tv_sec) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    InodeKey key = {st.st_dev, st.st_ino};
+    auto iter = entries_.find(key);
+    if (iter != entries_.end()) {
+        iter->second.ctime = st.st_ctim;
+        iter->second.label = label;
+        lru_.splice(lru_.begin(), lru_, iter->second.lruIter);
+        return;
+    }
+    if (entries_.size() >= MAX_ENTRIES) {
+        entries_.erase(lru_.back());
+        lru_.pop_back();
+    }
+    lru_.push_front(key);
+    entries_.emplace(key, Entry{st.st_ctim, label, lru_.begin()});
+}
+
+void SecurityLabelCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    lru_.clear();
+}
+
+size_t SecurityLabelCache::Size()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+} // namespace DistributedFile
+} // namespace Storage
+} // namespace OHOS
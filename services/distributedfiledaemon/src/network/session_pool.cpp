@@ -14,6 +14,9 @@
  */
 
 #include "network/session_pool.h"
+
+#include <algorithm>
+
 #include "dm_device_info.h"
 #include "device/device_manager_agent.h"
 #include "dfs_error.h"
@@ -24,6 +27,22 @@ namespace Storage {
 namespace DistributedFile {
 using namespace std;
 
+namespace {
+template<typename Key, typename Index, typename Iter>
+void RemoveFromIndex(Index &index, const Key &key, Iter iter)
+{
+    auto bucket = index.find(key);
+    if (bucket == index.end()) {
+        return;
+    }
+    auto &iters = bucket->second;
+    iters.erase(std::remove(iters.begin(), iters.end(), iter), iters.end());
+    if (iters.empty()) {
+        index.erase(bucket);
+    }
+}
+} // namespace
+
 void SessionPool::HoldSession(shared_ptr<BaseSession> session, const std::string backStage)
 {
     if (talker_ == nullptr) {
@@ -39,25 +58,19 @@ void SessionPool::ReleaseSession(const int32_t fd)
 {
     lock_guard lock(sessionPoolLock_);
     LOGI("ReleaseSession start, fd=%{public}d", fd);
-    for (auto iter = usrSpaceSessionPool_.begin(); iter != usrSpaceSessionPool_.end(); ++iter) {
-        if ((*iter) != nullptr && (*iter)->GetHandle() == fd) {
-            (*iter)->Release();
-            iter = usrSpaceSessionPool_.erase(iter);
-            break;
-        }
+    auto bucket = fdIndex_.find(fd);
+    if (bucket == fdIndex_.end() || bucket->second.empty()) {
+        return;
     }
+    SessionIter iter = bucket->second.front();
+    (*iter)->Release();
+    EraseSessionFromPool(iter);
 }
 
 bool SessionPool::CheckIfGetSession(const int32_t fd, bool &isServer)
 {
     lock_guard lock(sessionPoolLock_);
-    std::shared_ptr<BaseSession> session = nullptr;
-    for (auto iter = usrSpaceSessionPool_.begin(); iter != usrSpaceSessionPool_.end(); ++iter) {
-        if ((*iter) != nullptr && (*iter)->GetHandle() == fd) {
-            session = *iter;
-            break;
-        }
-    }
+    std::shared_ptr<BaseSession> session = FindSessionByFd(fd);
     if (session == nullptr) {
         // client disconnect, server allconnect disconnect
         isServer = false;
@@ -78,12 +91,7 @@ void SessionPool::SinkOffline(const std::string &cid)
 bool SessionPool::FindSocketId(int32_t socketId)
 {
     lock_guard lock(sessionPoolLock_);
-    for (auto iter = usrSpaceSessionPool_.begin(); iter != usrSpaceSessionPool_.end(); ++iter) {
-        if ((*iter) != nullptr && (*iter)->GetSessionId() == socketId) {
-            return true;
-        }
-    }
-    return false;
+    return socketIdIndex_.find(socketId) != socketIdIndex_.end();
 }
 
 void SessionPool::ReleaseSession(const std::string &cid, bool isReleaseAll)
@@ -91,18 +99,17 @@ void SessionPool::ReleaseSession(const std::string &cid, bool isReleaseAll)
     lock_guard lock(sessionPoolLock_);
     std::vector<std::shared_ptr<BaseSession>> sessions;
     LOGI("ReleaseSession, cid:%{public}s", Utils::GetAnonyString(cid).c_str());
-    for (auto iter = usrSpaceSessionPool_.begin(); iter != usrSpaceSessionPool_.end();) {
-        if ((*iter) == nullptr) {
-            LOGE("Value is nullptr");
-            ++iter;
-            continue;
+    auto bucket = cidIndex_.find(cid);
+    if (bucket != cidIndex_.end()) {
+        // erasing shrinks the bucket, walk a copy of it
+        std::vector<SessionIter> iters = bucket->second;
+        for (auto iter : iters) {
+            if ((*iter)->IsFromServer() && !isReleaseAll) {
+                continue;
+            }
+            sessions.push_back(*iter);
+            EraseSessionFromPool(iter);
         }
-        if (((*iter)->GetCid() != cid || ((*iter)->IsFromServer() && !isReleaseAll))) {
-            ++iter;
-            continue;
-        }
-        sessions.push_back(*iter);
-        iter = usrSpaceSessionPool_.erase(iter);
     }
     for (const auto &session : sessions) {
         session->Release();
@@ -120,12 +127,7 @@ void SessionPool::ReleaseSession(const std::string &cid, bool isReleaseAll)
 bool SessionPool::FindCid(const std::string &cid)
 {
     lock_guard lock(sessionPoolLock_);
-    for (auto iter = usrSpaceSessionPool_.begin(); iter != usrSpaceSessionPool_.end(); ++iter) {
-        if ((*iter) != nullptr && (*iter)->GetCid() == cid) {
-            return true;
-        }
-    }
-    return false;
+    return cidIndex_.find(cid) != cidIndex_.end();
 }
 
 void SessionPool::ReleaseAllSession()
@@ -142,12 +144,43 @@ void SessionPool::ReleaseAllSession()
         /* device offline, session release by softbus */
         iter = usrSpaceSessionPool_.erase(iter);
     }
+    fdIndex_.clear();
+    socketIdIndex_.clear();
+    cidIndex_.clear();
 }
 
 void SessionPool::AddSessionToPool(shared_ptr<BaseSession> session)
 {
     lock_guard lock(sessionPoolLock_);
     usrSpaceSessionPool_.push_back(session);
+    if (session == nullptr) {
+        return;
+    }
+    // handle, socket id and cid are fixed for the lifetime of a session, so they are safe index keys
+    SessionIter iter = std::prev(usrSpaceSessionPool_.end());
+    fdIndex_[session->GetHandle()].push_back(iter);
+    socketIdIndex_[session->GetSessionId()].push_back(iter);
+    cidIndex_[session->GetCid()].push_back(iter);
+}
+
+void SessionPool::EraseSessionFromPool(SessionIter iter)
+{
+    const auto &session = *iter;
+    if (session != nullptr) {
+        RemoveFromIndex(fdIndex_, session->GetHandle(), iter);
+        RemoveFromIndex(socketIdIndex_, session->GetSessionId(), iter);
+        RemoveFromIndex(cidIndex_, session->GetCid(), iter);
+    }
+    usrSpaceSessionPool_.erase(iter);
+}
+
+std::shared_ptr<BaseSession> SessionPool::FindSessionByFd(const int32_t fd)
+{
+    auto bucket = fdIndex_.find(fd);
+    if (bucket == fdIndex_.end() || bucket->second.empty()) {
+        return nullptr;
+    }
+    return *bucket->second.front();
 }
 } // namespace DistributedFile
 } // namespace Storage
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "network/softbus/asset_move_planner.h"
+
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "utils_log.h"
+
+namespace OHOS {
+namespace Storage {
+namespace DistributedFile {
+namespace {
+// directory fds kept open at once, the cache starts over when a tree has more directories
+constexpr size_t MAX_CACHED_DIRS = 256;
+constexpr int DIR_OPEN_FLAGS = O_PATH | O_DIRECTORY | O_CLOEXEC;
+} // namespace
+
+AssetMovePlanner::~AssetMovePlanner()
+{
+    CloseDirs();
+}
+
+bool AssetMovePlanner::SplitPath(const std::string &path, std::string &dir, std::string &name)
+{
+    size_t pos = path.rfind('/');
+    if (pos == std::string::npos) {
+        dir = ".";
+        name = path;
+        return !name.empty();
+    }
+    name = path.substr(pos + 1);
+    size_t end = path.find_last_not_of('/', pos);
+    dir = (end == std::string::npos) ? "/" : path.substr(0, end + 1);
+    return !name.empty() && name != "." && name != "..";
+}
+
+bool AssetMovePlanner::AddMove(const std::string &srcPath, const std::string &dstPath)
+{
+    Move move;
+    if (!SplitPath(srcPath, move.srcDir, move.srcName) || !SplitPath(dstPath, move.dstDir, move.dstName)) {
+        LOGE("invalid asset move path");
+        return false;
+    }
+    moves_.push_back(std::move(move));
+    return true;
+}
+
+int AssetMovePlanner::OpenDir(const std::string &dir, bool create, mode_t dirMode)
+{
+    auto iter = dirFds_.find(dir);
+    if (iter != dirFds_.end()) {
+        return iter->second;
+    }
+    stats_.openCount++;
+    int fd = TEMP_FAILURE_RETRY(open(dir.c_str(), DIR_OPEN_FLAGS));
+    if (fd < 0 && errno == ENOENT && create && dir != "/" && dir != ".") {
+        std::string parent;
+        std::string name;
+        if (!SplitPath(dir, parent, name)) {
+            return -1;
+        }
+        int parentFd = OpenDir(parent, true, dirMode);
+        if (parentFd < 0) {
+            return -1;
+        }
+        stats_.mkdirCount++;
+        if (TEMP_FAILURE_RETRY(mkdirat(parentFd, name.c_str(), dirMode)) != 0 && errno != EEXIST) {
+            LOGE("mkdirat fail, errno: %{public}d", errno);
+            return -1;
+        }
+        stats_.openCount++;
+        fd = TEMP_FAILURE_RETRY(openat(parentFd, name.c_str(), DIR_OPEN_FLAGS));
+    }
+    if (fd < 0) {
+        LOGE("open dir fail, errno: %{public}d", errno);
+        return -1;
+    }
+    dirFds_.emplace(dir, fd);
+    return fd;
+}
+
+void AssetMovePlanner::CloseDirs()
+{
+    for (auto &[dir, fd] : dirFds_) {
+        close(fd);
+    }
+    dirFds_.clear();
+}
+
+bool AssetMovePlanner::Execute(mode_t dirMode)
+{
+    for (const auto &move : moves_) {
+        if (dirFds_.size() >= MAX_CACHED_DIRS) {
+            CloseDirs();
+        }
+        int dstFd = OpenDir(move.dstDir, true, dirMode);
+        if (dstFd < 0) {
+            return false;
+        }
+        int srcFd = OpenDir(move.srcDir, false, dirMode);
+        if (srcFd < 0) {
+            return false;
+        }
+        stats_.renameCount++;
+        if (TEMP_FAILURE_RETRY(renameat(srcFd, move.srcName.c_str(), dstFd, move.dstName.c_str())) != 0) {
+            LOGE("rename file fail, errno: %{public}d", errno);
+            return false;
+        }
+    }
+    LOGI("asset moved, files: %{public}zu, open: %{public}u, mkdir: %{public}u", moves_.size(),
+        stats_.openCount, stats_.mkdirCount);
+    return true;
+}
+} // namespace DistributedFile
+} // namespace Storage
+} // namespace OHOS
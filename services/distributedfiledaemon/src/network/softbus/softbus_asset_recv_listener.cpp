@@ -27,6 +27,7 @@
 #include "dfs_radar.h"
 #include "radar_report.h"
 #include "ipc_skeleton.h"
+#include "network/softbus/asset_move_planner.h"
 #include "network/softbus/softbus_handler_asset.h"
 #include "os_account_manager.h"
 #include "refbase.h"
@@ -250,8 +251,8 @@ int32_t SoftbusAssetRecvListener::GetCurrentUserId()
 
 bool SoftbusAssetRecvListener::MoveAsset(const std::vector<std::string> &fileList, bool isSingleFile)
 {
-    if (isSingleFile) {
-        std::string oldPath = fileList[0];
+    AssetMovePlanner planner;
+    for (const auto &oldPath : fileList) {
         std::string newPath = oldPath;
         size_t pos = newPath.find(TEMP_DIR);
         if (pos == std::string::npos) {
@@ -259,39 +260,22 @@ bool SoftbusAssetRecvListener::MoveAsset(const std::vector<std::string> &fileLis
             return false;
         }
         newPath.replace(pos, TEMP_DIR.length(), "");
-        pos = newPath.find(ASSET_FLAG_SINGLE);
-        if (pos == std::string::npos) {
-            LOGE("get asset flag fail");
-            return false;
-        }
-        newPath.resize(pos);
-        try {
-            SoftBusHandlerAsset::GetInstance().MkDirRecurse(newPath, S_IRWXU | S_IRWXG | S_IXOTH);
-            std::filesystem::rename(oldPath.c_str(), newPath.c_str());
-        } catch (const std::filesystem::filesystem_error &e) {
-            LOGE("rename file fail, file name is %{public}s", e.what());
-            return false;
+        if (isSingleFile) {
+            pos = newPath.find(ASSET_FLAG_SINGLE);
+            if (pos == std::string::npos) {
+                LOGE("get asset flag fail");
+                return false;
+            }
+            newPath.resize(pos);
         }
-        return true;
-    }
-
-    for (auto oldPath : fileList) {
-        std::string newPath = oldPath;
-        size_t pos = newPath.find(TEMP_DIR);
-        if (pos == std::string::npos) {
-            LOGE("get asset temp dir fail");
+        if (!planner.AddMove(oldPath, newPath)) {
             return false;
         }
-        newPath.replace(pos, TEMP_DIR.length(), "");
-        try {
-            SoftBusHandlerAsset::GetInstance().MkDirRecurse(newPath, S_IRWXU | S_IRWXG | S_IXOTH);
-            std::filesystem::rename(oldPath.c_str(), newPath.c_str());
-        } catch (const std::filesystem::filesystem_error &e) {
-            LOGE("rename file fail, file name is %{public}s", e.what());
-            return false;
+        if (isSingleFile) {
+            break;
         }
     }
-    return true;
+    return planner.Execute(S_IRWXU | S_IRWXG | S_IXOTH);
 }
 
 bool SoftbusAssetRecvListener::RemoveAsset(const std::string &file)
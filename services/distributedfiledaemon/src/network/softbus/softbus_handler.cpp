@@ -42,33 +42,19 @@ const int32_t DFS_QOS_TYPE_MAX_LATENCY = 10000;
 const int32_t DFS_QOS_TYPE_MIN_LATENCY = 2000;
 const int32_t INVALID_SESSION_ID = -1;
 constexpr size_t MAX_SIZE = 500;
-std::mutex SoftBusHandler::clientSessNameMapMutex_;
-std::map<int32_t, std::string> SoftBusHandler::clientSessNameMap_;
-std::mutex SoftBusHandler::serverIdMapMutex_;
-std::map<std::string, int32_t> SoftBusHandler::serverIdMap_;
-std::mutex SoftBusHandler::networkIdMapMutex_;
-std::map<int32_t, std::string> SoftBusHandler::networkIdMap_;
+SoftBusSocketRegistry SoftBusHandler::registry_;
 void SoftBusHandler::OnSinkSessionOpened(int32_t sessionId, PeerSocketInfo info)
 {
     if (!SoftBusPermissionCheck::IsSameAccount(info.networkId)) {
-        std::lock_guard<std::mutex> lock(serverIdMapMutex_);
-        auto it = serverIdMap_.find(info.name);
-        if (it != serverIdMap_.end()) {
-            Shutdown(it->second);
-            serverIdMap_.erase(it);
+        int32_t serverId = INVALID_SESSION_ID;
+        if (registry_.RemoveServer(info.name, serverId)) {
+            Shutdown(serverId);
             LOGI("RemoveSessionServer success.");
         }
         Shutdown(sessionId);
         return;
     }
-    {
-        std::lock_guard<std::mutex> lock(SoftBusHandler::clientSessNameMapMutex_);
-        SoftBusHandler::clientSessNameMap_.insert(std::make_pair(sessionId, info.name));
-    }
-    {
-        std::lock_guard<std::mutex> lock(networkIdMapMutex_);
-        networkIdMap_.insert(std::make_pair(sessionId, info.networkId));
-    }
+    registry_.AddSocket(sessionId, info.name, info.networkId);
 
     AllConnectManager::GetInstance().PublishServiceState(DfsConnectCode::COPY_FILE, info.networkId,
         ServiceCollaborationManagerBussinessStatus::SCM_CONNECTED);
@@ -77,10 +63,7 @@ void SoftBusHandler::OnSinkSessionOpened(int32_t sessionId, PeerSocketInfo info)
 std::string SoftBusHandler::GetSessionName(int32_t sessionId)
 {
     std::string sessionName = "";
-    std::lock_guard<std::mutex> lock(clientSessNameMapMutex_);
-    auto iter = clientSessNameMap_.find(sessionId);
-    if (iter != clientSessNameMap_.end()) {
-        sessionName = iter->second;
+    if (registry_.GetSessionName(sessionId, sessionName)) {
         return sessionName;
     }
     LOGE("sessionName not registered");
@@ -158,10 +141,7 @@ int32_t SoftBusHandler::CreateSessionServer(const std::string &packageName, cons
         Shutdown(socketId);
         return FileManagement::ERR_BAD_VALUE;
     }
-    {
-        std::lock_guard<std::mutex> lock(serverIdMapMutex_);
-        serverIdMap_.insert(std::make_pair(sessionName, socketId));
-    }
+    registry_.AddServer(sessionName, socketId);
     DistributedFile::SoftBusFileReceiveListener::SetRecvPath(physicalPath);
     LOGI("CreateSessionServer success socketId = %{public}d", socketId);
     return socketId;
@@ -205,14 +185,7 @@ int32_t SoftBusHandler::OpenSession(const std::string &mySessionName, const std:
         Shutdown(socketId);
         return ret;
     }
-    {
-        std::lock_guard<std::mutex> lock(clientSessNameMapMutex_);
-        clientSessNameMap_.insert(std::make_pair(socketId, mySessionName));
-    }
-    {
-        std::lock_guard<std::mutex> lock(networkIdMapMutex_);
-        networkIdMap_.insert(std::make_pair(socketId, peerDevId));
-    }
+    registry_.AddSocket(socketId, mySessionName, peerDevId);
     LOGI("OpenSession success socketId = %{public}d", socketId);
     return E_OK;
 }
@@ -320,28 +293,23 @@ void SoftBusHandler::CloseSession(int32_t sessionId, const std::string sessionNa
         LOGI("sessionName is empty");
         return;
     }
-    if (!serverIdMap_.empty()) {
-        std::lock_guard<std::mutex> lock(serverIdMapMutex_);
-        auto it = serverIdMap_.find(sessionName);
-        if (it != serverIdMap_.end()) {
-            int32_t serverId = it->second;
-            serverIdMap_.erase(it);
-            Shutdown(serverId);
-            LOGI("RemoveSessionServer success.");
-        }
+    int32_t serverId = INVALID_SESSION_ID;
+    if (registry_.RemoveServer(sessionName, serverId)) {
+        Shutdown(serverId);
+        LOGI("RemoveSessionServer success.");
     }
-    if (!clientSessNameMap_.empty()) {
-        std::lock_guard<std::mutex> lock(clientSessNameMapMutex_);
-        auto it = clientSessNameMap_.find(sessionId);
-        if (it != clientSessNameMap_.end()) {
-            clientSessNameMap_.erase(it->first);
-        }
+    std::string idlePeer;
+    if (!registry_.RemoveSocket(sessionId, idlePeer)) {
+        LOGE("socketId not find, socket is %{public}d", sessionId);
     }
     {
         std::lock_guard<std::mutex> lock(socketMutex_);
         Shutdown(sessionId);
     }
-    RemoveNetworkId(sessionId);
+    if (!idlePeer.empty()) {
+        AllConnectManager::GetInstance().PublishServiceState(DfsConnectCode::COPY_FILE, idlePeer,
+            ServiceCollaborationManagerBussinessStatus::SCM_IDLE);
+    }
     SoftBusSessionPool::GetInstance().DeleteSessionInfo(sessionName);
 }
 
@@ -353,39 +321,11 @@ void SoftBusHandler::CloseSessionWithSessionName(const std::string sessionName)
         return;
     }
     int32_t sessionId = INVALID_SESSION_ID;
-    if (!clientSessNameMap_.empty()) {
-        std::lock_guard<std::mutex> lock(clientSessNameMapMutex_);
-        for (auto it : SoftBusHandler::clientSessNameMap_) {
-            if (it.second == sessionName) {
-                sessionId = it.first;
-                clientSessNameMap_.erase(it.first);
-                break;
-            }
-        }
-    }
+    registry_.GetFirstSocket(sessionName, sessionId);
     TransManager::GetInstance().NotifyFileFailed(sessionName, E_DFS_CANCEL_SUCCESS);
     TransManager::GetInstance().DeleteTransTask(sessionName);
     CloseSession(sessionId, sessionName);
 }
-void SoftBusHandler::RemoveNetworkId(int32_t socketId)
-{
-    LOGI("RemoveNetworkId begin");
-    std::lock_guard<std::mutex> lock(networkIdMapMutex_);
-    auto it = networkIdMap_.find(socketId);
-    if (it == networkIdMap_.end()) {
-        LOGE("socketId not find, socket is %{public}d", socketId);
-        return;
-    }
-    std::string peerNetworkId = it->second;
-    networkIdMap_.erase(it->first);
-    for (auto &item : networkIdMap_) {
-        if (item.second == peerNetworkId) {
-            return;
-        }
-    }
-    AllConnectManager::GetInstance().PublishServiceState(DfsConnectCode::COPY_FILE, peerNetworkId,
-        ServiceCollaborationManagerBussinessStatus::SCM_IDLE);
-}
 
 std::vector<int32_t> SoftBusHandler::GetsocketIdFromPeerNetworkId(const std::string &peerNetworkId)
 {
@@ -393,25 +333,12 @@ std::vector<int32_t> SoftBusHandler::GetsocketIdFromPeerNetworkId(const std::str
         LOGE("peerNetworkId is empty");
         return {};
     }
-    std::vector<int32_t> socketIdList;
-    std::lock_guard<std::mutex> lock(networkIdMapMutex_);
-    for (auto item : networkIdMap_) {
-        if (item.second == peerNetworkId) {
-            socketIdList.emplace_back(item.first);
-        }
-    }
-
-    return socketIdList;
+    return registry_.GetSocketsByNetworkId(peerNetworkId);
 }
 
 bool SoftBusHandler::IsService(std::string &sessionName)
 {
-    std::lock_guard<std::mutex> lock(serverIdMapMutex_);
-    auto it = serverIdMap_.find(sessionName);
-    if (it == serverIdMap_.end()) {
-        return false;
-    }
-    return true;
+    return registry_.HasServer(sessionName);
 }
 
 void SoftBusHandler::CopyOnStop(const std::string &peerNetworkId)
@@ -44,7 +44,7 @@ namespace OHOS {
 namespace Storage {
 namespace DistributedFile {
 using namespace OHOS::FileManagement;
-constexpr size_t MAX_SIZE = 500;
+constexpr size_t MAX_SIZE = SoftBusHandlerAsset::MAX_SEND_FILE_NUM;
 constexpr size_t BUFFER_SIZE = 512;
 const int32_t DFS_QOS_TYPE_MIN_BW = 90 * 1024 * 1024;
 const int32_t DFS_QOS_TYPE_MAX_LATENCY = 10000;
@@ -218,6 +218,22 @@ int32_t SoftBusHandlerAsset::AssetBind(const std::string &dstNetworkId, int32_t
 
 int32_t SoftBusHandlerAsset::AssetSendFile(int32_t socketId, const std::string& sendFile, bool isSingleFile)
 {
+    return SendAssetFiles(socketId, {sendFile}, isSingleFile);
+}
+
+int32_t SoftBusHandlerAsset::AssetSendFiles(int32_t socketId, const std::vector<std::string> &sendFiles)
+{
+    return SendAssetFiles(socketId, sendFiles, true);
+}
+
+int32_t SoftBusHandlerAsset::SendAssetFiles(int32_t socketId,
+                                            const std::vector<std::string> &sendFiles,
+                                            bool isSingleFile)
+{
+    if (sendFiles.empty() || sendFiles.size() > MAX_SIZE) {
+        LOGE("invalid send file num %{public}zu", sendFiles.size());
+        return ERR_BAD_VALUE;
+    }
     auto assetObj = GetAssetObj(socketId);
     if (assetObj == nullptr) {
         LOGE("get assetObj fail.");
@@ -228,24 +244,31 @@ int32_t SoftBusHandlerAsset::AssetSendFile(int32_t socketId, const std::string&
         return ERR_BAD_VALUE;
     }
 
-    const char *src[MAX_SIZE] = {};
-    src[0] = sendFile.c_str();
-
-    auto dstFile = GetDstFile(sendFile, assetObj->srcBundleName_,
-                              assetObj->dstBundleName_, assetObj->sessionId_, isSingleFile);
-    if (dstFile.empty()) {
-        LOGE("GetFileName failed or file is empty");
-        return ERR_BAD_VALUE;
-    }
-    if (!FileSizeUtils::IsFilePathValid(dstFile) || !FileSizeUtils::IsFilePathValid(sendFile)) {
-        LOGE("path traversal detected, dstFile or sendFile is invalid");
-        return ERR_BAD_VALUE;
+    // every file keeps its own single file name, the receiver moves them one by one from the temp dir
+    std::vector<std::string> dstFiles;
+    dstFiles.reserve(sendFiles.size());
+    for (const auto &sendFile : sendFiles) {
+        auto dstFile = GetDstFile(sendFile, assetObj->srcBundleName_,
+                                  assetObj->dstBundleName_, assetObj->sessionId_, isSingleFile);
+        if (dstFile.empty()) {
+            LOGE("GetFileName failed or file is empty");
+            return ERR_BAD_VALUE;
+        }
+        if (!FileSizeUtils::IsFilePathValid(dstFile) || !FileSizeUtils::IsFilePathValid(sendFile)) {
+            LOGE("path traversal detected, dstFile or sendFile is invalid");
+            return ERR_BAD_VALUE;
+        }
+        dstFiles.emplace_back(std::move(dstFile));
     }
+    const char *src[MAX_SIZE] = {};
     const char *dst[MAX_SIZE] = {};
-    dst[0] = dstFile.c_str();
+    for (size_t i = 0; i < sendFiles.size(); i++) {
+        src[i] = sendFiles[i].c_str();
+        dst[i] = dstFiles[i].c_str();
+    }
 
-    LOGI("AssetSendFile Enter.");
-    int32_t ret = ::SendFile(socketId, src, dst, 1);
+    LOGI("AssetSendFile Enter, file num %{public}zu.", sendFiles.size());
+    int32_t ret = ::SendFile(socketId, src, dst, static_cast<uint32_t>(sendFiles.size()));
     if (ret != E_OK) {
         LOGE("SendFile failed, sessionId = %{public}d", socketId);
         RadarParaInfo info = {"AssetSendFile", ReportLevel::INNER, DfxBizStage::PUSH_ASSERT,
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "network/softbus/softbus_socket_registry.h"
+
+#include <mutex>
+
+namespace OHOS {
+namespace Storage {
+namespace DistributedFile {
+void SoftBusSocketRegistry::AddServer(const std::string &sessionName, int32_t serverId)
+{
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    servers_.emplace(sessionName, serverId);
+}
+
+bool SoftBusSocketRegistry::RemoveServer(const std::string &sessionName, int32_t &serverId)
+{
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto iter = servers_.find(sessionName);
+    if (iter == servers_.end()) {
+        return false;
+    }
+    serverId = iter->second;
+    servers_.erase(iter);
+    return true;
+}
+
+bool SoftBusSocketRegistry::HasServer(const std::string &sessionName)
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return servers_.find(sessionName) != servers_.end();
+}
+
+size_t SoftBusSocketRegistry::ServerCount()
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return servers_.size();
+}
+
+void SoftBusSocketRegistry::Unindex(SocketIndex &index, const std::string &key, int32_t socketId)
+{
+    auto iter = index.find(key);
+    if (iter == index.end()) {
+        return;
+    }
+    iter->second.erase(socketId);
+    if (iter->second.empty()) {
+        index.erase(iter);
+    }
+}
+
+void SoftBusSocketRegistry::EraseSocketLocked(std::unordered_map<int32_t, SocketEntry>::iterator iter)
+{
+    Unindex(sessionIndex_, iter->second.sessionName, iter->first);
+    Unindex(networkIndex_, iter->second.networkId, iter->first);
+    sockets_.erase(iter);
+}
+
+void SoftBusSocketRegistry::AddSocket(int32_t socketId, const std::string &sessionName,
+    const std::string &networkId)
+{
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto iter = sockets_.find(socketId);
+    if (iter != sockets_.end()) {
+        // softbus hands out a closed socket id again, the stale entry must not keep its old indexes
+        EraseSocketLocked(iter);
+    }
+    sockets_.emplace(socketId, SocketEntry{sessionName, networkId});
+    if (!sessionName.empty()) {
+        sessionIndex_[sessionName].insert(socketId);
+    }
+    if (!networkId.empty()) {
+        networkIndex_[networkId].insert(socketId);
+    }
+}
+
+bool SoftBusSocketRegistry::RemoveSocket(int32_t socketId, std::string &idlePeer)
+{
+    idlePeer.clear();
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto iter = sockets_.find(socketId);
+    if (iter == sockets_.end()) {
+        return false;
+    }
+    std::string networkId = iter->second.networkId;
+    EraseSocketLocked(iter);
+    if (!networkId.empty() && networkIndex_.find(networkId) == networkIndex_.end()) {
+        idlePeer = std::move(networkId);
+    }
+    return true;
+}
+
+bool SoftBusSocketRegistry::GetSessionName(int32_t socketId, std::string &sessionName)
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto iter = sockets_.find(socketId);
+    if (iter == sockets_.end()) {
+        return false;
+    }
+    sessionName = iter->second.sessionName;
+    return true;
+}
+
+bool SoftBusSocketRegistry::GetFirstSocket(const std::string &sessionName, int32_t &socketId)
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto iter = sessionIndex_.find(sessionName);
+    if (iter == sessionIndex_.end()) {
+        return false;
+    }
+    socketId = *iter->second.begin();
+    return true;
+}
+
+std::vector<int32_t> SoftBusSocketRegistry::GetSocketsByNetworkId(const std::string &networkId)
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto iter = networkIndex_.find(networkId);
+    if (iter == networkIndex_.end()) {
+        return {};
+    }
+    return std::vector<int32_t>(iter->second.begin(), iter->second.end());
+}
+
+size_t SoftBusSocketRegistry::SocketCount()
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return sockets_.size();
+}
+
+void SoftBusSocketRegistry::Clear()
+{
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    servers_.clear();
+    sockets_.clear();
+    sessionIndex_.clear();
+    networkIndex_.clear();
+}
+} // namespace DistributedFile
+} // namespace Storage
+} // namespace OHOS
@@ -53,6 +53,14 @@ int32_t SoftBusHandlerAsset::AssetSendFile(int32_t socketId, const std::string &
     return ISoftBusHandlerAssetMock::iSoftBusHandlerAssetMock_->AssetSendFile(socketId, sendFile, isSingleFile);
 }
 
+int32_t SoftBusHandlerAsset::AssetSendFiles(int32_t socketId, const std::vector<std::string> &sendFiles)
+{
+    if (ISoftBusHandlerAssetMock::iSoftBusHandlerAssetMock_ == nullptr) {
+        return -1;
+    }
+    return ISoftBusHandlerAssetMock::iSoftBusHandlerAssetMock_->AssetSendFiles(socketId, sendFiles);
+}
+
 void SoftBusHandlerAsset::CloseAssetBind(int32_t socketId)
 {
     return;
@@ -87,10 +87,6 @@ void SoftBusHandler::CloseSessionWithSessionName(const std::string sessionName)
 {
     return;
 }
-void SoftBusHandler::RemoveNetworkId(int32_t socketId)
-{
-    return;
-}
 
 std::vector<int32_t> SoftBusHandler::GetsocketIdFromPeerNetworkId(const std::string &peerNetworkId)
 {
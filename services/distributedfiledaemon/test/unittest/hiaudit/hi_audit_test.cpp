@@ -20,6 +20,8 @@
 #include <fstream>
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <thread>
+#include <vector>
 
 using namespace testing;
 using namespace testing::ext;
@@ -39,6 +41,7 @@ constexpr int ERROR_GET_HANDLE = 1002;
 constexpr int HIVIEW_UID = 1201;
 constexpr int LOG_UID = 1007;
 constexpr int INVALID_FD = -1;
+const std::string DAEMON_LOG_NAME = std::string(DAEMON_PATH) + "distributedfiledaemon_audit.csv";
 
 class HiAuditTest : public testing::Test {
 public:
@@ -79,6 +82,33 @@ void RollBackDir()
     }
 }
 
+void StartNewAuditFile()
+{
+    ForceCreateDirectory(DAEMON_PATH);
+    AuditLog auditLog = { false, 1, "SUCC", "DFS", "StartNewAuditFile", "SUCCESS" };
+    HiAudit::GetInstance().Flush();
+    HiAudit::GetInstance().writeLogSize_ = MAX_LOG_FILE_SIZE;
+    HiAudit::GetInstance().Write(auditLog);
+    HiAudit::GetInstance().Flush();
+}
+
+int CountAuditLines(const std::string &marker, std::string &firstLine)
+{
+    std::ifstream logFile(DAEMON_LOG_NAME);
+    std::string line;
+    int count = 0;
+    firstLine.clear();
+    while (std::getline(logFile, line)) {
+        if (firstLine.empty()) {
+            firstLine = line;
+        }
+        if (line.find(marker) != std::string::npos) {
+            ++count;
+        }
+    }
+    return count;
+}
+
 /**
  * @tc.number: HiAudit_Write_001
  * @tc.name: HiAudit_Write_001
@@ -93,8 +123,10 @@ HWTEST_F(HiAuditTest, HiAudit_Write_001, TestSize.Level1)
         GTEST_LOG_(INFO) << "HiauditTest HiAudit_Write_001 write num: " << zipFileNum;
         while (HiAudit::GetInstance().writeLogSize_ <  MAX_LOG_FILE_SIZE) {
             HiAudit::GetInstance().Write(auditLog);
+            HiAudit::GetInstance().Flush();
         }
         HiAudit::GetInstance().Write(auditLog);
+        HiAudit::GetInstance().Flush();
         EXPECT_GT(HiAudit::GetInstance().writeLogSize_, 0);
         EXPECT_GT(HiAudit::GetInstance().writeFd_, 0);
         ++zipFileNum;
@@ -102,6 +134,7 @@ HWTEST_F(HiAuditTest, HiAudit_Write_001, TestSize.Level1)
     std::string extendStr = std::string(MAX_INPUT_CONTENT_SIZE, 'A');
     auditLog.extend = extendStr;
     HiAudit::GetInstance().Write(auditLog);
+    HiAudit::GetInstance().Flush();
     if (HiAudit::GetInstance().writeFd_ > 0) {
         fdsan_close_with_tag(HiAudit::GetInstance().writeFd_, LOG_DOMAIN);
         HiAudit::GetInstance().writeFd_ = INVALID_FD;
@@ -144,19 +177,23 @@ HWTEST_F(HiAuditTest, HiAudit_CleanOldAuditFile_001, TestSize.Level1)
 }
 
 /**
- * @tc.number: HiAudit_ZipAuditLog_001
- * @tc.name: HiAudit_ZipAuditLog_001
- * @tc.desc: Verify ZipAuditLog function works correctly
+ * @tc.number: HiAudit_ZipArchivedLog_001
+ * @tc.name: HiAudit_ZipArchivedLog_001
+ * @tc.desc: Verify the rotation rename and ZipArchivedLog work correctly
  */
-HWTEST_F(HiAuditTest, HiAudit_ZipAuditLog_001, TestSize.Level1)
+HWTEST_F(HiAuditTest, HiAudit_ZipArchivedLog_001, TestSize.Level1)
 {
-    GTEST_LOG_(INFO) << "HiauditTest HiAudit_ZipAuditLog_001 start";
-    HiAudit::GetInstance().ZipAuditLog();
-    HiAudit::GetInstance().ZipAuditLog();
+    GTEST_LOG_(INFO) << "HiauditTest HiAudit_ZipArchivedLog_001 start";
+    for (int i = 0; i < 2; i++) {
+        std::string archiveName = HiAudit::GetInstance().RenameAuditLog();
+        if (!archiveName.empty()) {
+            HiAudit::GetInstance().ZipArchivedLog(archiveName);
+        }
+    }
     std::string auditCsvPath = std::string(HIAUDIT_PATH) + "distributedfiledaemon/distributedfiledaemon_audit.csv";
     std::ifstream auditCsvFile(auditCsvPath);
     EXPECT_FALSE(auditCsvFile.good());
-    GTEST_LOG_(INFO) << "HiauditTest HiAudit_ZipAuditLog_001 end";
+    GTEST_LOG_(INFO) << "HiauditTest HiAudit_ZipArchivedLog_001 end";
 }
 
 /**
@@ -261,23 +298,23 @@ HWTEST_F(HiAuditTest, HiAudit_WriteToFile_001, TestSize.Level1)
 }
 
 /**
- * @tc.number: HiAudit_ZipAuditLog_002
- * @tc.name: HiAudit_ZipAuditLog_002
- * @tc.desc: Verify ZipAuditLog function works correctly
+ * @tc.number: HiAudit_ZipArchivedLog_002
+ * @tc.name: HiAudit_ZipArchivedLog_002
+ * @tc.desc: Verify the rotation rename fails without the log directory and nothing is zipped
  */
-HWTEST_F(HiAuditTest, HiAudit_ZipAuditLog_002, TestSize.Level1)
+HWTEST_F(HiAuditTest, HiAudit_ZipArchivedLog_002, TestSize.Level1)
 {
-    GTEST_LOG_(INFO) << "HiauditTest HiAudit_ZipAuditLog_002 start";
+    GTEST_LOG_(INFO) << "HiauditTest HiAudit_ZipArchivedLog_002 start";
     if (!ForceRemoveDirectoryBMS(HIAUDIT_PATH)) {
-        GTEST_LOG_(INFO) << "HiAudit_ZipAuditLog_002 ForceRemoveDirectoryBMS testPath failed!";
+        GTEST_LOG_(INFO) << "HiAudit_ZipArchivedLog_002 ForceRemoveDirectoryBMS testPath failed!";
     }
-    HiAudit::GetInstance().ZipAuditLog();
+    EXPECT_TRUE(HiAudit::GetInstance().RenameAuditLog().empty());
     EXPECT_TRUE(HiAudit::GetInstance().writeFd_ == INVALID_FD);
     std::string logPath = std::string(HIAUDIT_PATH) + "distributedfiledaemon";
     DIR* dir = opendir(logPath.c_str());
     EXPECT_EQ(dir, nullptr);
     RollBackDir();
-    GTEST_LOG_(INFO) << "HiauditTest HiAudit_ZipAuditLog_002 end";
+    GTEST_LOG_(INFO) << "HiauditTest HiAudit_ZipArchivedLog_002 end";
 }
 
 /**
@@ -374,6 +411,7 @@ HWTEST_F(HiAuditTest, HiAudit_WriteStart_001, TestSize.Level1)
     GTEST_LOG_(INFO) << "HiAudit_WriteStart_001 start";
     std::string funcName = "TestFunction";
     EXPECT_NO_FATAL_FAILURE(HiAudit::GetInstance().WriteStart(funcName));
+    HiAudit::GetInstance().Flush();
     if (HiAudit::GetInstance().writeFd_ > 0) {
         fdsan_close_with_tag(HiAudit::GetInstance().writeFd_, LOG_DOMAIN);
         HiAudit::GetInstance().writeFd_ = INVALID_FD;
@@ -392,6 +430,7 @@ HWTEST_F(HiAuditTest, HiAudit_WriteEnd_001, TestSize.Level1)
     std::string funcName = "TestFunction";
     int32_t ret = 0;
     EXPECT_NO_FATAL_FAILURE(HiAudit::GetInstance().WriteEnd(funcName, ret));
+    HiAudit::GetInstance().Flush();
     if (HiAudit::GetInstance().writeFd_ > 0) {
         fdsan_close_with_tag(HiAudit::GetInstance().writeFd_, LOG_DOMAIN);
         HiAudit::GetInstance().writeFd_ = INVALID_FD;
@@ -410,6 +449,7 @@ HWTEST_F(HiAuditTest, HiAudit_WriteEnd_002, TestSize.Level1)
     std::string funcName = "TestFunction";
     int32_t ret = -1;
     EXPECT_NO_FATAL_FAILURE(HiAudit::GetInstance().WriteEnd(funcName, ret));
+    HiAudit::GetInstance().Flush();
     if (HiAudit::GetInstance().writeFd_ > 0) {
         fdsan_close_with_tag(HiAudit::GetInstance().writeFd_, LOG_DOMAIN);
         HiAudit::GetInstance().writeFd_ = INVALID_FD;
@@ -428,6 +468,7 @@ HWTEST_F(HiAuditTest, HiAudit_Write_002, TestSize.Level1)
     HiAudit::GetInstance().writeLogSize_ = 0;
     AuditLog auditLog = { false, 1, "FAILED TO Mount", "ADD", "Mount", "FAIL" };
     EXPECT_NO_FATAL_FAILURE(HiAudit::GetInstance().Write(auditLog));
+    HiAudit::GetInstance().Flush();
     if (HiAudit::GetInstance().writeFd_ > 0) {
         fdsan_close_with_tag(HiAudit::GetInstance().writeFd_, LOG_DOMAIN);
         HiAudit::GetInstance().writeFd_ = INVALID_FD;
@@ -446,6 +487,7 @@ HWTEST_F(HiAuditTest, HiAudit_Write_003, TestSize.Level1)
     AuditLog auditLog = { false, 1, "FAILED TO Mount", "ADD", "Mount", "FAIL" };
     auditLog.extend = std::string(3 * 1024, 'A');
     EXPECT_NO_FATAL_FAILURE(HiAudit::GetInstance().Write(auditLog));
+    HiAudit::GetInstance().Flush();
     if (HiAudit::GetInstance().writeFd_ > 0) {
         fdsan_close_with_tag(HiAudit::GetInstance().writeFd_, LOG_DOMAIN);
         HiAudit::GetInstance().writeFd_ = INVALID_FD;
@@ -488,6 +530,96 @@ HWTEST_F(HiAuditTest, HiAudit_ZipUtils_GetFileHandle_001, TestSize.Level1)
     EXPECT_EQ(ret, ERROR_GET_HANDLE);
     GTEST_LOG_(INFO) << "HiAudit_ZipUtils_GetFileHandle_001 end";
 }
+
+/**
+ * @tc.number: HiAudit_Flush_001
+ * @tc.name: HiAudit_Flush_001
+ * @tc.desc: Verify records of concurrent writers all reach the file after Flush, in the old line format
+ */
+HWTEST_F(HiAuditTest, HiAudit_Flush_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "HiAudit_Flush_001 start";
+    StartNewAuditFile();
+    constexpr int threadNum = 4;
+    constexpr int recordNum = 1000;
+    uint64_t droppedBefore = HiAudit::GetInstance().droppedCount_.load();
+    std::vector<std::thread> writers;
+    for (int t = 0; t < threadNum; ++t) {
+        writers.emplace_back([] {
+            AuditLog auditLog = { false, 1, "SUCC", "DFS", "HiAudit_Flush_001", "SUCCESS" };
+            for (int i = 0; i < recordNum; ++i) {
+                HiAudit::GetInstance().Write(auditLog);
+            }
+        });
+    }
+    for (auto &writer : writers) {
+        writer.join();
+    }
+    HiAudit::GetInstance().Flush();
+    uint64_t dropped = HiAudit::GetInstance().droppedCount_.load() - droppedBefore;
+    std::string firstLine;
+    int count = CountAuditLines(", distributedfiledaemon, NO, SUCC, 0, DFS, HiAudit_Flush_001, SUCCESS, 1, ",
+        firstLine);
+    EXPECT_EQ(static_cast<uint64_t>(count) + dropped, threadNum * recordNum);
+    EXPECT_EQ(dropped, 0);
+    EXPECT_EQ(firstLine + "\n", AuditLog().TitleString());
+    GTEST_LOG_(INFO) << "HiAudit_Flush_001 end";
+}
+
+/**
+ * @tc.number: HiAudit_Rotate_001
+ * @tc.name: HiAudit_Rotate_001
+ * @tc.desc: Verify a full file is rotated by the writer thread and the new file starts with the title
+ */
+HWTEST_F(HiAuditTest, HiAudit_Rotate_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "HiAudit_Rotate_001 start";
+    StartNewAuditFile();
+    AuditLog auditLog = { false, 1, "SUCC", "DFS", "HiAudit_Rotate_001_old", "SUCCESS" };
+    HiAudit::GetInstance().Write(auditLog);
+    HiAudit::GetInstance().Flush();
+    HiAudit::GetInstance().writeLogSize_ = MAX_LOG_FILE_SIZE;
+    auditLog.operationScenario = "HiAudit_Rotate_001_new";
+    HiAudit::GetInstance().Write(auditLog);
+    HiAudit::GetInstance().Flush();
+    std::string firstLine;
+    EXPECT_EQ(CountAuditLines("HiAudit_Rotate_001_old", firstLine), 0);
+    EXPECT_EQ(CountAuditLines("HiAudit_Rotate_001_new", firstLine), 1);
+    EXPECT_EQ(firstLine + "\n", AuditLog().TitleString());
+    EXPECT_LT(HiAudit::GetInstance().writeLogSize_, MAX_LOG_FILE_SIZE);
+    int zipFileNum = GetDirZipFileNum();
+    EXPECT_GT(zipFileNum, 0);
+    EXPECT_LE(zipFileNum, MAX_ZIP_NUM);
+    GTEST_LOG_(INFO) << "HiAudit_Rotate_001 end";
+}
+
+/**
+ * @tc.number: HiAudit_WriteBenchmark_001
+ * @tc.name: HiAudit_WriteBenchmark_001
+ * @tc.desc: Measure the cost of Write on the caller thread, the disk work is left to the writer thread
+ * @tc.type: PERF
+ */
+HWTEST_F(HiAuditTest, HiAudit_WriteBenchmark_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "HiAudit_WriteBenchmark_001 start";
+    StartNewAuditFile();
+    constexpr int recordNum = 2000;
+    AuditLog auditLog = { false, 1, "SUCC", "DFS", "HiAudit_WriteBenchmark_001", "SUCCESS" };
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < recordNum; ++i) {
+        HiAudit::GetInstance().Write(auditLog);
+    }
+    auto writeCost = std::chrono::steady_clock::now() - begin;
+    HiAudit::GetInstance().Flush();
+    auto flushCost = std::chrono::steady_clock::now() - begin;
+    std::string firstLine;
+    EXPECT_EQ(CountAuditLines("HiAudit_WriteBenchmark_001", firstLine), recordNum);
+    GTEST_LOG_(INFO) << "records: " << recordNum << ", write ns per record: "
+                     << std::chrono::duration_cast<std::chrono::nanoseconds>(writeCost).count() / recordNum
+                     << ", until flushed us: "
+                     << std::chrono::duration_cast<std::chrono::microseconds>(flushCost).count();
+    GTEST_LOG_(INFO) << "HiAudit_WriteBenchmark_001 end";
+}
 } // namespace DistributedFile
 } // namespace Storage
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -24,6 +24,7 @@
 #include "device_manager_impl.h"
 #include "dfs_error.h"
 #include "network/devsl_dispatcher.h"
+#include "network/softbus/softbus_asset_send_listener.h"
 #include "sandbox_helper.h"
 #include "softbus_handler_asset_mock.h"
 #include "softbus_handler_mock.h"
@@ -380,6 +381,37 @@ HWTEST_F(DaemonExecuteTest, DaemonExecute_HandleZip_001, TestSize.Level1)
     GTEST_LOG_(INFO) << "DaemonExecute_HandleZip_001 end";
 }
 
+/**
+ * @tc.name: DaemonExecute_PushAssetStream_001
+ * @tc.desc: verify PushAssetStream sends all files in one transfer without a zip.
+ * @tc.type: FUNC
+ * @tc.require: I7TDJK
+ */
+HWTEST_F(DaemonExecuteTest, DaemonExecute_PushAssetStream_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "DaemonExecute_PushAssetStream_001 begin";
+    sptr<AssetObj> assetObj(new (std::nothrow) AssetObj());
+    ASSERT_TRUE(assetObj != nullptr) << "assetObj assert failed!";
+    ASSERT_NE(daemonExecute_, nullptr);
+    assetObj->srcBundleName_ = "com.example.app";
+    assetObj->sessionId_ = "0";
+    std::vector<std::string> fileList = {
+        "/mnt/hmdfs/100/account/device_view/local/data/com.example.app/docs/1.txt",
+        "/mnt/hmdfs/100/account/device_view/local/data/com.example.app/docs/2.txt",
+    };
+
+    EXPECT_CALL(*softBusHandlerAssetMock_, CompressFile(_, _, _)).Times(0);
+    EXPECT_CALL(*softBusHandlerAssetMock_, AssetSendFiles(_, fileList)).WillOnce(Return(-1));
+    daemonExecute_->PushAssetStream(0, fileList, assetObj);
+    EXPECT_FALSE(SoftBusAssetSendListener::GetIsZipFile(assetObj->srcBundleName_ + assetObj->sessionId_));
+
+    EXPECT_CALL(*softBusHandlerAssetMock_, AssetSendFiles(_, fileList)).WillOnce(Return(E_OK));
+    daemonExecute_->PushAssetStream(0, fileList, assetObj);
+    EXPECT_FALSE(SoftBusAssetSendListener::GetIsZipFile(assetObj->srcBundleName_ + assetObj->sessionId_));
+    SoftBusAssetSendListener::RemoveFileMap(assetObj->srcBundleName_ + assetObj->sessionId_);
+    GTEST_LOG_(INFO) << "DaemonExecute_PushAssetStream_001 end";
+}
+
 /**
  * @tc.name: DaemonExecute_PrepareSessionInner_001
  * @tc.desc: verify PrepareSessionInner.
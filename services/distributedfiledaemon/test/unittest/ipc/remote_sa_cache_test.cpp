@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "daemon_mock.h"
+#include "remote_sa_cache.h"
+
+namespace OHOS::Storage::DistributedFile::Test {
+using namespace testing;
+using namespace testing::ext;
+using namespace std;
+
+namespace {
+const string NETWORK_ID = "remoteSaCacheNetworkId";
+
+class RemoteObjectMock : public IRemoteObject {
+public:
+    RemoteObjectMock() : IRemoteObject(u"remote_sa_cache_test") {}
+    MOCK_METHOD(int32_t, GetObjectRefCount, (), (override));
+    MOCK_METHOD(int, SendRequest, (uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option),
+        (override));
+    MOCK_METHOD(bool, IsProxyObject, (), (const, override));
+    MOCK_METHOD(bool, AddDeathRecipient, (const sptr<DeathRecipient> &recipient), (override));
+    MOCK_METHOD(bool, RemoveDeathRecipient, (const sptr<DeathRecipient> &recipient), (override));
+    MOCK_METHOD(int, Dump, (int fd, const std::vector<std::u16string> &args), (override));
+};
+
+/* Stands in for the proxy samgr hands out for a remote daemon. */
+class RemoteDaemonMock : public DaemonMock {
+public:
+    explicit RemoteDaemonMock(const sptr<IRemoteObject> &object) : object_(object) {}
+    sptr<IRemoteObject> AsObject() override
+    {
+        return object_;
+    }
+
+private:
+    sptr<IRemoteObject> object_;
+};
+} // namespace
+
+class RemoteSaCacheTest : public testing::Test {
+public:
+    void SetUp()
+    {
+        RemoteSaCache::GetInstance().Clear();
+    }
+    void TearDown()
+    {
+        RemoteSaCache::GetInstance().Clear();
+    }
+};
+
+/*
+ * @tc.name: GetOrLoadTest001
+ * @tc.desc: Verify that a peer is loaded once until it is invalidated.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RemoteSaCacheTest, GetOrLoadTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GetOrLoadTest001 Start";
+    sptr<DaemonMock> daemon = new (std::nothrow) DaemonMock();
+    ASSERT_NE(daemon, nullptr);
+    int32_t loadCount = 0;
+    auto loader = [&daemon, &loadCount](const string &networkId) -> sptr<IDaemon> {
+        loadCount++;
+        return daemon;
+    };
+    auto &cache = RemoteSaCache::GetInstance();
+    EXPECT_EQ(cache.GetOrLoad(NETWORK_ID, loader), daemon);
+    EXPECT_EQ(cache.GetOrLoad(NETWORK_ID, loader), daemon);
+    EXPECT_EQ(loadCount, 1);
+    EXPECT_EQ(cache.Size(), 1);
+
+    cache.Invalidate(NETWORK_ID);
+    EXPECT_EQ(cache.Size(), 0);
+    EXPECT_EQ(cache.GetOrLoad(NETWORK_ID, loader), daemon);
+    EXPECT_EQ(loadCount, 2);
+    GTEST_LOG_(INFO) << "GetOrLoadTest001 End";
+}
+
+/*
+ * @tc.name: GetOrLoadTest002
+ * @tc.desc: Verify that a failed load is not cached.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RemoteSaCacheTest, GetOrLoadTest002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GetOrLoadTest002 Start";
+    int32_t loadCount = 0;
+    auto loader = [&loadCount](const string &networkId) -> sptr<IDaemon> {
+        loadCount++;
+        return nullptr;
+    };
+    auto &cache = RemoteSaCache::GetInstance();
+    EXPECT_EQ(cache.GetOrLoad(NETWORK_ID, loader), nullptr);
+    EXPECT_EQ(cache.GetOrLoad(NETWORK_ID, loader), nullptr);
+    EXPECT_EQ(cache.GetOrLoad(NETWORK_ID, nullptr), nullptr);
+    EXPECT_EQ(loadCount, 2);
+    EXPECT_EQ(cache.Size(), 0);
+    GTEST_LOG_(INFO) << "GetOrLoadTest002 End";
+}
+
+/*
+ * @tc.name: RemoteDiedTest001
+ * @tc.desc: Verify that the death of a cached proxy drops it and a stale death notify is ignored.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RemoteSaCacheTest, RemoteDiedTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "RemoteDiedTest001 Start";
+    sptr<RemoteObjectMock> object = new (std::nothrow) RemoteObjectMock();
+    sptr<RemoteObjectMock> staleObject = new (std::nothrow) RemoteObjectMock();
+    ASSERT_NE(object, nullptr);
+    ASSERT_NE(staleObject, nullptr);
+    sptr<IRemoteObject::DeathRecipient> recipient;
+    EXPECT_CALL(*object, IsProxyObject()).WillRepeatedly(Return(true));
+    EXPECT_CALL(*object, AddDeathRecipient(_)).WillOnce(DoAll(SaveArg<0>(&recipient), Return(true)));
+    EXPECT_CALL(*object, RemoveDeathRecipient(_)).WillRepeatedly(Return(true));
+    sptr<RemoteDaemonMock> daemon = new (std::nothrow) RemoteDaemonMock(object);
+    ASSERT_NE(daemon, nullptr);
+
+    auto &cache = RemoteSaCache::GetInstance();
+    auto loader = [&daemon](const string &networkId) -> sptr<IDaemon> { return daemon; };
+    EXPECT_EQ(cache.GetOrLoad(NETWORK_ID, loader), daemon);
+    ASSERT_NE(recipient, nullptr);
+    EXPECT_EQ(cache.Size(), 1);
+
+    recipient->OnRemoteDied(wptr<IRemoteObject>(staleObject));
+    EXPECT_EQ(cache.Size(), 1);
+    recipient->OnRemoteDied(wptr<IRemoteObject>(object));
+    EXPECT_EQ(cache.Size(), 0);
+    GTEST_LOG_(INFO) << "RemoteDiedTest001 End";
+}
+
+/*
+ * @tc.name: RemoteDiedTest002
+ * @tc.desc: Verify that a proxy whose death can not be watched is returned but not cached.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RemoteSaCacheTest, RemoteDiedTest002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "RemoteDiedTest002 Start";
+    sptr<RemoteObjectMock> object = new (std::nothrow) RemoteObjectMock();
+    ASSERT_NE(object, nullptr);
+    EXPECT_CALL(*object, IsProxyObject()).WillRepeatedly(Return(true));
+    EXPECT_CALL(*object, AddDeathRecipient(_)).WillRepeatedly(Return(false));
+    sptr<RemoteDaemonMock> daemon = new (std::nothrow) RemoteDaemonMock(object);
+    ASSERT_NE(daemon, nullptr);
+
+    auto &cache = RemoteSaCache::GetInstance();
+    auto loader = [&daemon](const string &networkId) -> sptr<IDaemon> { return daemon; };
+    EXPECT_EQ(cache.GetOrLoad(NETWORK_ID, loader), daemon);
+    EXPECT_EQ(cache.Size(), 0);
+    GTEST_LOG_(INFO) << "RemoteDiedTest002 End";
+}
+} // namespace OHOS::Storage::DistributedFile::Test
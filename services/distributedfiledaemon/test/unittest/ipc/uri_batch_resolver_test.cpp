@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "dfs_error.h"
+#include "sandbox_helper.h"
+#include "uri_batch_resolver.h"
+
+namespace {
+const std::string BUNDLE_NAME = "com.example.app";
+const std::string APP_URI_PREFIX = "file://com.example.app/data/storage/el2/base";
+std::atomic<int32_t> g_getPhysicalPathCount{0};
+} // namespace
+
+namespace OHOS::AppFileService {
+int32_t SandboxHelper::GetPhysicalPath(const std::string &fileUri, const std::string &userId, std::string &physicalPath)
+{
+    g_getPhysicalPathCount++;
+    if (fileUri.find("bad") != std::string::npos) {
+        return OHOS::FileManagement::E_INVAL_ARG;
+    }
+    if (fileUri.compare(0, APP_URI_PREFIX.size(), APP_URI_PREFIX) == 0) {
+        physicalPath = "/data/app/el2/" + userId + "/base/" + BUNDLE_NAME + fileUri.substr(APP_URI_PREFIX.size());
+        return OHOS::FileManagement::E_OK;
+    }
+    return OHOS::FileManagement::E_INVAL_ARG;
+}
+
+bool SandboxHelper::CheckValidPath(const std::string &filePath)
+{
+    return filePath.find("..") == std::string::npos;
+}
+} // namespace OHOS::AppFileService
+
+namespace OHOS::Storage::DistributedFile::Utils {
+bool IsFolder(const std::string &name)
+{
+    return name.find("folder") != std::string::npos;
+}
+} // namespace OHOS::Storage::DistributedFile::Utils
+
+namespace OHOS::Storage::DistributedFile::Test {
+using namespace testing::ext;
+using namespace std;
+using UriState = UriBatchResolver::UriState;
+
+namespace {
+constexpr int32_t USER_ID = 100;
+constexpr size_t FILES_PER_DIR = 300;
+
+vector<string> MakeAppUris(const vector<string> &dirs)
+{
+    vector<string> uris;
+    for (const auto &dir : dirs) {
+        for (size_t i = 0; i < FILES_PER_DIR; i++) {
+            uris.push_back(APP_URI_PREFIX + "/" + dir + "/" + to_string(i) + ".jpg");
+        }
+    }
+    return uris;
+}
+} // namespace
+
+class UriBatchResolverTest : public testing::Test {
+public:
+    void SetUp()
+    {
+        g_getPhysicalPathCount = 0;
+    }
+    void TearDown() {};
+};
+
+/*
+ * @tc.name: FindFirstInvalidTest001
+ * @tc.desc: Verify that the lowest rejected index wins whatever order the workers run in.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UriBatchResolverTest, FindFirstInvalidTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FindFirstInvalidTest001 Start";
+    constexpr size_t count = 5000;
+    set<size_t> invalid = {4999, 1200, 3100, 1201};
+    auto isValid = [&invalid](size_t index) { return invalid.count(index) == 0; };
+    for (int32_t round = 0; round < 20; round++) {
+        EXPECT_EQ(UriBatchResolver::FindFirstInvalid(count, isValid), 1200);
+    }
+    EXPECT_EQ(UriBatchResolver::FindFirstInvalid(count, [](size_t) { return true; }), count);
+    EXPECT_EQ(UriBatchResolver::FindFirstInvalid(0, [](size_t) { return false; }), 0);
+    EXPECT_EQ(UriBatchResolver::FindFirstInvalid(10, [](size_t index) { return index != 3 && index != 7; }), 3);
+    GTEST_LOG_(INFO) << "FindFirstInvalidTest001 End";
+}
+
+/*
+ * @tc.name: ResolveFileListTest001
+ * @tc.desc: Verify that files of one directory share a single sandbox lookup and keep their order.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UriBatchResolverTest, ResolveFileListTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ResolveFileListTest001 Start";
+    auto uris = MakeAppUris({"a", "b"});
+    uris.push_back(APP_URI_PREFIX + "/a/%E4%B8%AD.jpg");
+    UriBatchResolver::FileListResult result;
+    UriBatchResolver::ResolveFileList(uris, USER_ID, BUNDLE_NAME, result);
+
+    EXPECT_EQ(result.state, UriState::VALID);
+    ASSERT_EQ(result.physicalPaths.size(), uris.size());
+    EXPECT_EQ(result.physicalPaths[0], "/data/app/el2/100/base/com.example.app/a/0.jpg");
+    EXPECT_EQ(result.physicalPaths[FILES_PER_DIR + 1], "/data/app/el2/100/base/com.example.app/b/1.jpg");
+    // one lookup per directory plus the encoded uri resolved on its own
+    EXPECT_EQ(g_getPhysicalPathCount.load(), 3);
+    GTEST_LOG_(INFO) << "ResolveFileListTest001 End";
+}
+
+/*
+ * @tc.name: ResolveFileListTest002
+ * @tc.desc: Verify that the first failing uri decides the error, as in a serial walk.
+ * @tc.type: FUNC
+ */
+HWTEST_F(UriBatchResolverTest, ResolveFileListTest002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ResolveFileListTest002 Start";
+    auto uris = MakeAppUris({"a", "b"});
+    uris[400] = APP_URI_PREFIX + "/a/folder";
+    uris[500] = "file://com.other.app/data/storage/el2/base/a/1.jpg";
+    UriBatchResolver::FileListResult result;
+    UriBatchResolver::ResolveFileList(uris, USER_ID, BUNDLE_NAME, result);
+    EXPECT_EQ(result.state, UriState::IS_FOLDER);
+    EXPECT_EQ(result.failedIndex, 400);
+    EXPECT_TRUE(result.physicalPaths.empty());
+
+    uris[100] = APP_URI_PREFIX + "/a/../../x.jpg";
+    UriBatchResolver::ResolveFileList(uris, USER_ID, BUNDLE_NAME, result);
+    EXPECT_EQ(result.state, UriState::INVALID_PATH);
+    EXPECT_EQ(result.failedIndex, 100);
+
+    uris[50] = APP_URI_PREFIX + "/bad/1.jpg";
+    UriBatchResolver::ResolveFileList(uris, USER_ID, BUNDLE_NAME, result);
+    EXPECT_EQ(result.state, UriState::RESOLVE_FAILED);
+    EXPECT_EQ(result.failedIndex, 50);
+    EXPECT_EQ(result.resolveRet, OHOS::FileManagement::E_INVAL_ARG);
+
+    uris[10] = "file://com.other.app/data/storage/el2/base/a/1.jpg";
+    UriBatchResolver::ResolveFileList(uris, USER_ID, BUNDLE_NAME, result);
+    EXPECT_EQ(result.state, UriState::BUNDLE_MISMATCH);
+    EXPECT_EQ(result.failedIndex, 10);
+    GTEST_LOG_(INFO) << "ResolveFileListTest002 End";
+}
+} // namespace OHOS::Storage::DistributedFile::Test
@@ -21,6 +21,7 @@
 #include "gtest/gtest.h"
 #include "network/devsl_dispatcher.h"
 #include "network/kernel_talker.h"
+#include "network/security_label_cache.h"
 #include "softbus_bus_center.h"
 #include "utils_log.h"
 
@@ -40,6 +41,20 @@ namespace Test {
 using namespace testing::ext;
 using namespace std;
 
+namespace {
+constexpr time_t OLD_CTIME_SEC = 1000;
+
+struct stat MakeStat(ino_t ino, time_t ctimeSec, long ctimeNsec)
+{
+    struct stat st = {};
+    st.st_dev = 1;
+    st.st_ino = ino;
+    st.st_ctim.tv_sec = ctimeSec;
+    st.st_ctim.tv_nsec = ctimeNsec;
+    return st;
+}
+} // namespace
+
 class DevslDispatcherTest : public testing::Test {
 public:
     static void SetUpTestCase(void) {};
@@ -138,6 +153,60 @@ HWTEST_F(DevslDispatcherTest, DevslDispatcherTest_GetDeviceDevsl_0100, TestSize.
     EXPECT_EQ(DevslDispatcher::GetDeviceDevsl("test"), FileManagement::E_OK);
     GTEST_LOG_(INFO) << "DevslDsispatcherTest_GetDeviceDevsl_0100 end";
 }
+
+/**
+ * @tc.name: DevslDispatcherTest_SecurityLabelCache_0100
+ * @tc.desc: Verify that a cached label is dropped once the ctime of the inode moves.
+ * @tc.type: FUNC
+ * @tc.require: SR000H0387
+ */
+HWTEST_F(DevslDispatcherTest, DevslDispatcherTest_SecurityLabelCache_0100, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "DevslDispatcherTest_SecurityLabelCache_0100 start";
+    auto &cache = SecurityLabelCache::GetInstance();
+    cache.Clear();
+    int32_t label = -1;
+    auto st = MakeStat(10, OLD_CTIME_SEC, 1);
+    EXPECT_FALSE(cache.Lookup(st, label));
+    cache.Store(st, static_cast<int32_t>(SecurityLabel::S2));
+    EXPECT_TRUE(cache.Lookup(st, label));
+    EXPECT_EQ(label, static_cast<int32_t>(SecurityLabel::S2));
+
+    auto relabeled = MakeStat(10, OLD_CTIME_SEC, 2);
+    EXPECT_FALSE(cache.Lookup(relabeled, label));
+    EXPECT_EQ(cache.Size(), 0);
+
+    auto fresh = MakeStat(11, time(nullptr), 0);
+    cache.Store(fresh, static_cast<int32_t>(SecurityLabel::S3));
+    EXPECT_FALSE(cache.Lookup(fresh, label));
+    cache.Clear();
+    GTEST_LOG_(INFO) << "DevslDispatcherTest_SecurityLabelCache_0100 end";
+}
+
+/**
+ * @tc.name: DevslDispatcherTest_SecurityLabelCache_0200
+ * @tc.desc: Verify that the cache stays bounded and evicts the least recently used inode.
+ * @tc.type: FUNC
+ * @tc.require: SR000H0387
+ */
+HWTEST_F(DevslDispatcherTest, DevslDispatcherTest_SecurityLabelCache_0200, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "DevslDispatcherTest_SecurityLabelCache_0200 start";
+    auto &cache = SecurityLabelCache::GetInstance();
+    cache.Clear();
+    const size_t maxEntries = SecurityLabelCache::MAX_ENTRIES;
+    for (size_t i = 0; i < maxEntries; i++) {
+        cache.Store(MakeStat(i, OLD_CTIME_SEC, 0), static_cast<int32_t>(SecurityLabel::S1));
+    }
+    int32_t label = -1;
+    EXPECT_TRUE(cache.Lookup(MakeStat(0, OLD_CTIME_SEC, 0), label));
+    cache.Store(MakeStat(maxEntries, OLD_CTIME_SEC, 0), static_cast<int32_t>(SecurityLabel::S1));
+    EXPECT_EQ(cache.Size(), maxEntries);
+    EXPECT_TRUE(cache.Lookup(MakeStat(0, OLD_CTIME_SEC, 0), label));
+    EXPECT_FALSE(cache.Lookup(MakeStat(1, OLD_CTIME_SEC, 0), label));
+    cache.Clear();
+    GTEST_LOG_(INFO) << "DevslDispatcherTest_SecurityLabelCache_0200 end";
+}
 } // namespace Test
 } // namespace DistributedFile
 } // namespace Storage
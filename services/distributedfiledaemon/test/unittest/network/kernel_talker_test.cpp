@@ -13,8 +13,13 @@
  * limitations under the License.
  */
 
+#include <atomic>
+#include <chrono>
+#include <fcntl.h>
 #include <memory>
+#include <thread>
 #include <unistd.h>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "network/kernel_talker.h"
@@ -43,6 +48,64 @@ enum Notify {
     NOTIFY_CNT,
 };
 
+/* Replays notify records through a pipe, standing in for the hmdfs ctrl node without a kernel module. */
+class FakeNotifyFd {
+public:
+    FakeNotifyFd()
+    {
+        int fds[2] = {-1, -1};
+        if (pipe(fds) == 0) {
+            readFd_ = fds[0];
+            writeFd_ = fds[1];
+            fcntl(readFd_, F_SETFL, fcntl(readFd_, F_GETFL) | O_NONBLOCK);
+        }
+    }
+    ~FakeNotifyFd()
+    {
+        CloseWriter();
+        if (readFd_ >= 0) {
+            close(readFd_);
+        }
+    }
+    int GetReadFd() const
+    {
+        return readFd_;
+    }
+    bool Replay(const vector<NotifyParam> &records)
+    {
+        const char *data = reinterpret_cast<const char *>(records.data());
+        size_t left = records.size() * sizeof(NotifyParam);
+        while (left > 0) {
+            ssize_t ret = write(writeFd_, data, left);
+            if (ret <= 0) {
+                return false;
+            }
+            data += ret;
+            left -= static_cast<size_t>(ret);
+        }
+        return true;
+    }
+    void CloseWriter()
+    {
+        if (writeFd_ >= 0) {
+            close(writeFd_);
+            writeFd_ = -1;
+        }
+    }
+
+private:
+    int readFd_ = -1;
+    int writeFd_ = -1;
+};
+
+NotifyParam MakeNotify(int32_t notify, int32_t fd, const string &cid)
+{
+    NotifyParam param = { .notify = notify, .fd = fd };
+    memset(param.remoteCid, 0, CID_MAX_LEN);
+    memcpy(param.remoteCid, cid.c_str(), min(cid.size(), static_cast<size_t>(CID_MAX_LEN)));
+    return param;
+}
+
 class KernelTalkerTest : public testing::Test {
 public:
     static void SetUpTestCase(void);
@@ -292,6 +355,133 @@ HWTEST_F(KernelTalkerTest, KernelTalkerTest_NotifyHandler_0300, TestSize.Level1)
     EXPECT_TRUE(res == true);
     GTEST_LOG_(INFO) << "KernelTalkerTest_NotifyHandler_0300 end";
 }
+
+/**
+ * @tc.name: KernelTalkerTest_CoalesceNotify_0100
+ * @tc.desc: Verify that repeated notifies of one cid collapse and the order of different notifies is kept.
+ * @tc.type: FUNC
+ * @tc.require: SR000H0387
+ */
+HWTEST_F(KernelTalkerTest, KernelTalkerTest_CoalesceNotify_0100, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "KernelTalkerTest_CoalesceNotify_0100 start";
+    vector<NotifyParam> pending = {
+        MakeNotify(NOTIFY_GET_SESSION, 1, "cidA"),
+        MakeNotify(NOTIFY_GET_SESSION, 2, "cidB"),
+        MakeNotify(NOTIFY_GET_SESSION, 1, "cidA"),
+        MakeNotify(NOTIFY_OFFLINE, 0, "cidA"),
+        MakeNotify(NOTIFY_OFFLINE, 0, "cidA"),
+        MakeNotify(NOTIFY_GET_SESSION, 1, "cidA"),
+        MakeNotify(NOTIFY_GET_SESSION, 3, "cidB"),
+    };
+    KernelTalker::CoalesceNotify(pending);
+    ASSERT_EQ(pending.size(), 5);
+    EXPECT_EQ(pending[0].notify, NOTIFY_GET_SESSION);
+    EXPECT_EQ(string(pending[1].remoteCid), "cidB");
+    EXPECT_EQ(pending[2].notify, NOTIFY_OFFLINE);
+    EXPECT_EQ(pending[3].notify, NOTIFY_GET_SESSION);
+    EXPECT_EQ(string(pending[3].remoteCid), "cidA");
+    EXPECT_EQ(pending[4].fd, 3);
+    GTEST_LOG_(INFO) << "KernelTalkerTest_CoalesceNotify_0100 end";
+}
+
+/**
+ * @tc.name: KernelTalkerTest_HandleAllNotify_0200
+ * @tc.desc: Verify that records queued on a stream fd are drained in batches up to NOTIFY_NONE.
+ * @tc.type: FUNC
+ * @tc.require: SR000H0387
+ */
+HWTEST_F(KernelTalkerTest, KernelTalkerTest_HandleAllNotify_0200, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "KernelTalkerTest_HandleAllNotify_0200 start";
+    int32_t getCount = 0;
+    int32_t offlineCount = 0;
+    auto talker = make_shared<KernelTalker>(g_wmp, [&getCount](NotifyParam &param) { getCount++; },
+        [&offlineCount](const string &cid) { offlineCount++; });
+    FakeNotifyFd fakeFd;
+    ASSERT_GE(fakeFd.GetReadFd(), 0);
+    vector<NotifyParam> records;
+    constexpr int32_t cidCount = 100;
+    for (int32_t i = 0; i < cidCount; i++) {
+        records.push_back(MakeNotify(NOTIFY_GET_SESSION, i, "cid" + to_string(i)));
+    }
+    records.push_back(MakeNotify(NOTIFY_OFFLINE, 0, "cid0"));
+    records.push_back(MakeNotify(NOTIFY_NONE, 0, ""));
+    records.push_back(MakeNotify(NOTIFY_OFFLINE, 0, "cid1"));
+    ASSERT_TRUE(fakeFd.Replay(records));
+
+    talker->HandleAllNotify(fakeFd.GetReadFd());
+    EXPECT_EQ(getCount, cidCount);
+    EXPECT_EQ(offlineCount, 1);
+    GTEST_LOG_(INFO) << "KernelTalkerTest_HandleAllNotify_0200 end";
+}
+
+/**
+ * @tc.name: KernelTalkerTest_NotifyLoop_0100
+ * @tc.desc: Verify that the loop sleeps until a notify arrives and exits at once when woken up.
+ * @tc.type: FUNC
+ * @tc.require: SR000H0387
+ */
+HWTEST_F(KernelTalkerTest, KernelTalkerTest_NotifyLoop_0100, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "KernelTalkerTest_NotifyLoop_0100 start";
+    atomic<int32_t> offlineCount{0};
+    auto talker = make_shared<KernelTalker>(g_wmp, [](NotifyParam &param) {},
+        [&offlineCount](const string &cid) { offlineCount++; });
+    FakeNotifyFd fakeFd;
+    ASSERT_GE(fakeFd.GetReadFd(), 0);
+    thread loop(&KernelTalker::NotifyLoop, talker.get(), fakeFd.GetReadFd(), POLLIN);
+
+    ASSERT_TRUE(fakeFd.Replay({ MakeNotify(NOTIFY_OFFLINE, 0, "cid0") }));
+    for (int32_t i = 0; i < 1000 && offlineCount.load() == 0; i++) {
+        this_thread::sleep_for(chrono::milliseconds(1));
+    }
+    EXPECT_EQ(offlineCount.load(), 1);
+
+    auto begin = chrono::steady_clock::now();
+    talker->isRunning_ = false;
+    talker->WakeUpPollThread();
+    loop.join();
+    auto cost = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - begin).count();
+    EXPECT_LT(cost, 100);
+    GTEST_LOG_(INFO) << "KernelTalkerTest_NotifyLoop_0100 end";
+}
+
+/**
+ * @tc.name: KernelTalkerTest_NotifyBenchmark_0100
+ * @tc.desc: Measure notify throughput of the poll loop fed by a fake notify fd.
+ * @tc.type: PERF
+ * @tc.require: SR000H0387
+ */
+HWTEST_F(KernelTalkerTest, KernelTalkerTest_NotifyBenchmark_0100, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "KernelTalkerTest_NotifyBenchmark_0100 start";
+    constexpr int32_t recordCount = 100000;
+    constexpr int32_t cidCount = 16;
+    constexpr int32_t burstSize = 256;
+    atomic<int32_t> handled{0};
+    auto talker = make_shared<KernelTalker>(g_wmp, [&handled](NotifyParam &param) { handled++; },
+        [&handled](const string &cid) { handled++; });
+    FakeNotifyFd fakeFd;
+    ASSERT_GE(fakeFd.GetReadFd(), 0);
+    vector<NotifyParam> records;
+    records.reserve(recordCount);
+    for (int32_t i = 0; i < recordCount; i++) {
+        int32_t notify = (i / burstSize) % 2 == 0 ? NOTIFY_GET_SESSION : NOTIFY_OFFLINE;
+        records.push_back(MakeNotify(notify, i % cidCount, "cid" + to_string(i % cidCount)));
+    }
+
+    auto begin = chrono::steady_clock::now();
+    thread loop(&KernelTalker::NotifyLoop, talker.get(), fakeFd.GetReadFd(), POLLIN);
+    ASSERT_TRUE(fakeFd.Replay(records));
+    fakeFd.CloseWriter();
+    loop.join();
+    auto cost = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - begin).count();
+    EXPECT_GT(handled.load(), 0);
+    EXPECT_LE(handled.load(), recordCount);
+    GTEST_LOG_(INFO) << "notify records: " << recordCount << ", handled: " << handled.load() << ", cost us: " << cost;
+    GTEST_LOG_(INFO) << "KernelTalkerTest_NotifyBenchmark_0100 end";
+}
 } // namespace Test
 } // namespace DistributedFile
 } // namespace Storage
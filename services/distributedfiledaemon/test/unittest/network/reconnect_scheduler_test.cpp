@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <vector>
+
+#include "dfs_error.h"
+#include "network/network_agent_template.h"
+#include "network/reconnect_scheduler.h"
+
+namespace OHOS::Storage::DistributedFile::Test {
+using namespace testing::ext;
+using namespace std;
+using Clock = chrono::steady_clock;
+
+namespace {
+constexpr int USER_ID = 100;
+const string CID = "reconnectSchedulerCid";
+
+BackoffPolicy TestPolicy()
+{
+    BackoffPolicy policy;
+    policy.maxAttempts = 6;
+    policy.baseDelay = chrono::milliseconds(20);
+    policy.maxDelay = chrono::milliseconds(160);
+    policy.jitterPercent = 20;
+    return policy;
+}
+
+/* A session layer whose link comes back at a fixed time, attempts before that fail. */
+class FakeLink {
+public:
+    explicit FakeLink(chrono::milliseconds downTime) : usableAt_(Clock::now() + downTime) {}
+    bool TryOpen()
+    {
+        lock_guard<mutex> lock(mutex_);
+        attempts_++;
+        if (Clock::now() < usableAt_) {
+            return false;
+        }
+        if (!recovered_) {
+            recovered_ = true;
+            recoveredAt_ = Clock::now();
+            cv_.notify_all();
+        }
+        return true;
+    }
+    bool WaitRecovered(chrono::milliseconds timeout)
+    {
+        unique_lock<mutex> lock(mutex_);
+        return cv_.wait_for(lock, timeout, [this] { return recovered_; });
+    }
+    chrono::milliseconds RecoveryLatency()
+    {
+        lock_guard<mutex> lock(mutex_);
+        return chrono::duration_cast<chrono::milliseconds>(recoveredAt_ - usableAt_);
+    }
+    int32_t Attempts()
+    {
+        lock_guard<mutex> lock(mutex_);
+        return attempts_;
+    }
+
+private:
+    mutex mutex_;
+    condition_variable cv_;
+    Clock::time_point usableAt_;
+    Clock::time_point recoveredAt_;
+    bool recovered_ = false;
+    int32_t attempts_ = 0;
+};
+
+class FakeNetworkAgent : public NetworkAgentTemplate {
+public:
+    FakeNetworkAgent(weak_ptr<MountPoint> mountPoint, FakeLink &link) : NetworkAgentTemplate(mountPoint), link_(link)
+    {
+    }
+
+protected:
+    void JoinDomain() override {}
+    void QuitDomain() override {}
+    void StopTopHalf() override {}
+    void StopBottomHalf() override {}
+    int32_t OpenSession(const DeviceInfo &info, const uint8_t &linkType) override
+    {
+        return link_.TryOpen() ? FileManagement::E_OK : FileManagement::E_CONTEXT;
+    }
+    void CloseSession(shared_ptr<BaseSession> session) override {}
+
+private:
+    FakeLink &link_;
+};
+} // namespace
+
+class ReconnectSchedulerTest : public testing::Test {
+public:
+    void SetUp() {};
+    void TearDown() {};
+};
+
+/**
+ * @tc.name: ReconnectSchedulerTest_GetBackoffDelay_0100
+ * @tc.desc: Verify that delays double from the base, stay inside the jitter band and are capped.
+ * @tc.type: FUNC
+ * @tc.require: SR000H0387
+ */
+HWTEST_F(ReconnectSchedulerTest, ReconnectSchedulerTest_GetBackoffDelay_0100, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ReconnectSchedulerTest_GetBackoffDelay_0100 start";
+    ReconnectScheduler scheduler([](const string &cid, uint32_t attempt) {}, TestPolicy());
+    EXPECT_EQ(scheduler.GetBackoffDelay(0).count(), 0);
+    for (int32_t round = 0; round < 100; round++) {
+        auto first = scheduler.GetBackoffDelay(1).count();
+        EXPECT_GE(first, 16);
+        EXPECT_LE(first, 24);
+        auto third = scheduler.GetBackoffDelay(3).count();
+        EXPECT_GE(third, 64);
+        EXPECT_LE(third, 96);
+        auto capped = scheduler.GetBackoffDelay(30).count();
+        EXPECT_GE(capped, 128);
+        EXPECT_LE(capped, 192);
+    }
+    GTEST_LOG_(INFO) << "ReconnectSchedulerTest_GetBackoffDelay_0100 end";
+}
+
+/**
+ * @tc.name: ReconnectSchedulerTest_Schedule_0100
+ * @tc.desc: Verify that a reschedule replaces the pending attempt, cancel drops it and the limit is kept.
+ * @tc.type: FUNC
+ * @tc.require: SR000H0387
+ */
+HWTEST_F(ReconnectSchedulerTest, ReconnectSchedulerTest_Schedule_0100, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ReconnectSchedulerTest_Schedule_0100 start";
+    mutex fireMutex;
+    vector<uint32_t> fired;
+    ReconnectScheduler scheduler([&](const string &cid, uint32_t attempt) {
+        lock_guard<mutex> lock(fireMutex);
+        fired.push_back(attempt);
+    }, TestPolicy());
+
+    EXPECT_TRUE(scheduler.Schedule(CID, 3));
+    EXPECT_TRUE(scheduler.Schedule(CID, 1));
+    EXPECT_TRUE(scheduler.Schedule("otherCid", 2));
+    scheduler.Cancel("otherCid");
+    EXPECT_FALSE(scheduler.Schedule(CID + "_", TestPolicy().maxAttempts));
+    this_thread::sleep_for(chrono::milliseconds(200));
+    {
+        lock_guard<mutex> lock(fireMutex);
+        ASSERT_EQ(fired.size(), 1);
+        EXPECT_EQ(fired[0], 1);
+    }
+
+    EXPECT_TRUE(scheduler.Schedule(CID, 4));
+    scheduler.CancelAll();
+    this_thread::sleep_for(chrono::milliseconds(200));
+    lock_guard<mutex> lock(fireMutex);
+    EXPECT_EQ(fired.size(), 1);
+    GTEST_LOG_(INFO) << "ReconnectSchedulerTest_Schedule_0100 end";
+}
+
+/**
+ * @tc.name: ReconnectSchedulerTest_RecoveryLatency_0100
+ * @tc.desc: Measure how long after a link comes back the backoff loop notices it.
+ * @tc.type: PERF
+ * @tc.require: SR000H0387
+ */
+HWTEST_F(ReconnectSchedulerTest, ReconnectSchedulerTest_RecoveryLatency_0100, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ReconnectSchedulerTest_RecoveryLatency_0100 start";
+    for (int32_t downMs : {0, 50, 250}) {
+        FakeLink link((chrono::milliseconds(downMs)));
+        ReconnectScheduler *self = nullptr;
+        ReconnectScheduler scheduler([&link, &self](const string &cid, uint32_t attempt) {
+            if (!link.TryOpen()) {
+                self->Schedule(cid, attempt + 1);
+            }
+        }, TestPolicy());
+        self = &scheduler;
+        ASSERT_TRUE(scheduler.Schedule(CID, 0));
+        ASSERT_TRUE(link.WaitRecovered(chrono::seconds(2)));
+        // the attempt after recovery waits at most one capped delay with its jitter
+        EXPECT_LE(link.RecoveryLatency().count(), 192 + 50);
+        GTEST_LOG_(INFO) << "down ms: " << downMs << ", attempts: " << link.Attempts()
+                         << ", recovery latency ms: " << link.RecoveryLatency().count();
+    }
+    GTEST_LOG_(INFO) << "ReconnectSchedulerTest_RecoveryLatency_0100 end";
+}
+
+/**
+ * @tc.name: ReconnectSchedulerTest_ConnectDeviceByP2PAsync_0100
+ * @tc.desc: Verify that a failed p2p connect returns at once and is retried through the command queue.
+ * @tc.type: FUNC
+ * @tc.require: SR000H0387
+ */
+HWTEST_F(ReconnectSchedulerTest, ReconnectSchedulerTest_ConnectDeviceByP2PAsync_0100, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ReconnectSchedulerTest_ConnectDeviceByP2PAsync_0100 start";
+    auto smp = make_shared<MountPoint>(Utils::DfsuMountArgumentDescriptors::Alpha(USER_ID, "account"));
+    weak_ptr<MountPoint> wmp = smp;
+    FakeLink link(chrono::milliseconds(300));
+    auto agent = make_shared<FakeNetworkAgent>(wmp, link);
+    agent->StartActor();
+
+    DeviceInfo info;
+    info.SetCid(CID);
+    auto begin = Clock::now();
+    agent->ConnectDeviceByP2PAsync(info);
+    EXPECT_LT(chrono::duration_cast<chrono::milliseconds>(Clock::now() - begin).count(), 50);
+    EXPECT_TRUE(link.WaitRecovered(chrono::seconds(5)));
+    EXPECT_GT(link.Attempts(), 1);
+    GTEST_LOG_(INFO) << "attempts: " << link.Attempts() << ", recovery latency ms: "
+                     << link.RecoveryLatency().count();
+    agent->StopActor();
+    GTEST_LOG_(INFO) << "ReconnectSchedulerTest_ConnectDeviceByP2PAsync_0100 end";
+}
+} // namespace OHOS::Storage::DistributedFile::Test
@@ -14,6 +14,7 @@
  */
 
 #include "gtest/gtest.h"
+#include <chrono>
 #include <memory>
 #include <unistd.h>
 
@@ -87,6 +88,48 @@ using namespace std;
 
 constexpr int USER_ID = 100;
 constexpr int TEST_SESSION_ID = 10;
+
+class FakeSession : public BaseSession {
+public:
+    FakeSession(int32_t fd, int sessionId, const std::string &cid, bool isServer)
+        : fd_(fd), sessionId_(sessionId), cid_(cid), isServer_(isServer) {}
+    bool IsFromServer() const override
+    {
+        return isServer_;
+    }
+    std::string GetCid() const override
+    {
+        return cid_;
+    }
+    int32_t GetHandle() const override
+    {
+        return fd_;
+    }
+    int GetSessionId() const override
+    {
+        return sessionId_;
+    }
+    std::array<char, KEY_SIZE_MAX> GetKey() const override
+    {
+        return {};
+    }
+    void Release() const override
+    {
+        released_ = true;
+    }
+    void DisableSessionListener() const override {}
+    bool IsReleased() const
+    {
+        return released_;
+    }
+
+private:
+    int32_t fd_;
+    int sessionId_;
+    std::string cid_;
+    bool isServer_;
+    mutable bool released_ = false;
+};
 class SessionPoolTest : public testing::Test {
 public:
     static void SetUpTestCase(void);
@@ -189,14 +232,14 @@ HWTEST_F(SessionPoolTest, SessionPoolTest_ReleaseSession_Fd_0100, TestSize.Level
     shared_ptr<SessionPool> pool = make_shared<SessionPool>(kernelTalker);
     std::string peerDeviceId = "f6d4c0864707aefte7a78f09473aa122ff57fc8";
     auto session = make_shared<SoftbusSession>(TEST_SESSION_ID,  peerDeviceId);
-    pool->usrSpaceSessionPool_.push_back(nullptr);
+    pool->AddSessionToPool(nullptr);
     pool->ReleaseSession(0);
     EXPECT_EQ(pool->usrSpaceSessionPool_.size(), 1); // 1: session size
 
     pool->ReleaseSession(-1); // -1: session fd
     EXPECT_EQ(pool->usrSpaceSessionPool_.size(), 1); // 1: session size
 
-    pool->usrSpaceSessionPool_.push_back(session);
+    pool->AddSessionToPool(session);
     pool->ReleaseSession(0);
     EXPECT_EQ(pool->usrSpaceSessionPool_.size(), 2); // 2: session size
 
@@ -219,21 +262,21 @@ HWTEST_F(SessionPoolTest, SessionPoolTest_ReleaseSession_Cid_0100, TestSize.Leve
     weak_ptr<MountPoint> wmp = smp;
     auto kernelTalker = std::make_shared<KernelTalker>(wmp, [](NotifyParam &param) {}, [](const std::string &) {});
     shared_ptr<SessionPool> pool = make_shared<SessionPool>(kernelTalker);
-    pool->usrSpaceSessionPool_.push_back(nullptr);
+    pool->AddSessionToPool(nullptr);
 
     std::string peerDeviceId = "f6d4c0864707aefte7a78f09473aa122ff57fc8";
     auto session = make_shared<SoftbusSession>(TEST_SESSION_ID,  peerDeviceId);
     session->SetFromServer(true);
-    pool->usrSpaceSessionPool_.push_back(session);
+    pool->AddSessionToPool(session);
 
     std::string peerDeviceId1 = "f6d4c0864707aefte7a78f09473aa122ff57fc7";
     auto session1 = make_shared<SoftbusSession>(TEST_SESSION_ID, peerDeviceId1);
     session1->SetFromServer(false);
-    pool->usrSpaceSessionPool_.push_back(session1);
+    pool->AddSessionToPool(session1);
 
     auto session2 = make_shared<SoftbusSession>(TEST_SESSION_ID,  peerDeviceId);
     session2->SetFromServer(false);
-    pool->usrSpaceSessionPool_.push_back(session2);
+    pool->AddSessionToPool(session2);
     bool ifReleaseService = false;
     size_t len = 4; // 4: session size;
 
@@ -271,8 +314,8 @@ HWTEST_F(SessionPoolTest, SessionPoolTest_ReleaseAllSession_0100, TestSize.Level
     shared_ptr<SessionPool> pool = make_shared<SessionPool>(kernelTalker);
     std::string peerDeviceId = "f6d4c0864707aefte7a78f09473aa122ff57fc8";
     auto session = make_shared<SoftbusSession>(TEST_SESSION_ID,  peerDeviceId);
-    pool->usrSpaceSessionPool_.push_back(session);
-    pool->usrSpaceSessionPool_.push_back(nullptr);
+    pool->AddSessionToPool(session);
+    pool->AddSessionToPool(nullptr);
 
     bool res = true;
     try {
@@ -335,7 +378,7 @@ HWTEST_F(SessionPoolTest, SessionPoolTest_CheckIfGetSession_0100, TestSize.Level
     bool ret = pool->CheckIfGetSession(fd, isServer);
     EXPECT_EQ(ret, false);
 
-    pool->usrSpaceSessionPool_.push_back(session);
+    pool->AddSessionToPool(session);
     ret = pool->CheckIfGetSession(fd, isServer);
     EXPECT_EQ(ret, true);
     GTEST_LOG_(INFO) << "SessionPoolTest_CheckIfGetSession_0100 end";
@@ -356,7 +399,7 @@ HWTEST_F(SessionPoolTest, SessionPoolTest_SinkOffLine_0100, TestSize.Level1)
     weak_ptr<MountPoint> wmp = smp;
     auto kernelTalker = std::make_shared<KernelTalker>(wmp, [](NotifyParam &param) {}, [](const std::string &) {});
     shared_ptr<SessionPool> pool = make_shared<SessionPool>(kernelTalker);
-    pool->usrSpaceSessionPool_.push_back(session);
+    pool->AddSessionToPool(session);
     pool->SinkOffline(peerDeviceId);
     pool->SinkOffline("test");
     GTEST_LOG_(INFO) << "SessionPoolTest_SinkOffLine_0100 end";
@@ -377,7 +420,7 @@ HWTEST_F(SessionPoolTest, SessionPoolTest_SinkOffLine_0101, TestSize.Level1)
     weak_ptr<MountPoint> wmp = smp;
     auto kernelTalker = std::make_shared<KernelTalker>(wmp, [](NotifyParam &param) {}, [](const std::string &) {});
     shared_ptr<SessionPool> pool = make_shared<SessionPool>(kernelTalker);
-    pool->usrSpaceSessionPool_.push_back(session);
+    pool->AddSessionToPool(session);
     pool->talker_ = nullptr;
     pool->SinkOffline(peerDeviceId);
     pool->SinkOffline("test");
@@ -399,11 +442,11 @@ HWTEST_F(SessionPoolTest, SessionPoolTest_FindSocketId_0100, TestSize.Level1)
     weak_ptr<MountPoint> wmp = smp;
     auto kernelTalker = std::make_shared<KernelTalker>(wmp, [](NotifyParam &param) {}, [](const std::string &) {});
     shared_ptr<SessionPool> pool = make_shared<SessionPool>(kernelTalker);
-    pool->usrSpaceSessionPool_.push_back(nullptr);
+    pool->AddSessionToPool(nullptr);
     bool ret = pool->FindSocketId(TEST_SESSION_ID);
     EXPECT_EQ(ret, false);
 
-    pool->usrSpaceSessionPool_.push_back(session);
+    pool->AddSessionToPool(session);
     ret = pool->FindSocketId(-1); // -1: session id
     EXPECT_EQ(ret, false);
 
@@ -427,8 +470,8 @@ HWTEST_F(SessionPoolTest, SessionPoolTest_FindCid_0100, TestSize.Level1)
     weak_ptr<MountPoint> wmp = smp;
     auto kernelTalker = std::make_shared<KernelTalker>(wmp, [](NotifyParam &param) {}, [](const std::string &) {});
     shared_ptr<SessionPool> pool = make_shared<SessionPool>(kernelTalker);
-    pool->usrSpaceSessionPool_.push_back(nullptr);
-    pool->usrSpaceSessionPool_.push_back(session);
+    pool->AddSessionToPool(nullptr);
+    pool->AddSessionToPool(session);
     bool ret = pool->FindCid("test");
     EXPECT_EQ(ret, false);
 
@@ -436,6 +479,91 @@ HWTEST_F(SessionPoolTest, SessionPoolTest_FindCid_0100, TestSize.Level1)
     EXPECT_EQ(ret, true);
     GTEST_LOG_(INFO) << "SessionPoolTest_FindCid_0100 end";
 }
+
+/**
+ * @tc.name: SessionPoolTest_Index_0100
+ * @tc.desc: Verify that fd, socket id and cid lookups follow every insert and release.
+ * @tc.type: FUNC
+ * @tc.require: SR000H0387
+ */
+HWTEST_F(SessionPoolTest, SessionPoolTest_Index_0100, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SessionPoolTest_Index_0100 start";
+    auto smp = make_shared<MountPoint>(Utils::DfsuMountArgumentDescriptors::Alpha(USER_ID, "account"));
+    weak_ptr<MountPoint> wmp = smp;
+    auto kernelTalker = std::make_shared<KernelTalker>(wmp, [](NotifyParam &param) {}, [](const std::string &) {});
+    shared_ptr<SessionPool> pool = make_shared<SessionPool>(kernelTalker);
+    auto server = make_shared<FakeSession>(100, 1, "cidA", true);
+    auto client = make_shared<FakeSession>(101, 2, "cidA", false);
+    auto other = make_shared<FakeSession>(102, 3, "cidB", false);
+    pool->AddSessionToPool(server);
+    pool->AddSessionToPool(client);
+    pool->AddSessionToPool(other);
+
+    bool isServer = false;
+    EXPECT_FALSE(pool->CheckIfGetSession(100, isServer));
+    EXPECT_TRUE(isServer);
+    EXPECT_TRUE(pool->CheckIfGetSession(101, isServer));
+    EXPECT_FALSE(isServer);
+    EXPECT_TRUE(pool->FindSocketId(2));
+
+    pool->ReleaseSession("cidA", false);
+    EXPECT_TRUE(client->IsReleased());
+    EXPECT_FALSE(server->IsReleased());
+    EXPECT_FALSE(pool->FindSocketId(2));
+    EXPECT_FALSE(pool->CheckIfGetSession(101, isServer));
+    EXPECT_TRUE(pool->FindCid("cidA"));
+
+    pool->ReleaseSession(100);
+    EXPECT_TRUE(server->IsReleased());
+    EXPECT_FALSE(pool->FindCid("cidA"));
+    EXPECT_EQ(pool->usrSpaceSessionPool_.size(), 1);
+    EXPECT_EQ(pool->fdIndex_.size(), 1);
+    EXPECT_EQ(pool->socketIdIndex_.size(), 1);
+    EXPECT_EQ(pool->cidIndex_.size(), 1);
+
+    pool->ReleaseAllSession();
+    EXPECT_TRUE(pool->usrSpaceSessionPool_.empty());
+    EXPECT_TRUE(pool->fdIndex_.empty());
+    EXPECT_FALSE(pool->FindCid("cidB"));
+    GTEST_LOG_(INFO) << "SessionPoolTest_Index_0100 end";
+}
+
+/**
+ * @tc.name: SessionPoolTest_LookupBenchmark_0100
+ * @tc.desc: Measure lookup cost as the pool grows, it should stay flat.
+ * @tc.type: PERF
+ * @tc.require: SR000H0387
+ */
+HWTEST_F(SessionPoolTest, SessionPoolTest_LookupBenchmark_0100, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SessionPoolTest_LookupBenchmark_0100 start";
+    auto smp = make_shared<MountPoint>(Utils::DfsuMountArgumentDescriptors::Alpha(USER_ID, "account"));
+    weak_ptr<MountPoint> wmp = smp;
+    auto kernelTalker = std::make_shared<KernelTalker>(wmp, [](NotifyParam &param) {}, [](const std::string &) {});
+    constexpr int32_t lookupCount = 100000;
+    for (int32_t sessionCount : {16, 256, 4096}) {
+        shared_ptr<SessionPool> pool = make_shared<SessionPool>(kernelTalker);
+        for (int32_t i = 0; i < sessionCount; i++) {
+            pool->AddSessionToPool(make_shared<FakeSession>(i, i, "cid" + to_string(i), i % 2 == 0));
+        }
+        // the last session is the worst case of a linear walk
+        int32_t target = sessionCount - 1;
+        string targetCid = "cid" + to_string(target);
+        int32_t hits = 0;
+        bool isServer = false;
+        auto begin = chrono::steady_clock::now();
+        for (int32_t i = 0; i < lookupCount; i++) {
+            hits += pool->FindSocketId(target) ? 1 : 0;
+            hits += pool->FindCid(targetCid) ? 1 : 0;
+            hits += pool->CheckIfGetSession(target, isServer) ? 1 : 0;
+        }
+        auto cost = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - begin).count();
+        EXPECT_EQ(hits, lookupCount * 3);
+        GTEST_LOG_(INFO) << "sessions: " << sessionCount << ", ns per lookup: " << cost / (lookupCount * 3);
+    }
+    GTEST_LOG_(INFO) << "SessionPoolTest_LookupBenchmark_0100 end";
+}
 } // namespace Test
 } // namespace DistributedFile
 } // namespace Storage
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "network/softbus/asset_move_planner.h"
+
+#include <chrono>
+#include <fcntl.h>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include "network/softbus/softbus_handler_asset.h"
+
+namespace OHOS {
+namespace Storage {
+namespace DistributedFile {
+namespace Test {
+using namespace testing::ext;
+using namespace std;
+
+namespace {
+const string TEST_ROOT = "/data/test/asset_move_planner/";
+const string TEMP_DIR = "ASSET_TEMP/";
+constexpr mode_t DIR_MODE = S_IRWXU | S_IRWXG | S_IXOTH;
+
+/* Lays out a received zip tree under ASSET_TEMP and returns the temp paths of its files. */
+vector<string> MakeAssetTree(const string &root, int32_t dirNum, int32_t filesPerDir)
+{
+    vector<string> fileList;
+    for (int32_t dir = 0; dir < dirNum; dir++) {
+        string dirPath = root + TEMP_DIR + "bundle/files/album/" + to_string(dir) + "/";
+        filesystem::create_directories(dirPath);
+        for (int32_t file = 0; file < filesPerDir; file++) {
+            string filePath = dirPath + "photo_" + to_string(file) + ".jpg";
+            int fd = open(filePath.c_str(), O_CREAT | O_WRONLY, S_IRUSR | S_IWUSR);
+            if (fd >= 0) {
+                close(fd);
+            }
+            fileList.push_back(filePath);
+        }
+    }
+    return fileList;
+}
+
+string TargetPath(const string &tempPath)
+{
+    string target = tempPath;
+    target.replace(target.find(TEMP_DIR), TEMP_DIR.length(), "");
+    return target;
+}
+
+/* access and mkdir calls SoftBusHandlerAsset::MkDirRecurse issues for one file, plus its rename. */
+uint32_t LegacySyscalls(const string &path)
+{
+    uint32_t components = 0;
+    for (size_t index = path.find('/', 1); index != string::npos; index = path.find('/', index + 1)) {
+        components++;
+    }
+    // one access per loop round, the round after the last slash, the final access and the rename
+    return components + 1 + 1 + 1;
+}
+} // namespace
+
+class AssetMovePlannerTest : public testing::Test {
+public:
+    void SetUp()
+    {
+        filesystem::remove_all(TEST_ROOT);
+        filesystem::create_directories(TEST_ROOT);
+    }
+    void TearDown()
+    {
+        filesystem::remove_all(TEST_ROOT);
+    }
+};
+
+/**
+ * @tc.name: AssetMovePlannerTest_Execute_0100
+ * @tc.desc: Verify that files land in their target tree and every directory is created only once.
+ * @tc.type: FUNC
+ * @tc.require: I9JXPR
+ */
+HWTEST_F(AssetMovePlannerTest, AssetMovePlannerTest_Execute_0100, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AssetMovePlannerTest_Execute_0100 start";
+    auto fileList = MakeAssetTree(TEST_ROOT, 3, 20);
+    AssetMovePlanner planner;
+    for (const auto &file : fileList) {
+        ASSERT_TRUE(planner.AddMove(file, TargetPath(file)));
+    }
+    EXPECT_TRUE(planner.Execute(DIR_MODE));
+    for (const auto &file : fileList) {
+        EXPECT_FALSE(filesystem::exists(file));
+        EXPECT_TRUE(filesystem::exists(TargetPath(file)));
+    }
+    // bundle, files, album and the three leaf directories
+    EXPECT_EQ(planner.GetStats().mkdirCount, 6);
+    EXPECT_EQ(planner.GetStats().renameCount, fileList.size());
+    GTEST_LOG_(INFO) << "AssetMovePlannerTest_Execute_0100 end";
+}
+
+/**
+ * @tc.name: AssetMovePlannerTest_Execute_0200
+ * @tc.desc: Verify that invalid paths are refused and a missing source stops the move.
+ * @tc.type: FUNC
+ * @tc.require: I9JXPR
+ */
+HWTEST_F(AssetMovePlannerTest, AssetMovePlannerTest_Execute_0200, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AssetMovePlannerTest_Execute_0200 start";
+    AssetMovePlanner invalid;
+    EXPECT_FALSE(invalid.AddMove(TEST_ROOT + TEMP_DIR, TEST_ROOT));
+    EXPECT_FALSE(invalid.AddMove(TEST_ROOT + "a.txt", ""));
+
+    AssetMovePlanner planner;
+    ASSERT_TRUE(planner.AddMove(TEST_ROOT + TEMP_DIR + "missing.txt", TEST_ROOT + "dst/missing.txt"));
+    EXPECT_FALSE(planner.Execute(DIR_MODE));
+    EXPECT_TRUE(filesystem::is_directory(TEST_ROOT + "dst"));
+    GTEST_LOG_(INFO) << "AssetMovePlannerTest_Execute_0200 end";
+}
+
+/**
+ * @tc.name: AssetMovePlannerTest_Benchmark_0100
+ * @tc.desc: Compare the per file MkDirRecurse and rename loop with the planner on a synthetic asset tree.
+ * @tc.type: PERF
+ * @tc.require: I9JXPR
+ */
+HWTEST_F(AssetMovePlannerTest, AssetMovePlannerTest_Benchmark_0100, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AssetMovePlannerTest_Benchmark_0100 start";
+    constexpr int32_t dirNum = 8;
+    constexpr int32_t filesPerDir = 500;
+
+    auto legacyList = MakeAssetTree(TEST_ROOT + "legacy/", dirNum, filesPerDir);
+    uint32_t legacySyscalls = 0;
+    auto begin = chrono::steady_clock::now();
+    for (const auto &file : legacyList) {
+        string target = TargetPath(file);
+        SoftBusHandlerAsset::GetInstance().MkDirRecurse(target, DIR_MODE);
+        filesystem::rename(file, target);
+        legacySyscalls += LegacySyscalls(target);
+    }
+    auto legacyCost = chrono::steady_clock::now() - begin;
+
+    auto plannedList = MakeAssetTree(TEST_ROOT + "planned/", dirNum, filesPerDir);
+    AssetMovePlanner planner;
+    begin = chrono::steady_clock::now();
+    for (const auto &file : plannedList) {
+        planner.AddMove(file, TargetPath(file));
+    }
+    EXPECT_TRUE(planner.Execute(DIR_MODE));
+    auto plannedCost = chrono::steady_clock::now() - begin;
+    const auto &stats = planner.GetStats();
+    uint32_t plannedSyscalls = stats.openCount + stats.mkdirCount + stats.renameCount;
+    EXPECT_LT(plannedSyscalls, legacySyscalls);
+    EXPECT_TRUE(filesystem::exists(TargetPath(plannedList.back())));
+
+    GTEST_LOG_(INFO) << "files: " << plannedList.size() << ", legacy syscalls: " << legacySyscalls
+                     << ", legacy us: " << chrono::duration_cast<chrono::microseconds>(legacyCost).count()
+                     << ", planned syscalls: " << plannedSyscalls << " (open " << stats.openCount
+                     << ", mkdir " << stats.mkdirCount << ", rename " << stats.renameCount << ")"
+                     << ", planned us: " << chrono::duration_cast<chrono::microseconds>(plannedCost).count();
+    GTEST_LOG_(INFO) << "AssetMovePlannerTest_Benchmark_0100 end";
+}
+} // namespace Test
+} // namespace DistributedFile
+} // namespace Storage
+} // namespace OHOS
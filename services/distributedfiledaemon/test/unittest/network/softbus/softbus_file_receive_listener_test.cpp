@@ -92,10 +92,10 @@ HWTEST_F(SoftBusFileReceiveListenerTest, SoftBusFileReceiveListenerTest_GetLocal
     GTEST_LOG_(INFO) << "SoftBusFileReceiveListenerTest_GetLocalSessionName_0100 start";
     string testSessionName = "mySessionName";
     int32_t sessionId = 1;
-    SoftBusHandler::clientSessNameMap_.insert(std::make_pair(sessionId, testSessionName));
+    SoftBusHandler::registry_.AddSocket(sessionId, testSessionName, "");
     string sessionName = SoftBusFileReceiveListener::GetLocalSessionName(sessionId);
     EXPECT_EQ(sessionName, testSessionName);
-    SoftBusHandler::clientSessNameMap_.erase(sessionId);
+    SoftBusHandler::registry_.Clear();
     sessionName = SoftBusFileReceiveListener::GetLocalSessionName(sessionId);
     EXPECT_EQ(sessionName, "");
     GTEST_LOG_(INFO) << "SoftBusFileReceiveListenerTest_GetLocalSessionName_0100 end";
@@ -120,7 +120,7 @@ HWTEST_F(SoftBusFileReceiveListenerTest, SoftBusFileReceiveListenerTest_OnFile_0
         SoftBusFileReceiveListener::OnFile(socket, nullptr);
         SoftBusFileReceiveListener::OnFile(socket, &event);
 
-        SoftBusHandler::clientSessNameMap_.insert(std::make_pair(socket, "mySessionName"));
+        SoftBusHandler::registry_.AddSocket(socket, "mySessionName", "");
         event.type = FILE_EVENT_RECV_PROCESS;
 
         SoftBusFileReceiveListener::OnFile(socket, &event);
@@ -142,7 +142,7 @@ HWTEST_F(SoftBusFileReceiveListenerTest, SoftBusFileReceiveListenerTest_OnFile_0
         event.type = FILE_EVENT_BUTT;
         SoftBusFileReceiveListener::OnFile(socket, &event);
         EXPECT_TRUE(true);
-        SoftBusHandler::clientSessNameMap_.erase(socket);
+        SoftBusHandler::registry_.Clear();
     } catch (...) {
         EXPECT_TRUE(false);
     }
@@ -161,13 +161,13 @@ HWTEST_F(SoftBusFileReceiveListenerTest, SoftBusFileReceiveListenerTest_OnReceiv
     string testSessionName = "mySessionName";
     int32_t sessionId = 10;
     ShutdownReason reason = SHUTDOWN_REASON_UNKNOWN;
-    SoftBusHandler::clientSessNameMap_.insert(std::make_pair(sessionId, testSessionName));
+    SoftBusHandler::registry_.AddSocket(sessionId, testSessionName, "");
     SoftBusFileReceiveListener::OnReceiveFileShutdown(sessionId, reason);
     sessionId = 2;
-    SoftBusHandler::clientSessNameMap_.insert(std::make_pair(sessionId, testSessionName));
+    SoftBusHandler::registry_.AddSocket(sessionId, testSessionName, "");
     string sessionName = SoftBusFileReceiveListener::GetLocalSessionName(sessionId);
     EXPECT_EQ(sessionName, testSessionName);
-    SoftBusHandler::clientSessNameMap_.erase(sessionId);
+    SoftBusHandler::registry_.Clear();
     GTEST_LOG_(INFO) << "SoftBusFileReceiveListenerTest_OnReceiveFileShutdown_0100 end";
 }
 } // namespace Test
@@ -57,13 +57,13 @@ void SoftBusFileSendListenerTest::TearDownTestCase(void)
 void SoftBusFileSendListenerTest::SetUp(void)
 {
     GTEST_LOG_(INFO) << "SetUp";
-    SoftBusHandler::clientSessNameMap_.insert(std::make_pair(SOCKET_ID, SESSION_NAME));
+    SoftBusHandler::registry_.AddSocket(SOCKET_ID, SESSION_NAME, "");
 }
 
 void SoftBusFileSendListenerTest::TearDown(void)
 {
     GTEST_LOG_(INFO) << "TearDown";
-    SoftBusHandler::clientSessNameMap_.erase(SOCKET_ID);
+    SoftBusHandler::registry_.Clear();
 }
 
 /**
@@ -114,12 +114,11 @@ HWTEST_F(SoftBusFileSendListenerTest, SoftBusFileSendListenerTest_OnSendFileFini
                        .bytesProcessed = 0,
                        .bytesTotal = 1};
 
-    SoftBusHandler::GetInstance().serverIdMap_.insert(std::make_pair(SESSION_NAME, SOCKET_ID));
+    SoftBusHandler::GetInstance().registry_.AddServer(SESSION_NAME, SOCKET_ID);
 
     SoftBusFileSendListener::OnFile(SOCKET_EMPTY, &event);
     SoftBusFileSendListener::OnFile(SOCKET_ID, &event);
-    auto it = SoftBusHandler::GetInstance().serverIdMap_.find(SESSION_NAME);
-    if (it == SoftBusHandler::GetInstance().serverIdMap_.end()) {
+    if (!SoftBusHandler::GetInstance().registry_.HasServer(SESSION_NAME)) {
         EXPECT_TRUE(true);
     } else {
         EXPECT_TRUE(false);
@@ -141,11 +140,10 @@ HWTEST_F(SoftBusFileSendListenerTest, SoftBusFileSendListenerTest_OnFileTransErr
                        .bytesProcessed = 0,
                        .bytesTotal = 1};
 
-    SoftBusHandler::GetInstance().serverIdMap_.insert(std::make_pair(SESSION_NAME, SOCKET_ID));
+    SoftBusHandler::GetInstance().registry_.AddServer(SESSION_NAME, SOCKET_ID);
     SoftBusFileSendListener::OnFile(SOCKET_EMPTY, &event);
     SoftBusFileSendListener::OnFile(SOCKET_ID, &event);
-    auto it = SoftBusHandler::GetInstance().serverIdMap_.find(SESSION_NAME);
-    if (it == SoftBusHandler::GetInstance().serverIdMap_.end()) {
+    if (!SoftBusHandler::GetInstance().registry_.HasServer(SESSION_NAME)) {
         EXPECT_TRUE(true);
     } else {
         EXPECT_TRUE(false);
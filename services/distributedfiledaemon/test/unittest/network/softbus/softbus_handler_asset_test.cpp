@@ -503,6 +503,46 @@ HWTEST_F(SoftBusHandlerAssetTest, SoftBusHandlerAssetTest_AssetSendFile_0200, Te
     GTEST_LOG_(INFO) << "SoftBusHandlerAssetTest_AssetSendFile_0200 end";
 }
 
+/**
+ * @tc.name: SoftBusHandlerAssetTest_AssetSendFiles_0100
+ * @tc.desc: Verify AssetSendFiles checks the file num and sends every file in one SendFile call.
+ * @tc.type: FUNC
+ * @tc.require: I9JXPR
+ */
+HWTEST_F(SoftBusHandlerAssetTest, SoftBusHandlerAssetTest_AssetSendFiles_0100, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SoftBusHandlerAssetTest_AssetSendFiles_0100 start";
+    auto &&softBusHandlerAsset = SoftBusHandlerAsset::GetInstance();
+    std::vector<std::string> files;
+    EXPECT_EQ(softBusHandlerAsset.AssetSendFiles(0, files), ERR_BAD_VALUE);
+    files.assign(SoftBusHandlerAsset::MAX_SEND_FILE_NUM + 1, "demoA/test");
+    EXPECT_EQ(softBusHandlerAsset.AssetSendFiles(0, files), ERR_BAD_VALUE);
+#ifdef SUPPORT_SAME_ACCOUNT
+    sptr<AssetObj> assetObj (new (std::nothrow) AssetObj());
+    assetObj->dstNetworkId_ = "testNetWork";
+    assetObj->srcBundleName_ = "demoA";
+    assetObj->dstBundleName_ = "demoB";
+    assetObj->sessionId_ = "0";
+    softBusHandlerAsset.AddAssetObj(0, assetObj);
+
+    std::vector<DmDeviceInfo> deviceList;
+    deviceInfo.authForm = DmAuthForm::IDENTICAL_ACCOUNT;
+    deviceList.push_back(deviceInfo);
+    files = { "demoA/docs/1.txt", "demoA/docs/sub/2.txt" };
+    EXPECT_CALL(*deviceManagerImplMock_, GetTrustedDeviceList(_, _, _))
+        .WillOnce(DoAll(SetArgReferee<2>(deviceList), Return(0)));
+    EXPECT_CALL(*socketMock_, SendFile(_, _, _, files.size())).WillOnce(Return(E_OK));
+    EXPECT_EQ(softBusHandlerAsset.AssetSendFiles(0, files), E_OK);
+
+    files.push_back("../../../etc/passwd");
+    EXPECT_CALL(*deviceManagerImplMock_, GetTrustedDeviceList(_, _, _))
+        .WillOnce(DoAll(SetArgReferee<2>(deviceList), Return(0)));
+    EXPECT_EQ(softBusHandlerAsset.AssetSendFiles(0, files), ERR_BAD_VALUE);
+    softBusHandlerAsset.RemoveAssetObj(0);
+#endif
+    GTEST_LOG_(INFO) << "SoftBusHandlerAssetTest_AssetSendFiles_0100 end";
+}
+
 /**
  * @tc.name: SoftBusHandlerAssetTest_GetLocalNetworkId_0100
  * @tc.desc: Verify the GetLocalNetworkId function.
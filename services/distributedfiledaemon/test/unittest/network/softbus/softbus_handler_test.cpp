@@ -15,6 +15,8 @@
 #include "network/softbus/softbus_handler.h"
 
 #include "gtest/gtest.h"
+#include <chrono>
+#include <map>
 #include <memory>
 #include <unistd.h>
 #include <utility>
@@ -161,8 +163,7 @@ void SoftbusHandlerTest::SetUp(void)
 void SoftbusHandlerTest::TearDown(void)
 {
     GTEST_LOG_(INFO) << "TearDown";
-    SoftBusHandler::GetInstance().clientSessNameMap_.clear();
-    SoftBusHandler::GetInstance().serverIdMap_.clear();
+    SoftBusHandler::GetInstance().registry_.Clear();
     socketMock_ = nullptr;
     SocketMock::dfsSocket = nullptr;
     deviceManagerImplMock_ = nullptr;
@@ -187,25 +188,25 @@ HWTEST_F(SoftbusHandlerTest, SoftbusHandlerTest_CreateSessionServer_0100, TestSi
     std::string physicalPath = "/data/test";
     EXPECT_CALL(*socketMock_, Socket(_)).WillOnce(Return(-1));
     int32_t result = handler.CreateSessionServer(packageName, sessionName, role, physicalPath);
-    handler.serverIdMap_.erase(sessionName);
+    handler.registry_.Clear();
     EXPECT_EQ(result, ERR_BAD_VALUE);
 
     EXPECT_CALL(*socketMock_, Socket(_)).WillOnce(Return(0));
     EXPECT_CALL(*socketMock_, Listen(_, _, _, _)).WillOnce(Return(-1));
     result = handler.CreateSessionServer(packageName, sessionName, role, physicalPath);
-    handler.serverIdMap_.erase(sessionName);
+    handler.registry_.Clear();
     EXPECT_EQ(result, ERR_BAD_VALUE);
 
     EXPECT_CALL(*socketMock_, Socket(_)).WillOnce(Return(0));
     EXPECT_CALL(*socketMock_, Listen(_, _, _, _)).WillOnce(Return(0));
     result = handler.CreateSessionServer(packageName, sessionName, role, physicalPath);
     EXPECT_EQ(result, E_OK);
-    if (handler.serverIdMap_.find(sessionName) != handler.serverIdMap_.end()) {
+    if (handler.registry_.HasServer(sessionName)) {
         EXPECT_TRUE(true);
     } else {
         EXPECT_TRUE(false);
     }
-    handler.serverIdMap_.erase(sessionName);
+    handler.registry_.Clear();
     EXPECT_EQ(string(SoftBusFileReceiveListener::GetRecvPath()), physicalPath);
     GTEST_LOG_(INFO) << "SoftbusHandlerTest_CreateSessionServer_0100 end";
 }
@@ -287,13 +288,13 @@ HWTEST_F(SoftbusHandlerTest, SoftbusHandlerTest_OpenSession_0100, TestSize.Level
     result = handler.OpenSession(packageName, sessionName, TEST_NETWORKID, socketId);
     EXPECT_EQ(result, 0);
 
-    if (handler.clientSessNameMap_.find(socketId) != handler.clientSessNameMap_.end()) {
+    if (!handler.GetSessionName(socketId).empty()) {
         EXPECT_TRUE(true);
     } else {
         EXPECT_TRUE(false);
     }
 
-    handler.clientSessNameMap_.erase(socketId);
+    handler.registry_.Clear();
 #endif
     GTEST_LOG_(INFO) << "SoftbusHandlerTest_OpenSession_0100 end";
 }
@@ -346,13 +347,13 @@ HWTEST_F(SoftbusHandlerTest, SoftbusHandlerTest_OpenSession_0200, TestSize.Level
     result = handler.OpenSession(packageName, sessionName, TEST_NETWORKID, socketId);
     EXPECT_EQ(result, 0);
 
-    if (handler.clientSessNameMap_.find(socketId) != handler.clientSessNameMap_.end()) {
+    if (!handler.GetSessionName(socketId).empty()) {
         EXPECT_TRUE(true);
     } else {
         EXPECT_TRUE(false);
     }
 
-    handler.clientSessNameMap_.erase(socketId);
+    handler.registry_.Clear();
 #endif
     GTEST_LOG_(INFO) << "SoftbusHandlerTest_OpenSession_0200 end";
 }
@@ -459,11 +460,11 @@ HWTEST_F(SoftbusHandlerTest, SoftbusHandlerTest_GetSessionName_0100, TestSize.Le
     GTEST_LOG_(INFO) << "SoftbusHandlerTest_GetSessionName_0100 start";
     string testSessionName = "mySessionName";
     int32_t sessionId = 1;
-    SoftBusHandler::clientSessNameMap_.insert(std::make_pair(sessionId, testSessionName));
+    SoftBusHandler::registry_.AddSocket(sessionId, testSessionName, "");
     SoftBusHandler handler;
     string sessionName = handler.GetSessionName(sessionId);
     EXPECT_EQ(sessionName, testSessionName);
-    SoftBusHandler::clientSessNameMap_.erase(sessionId);
+    SoftBusHandler::registry_.Clear();
     sessionName = handler.GetSessionName(sessionId);
     EXPECT_EQ(sessionName, "");
     GTEST_LOG_(INFO) << "SoftbusHandlerTest_GetSessionName_0100 end";
@@ -501,8 +502,8 @@ HWTEST_F(SoftbusHandlerTest, SoftbusHandlerTest_OnSinkSessionOpened_0100, TestSi
     };
 
     SoftBusHandler handler;
-    handler.serverIdMap_.clear();
-    handler.serverIdMap_.insert(std::make_pair(sessionName2, 2));
+    handler.registry_.Clear();
+    handler.registry_.AddServer(sessionName2, 2);
 
     std::vector<DmDeviceInfo> deviceList;
     DmDeviceInfo deviceInfo1;
@@ -538,8 +539,7 @@ HWTEST_F(SoftbusHandlerTest, SoftbusHandlerTest_OnSinkSessionOpened_0100, TestSi
     handler.OnSinkSessionOpened(sessionId3, info3);
 
 #ifdef SUPPORT_SAME_ACCOUNT
-    auto iter = handler.serverIdMap_.find(sessionName2);
-    if (iter == handler.serverIdMap_.end()) {
+    if (!handler.registry_.HasServer(sessionName2)) {
         EXPECT_TRUE(true);
     } else {
         EXPECT_TRUE(false);
@@ -549,7 +549,7 @@ HWTEST_F(SoftbusHandlerTest, SoftbusHandlerTest_OnSinkSessionOpened_0100, TestSi
     EXPECT_EQ(handler.GetSessionName(sessionId2), sessionName2);
     EXPECT_EQ(handler.GetSessionName(sessionId3), sessionName3);
 #endif
-    handler.clientSessNameMap_.clear();
+    handler.registry_.Clear();
     GTEST_LOG_(INFO) << "SoftbusHandlerTest_OnSinkSessionOpened_0100 end";
 }
 
@@ -563,8 +563,8 @@ HWTEST_F(SoftbusHandlerTest, SoftbusHandlerTest_CloseSession_0100, TestSize.Leve
 {
     GTEST_LOG_(INFO) << "SoftbusHandlerTest_CloseSession_0100 start";
     string sessionName = "sessionName";
-    SoftBusHandler::GetInstance().serverIdMap_.clear();
-    SoftBusHandler::GetInstance().serverIdMap_.insert(std::make_pair(sessionName, 2));
+    SoftBusHandler::GetInstance().registry_.Clear();
+    SoftBusHandler::GetInstance().registry_.AddServer(sessionName, 2);
     SoftBusSessionPool::SessionInfo sessionInfo1{.sessionId = SESSION_ID_ONE,
                                                  .srcUri = "file://com.demo.a/test/1",
                                                  .dstPath = "/data/test/1",
@@ -577,7 +577,7 @@ HWTEST_F(SoftbusHandlerTest, SoftbusHandlerTest_CloseSession_0100, TestSize.Leve
     SoftBusHandler::GetInstance().CloseSession(1, "sessionName1");
     flag = SoftBusSessionPool::GetInstance().GetSessionInfo(sessionName1, sessionInfo);
     EXPECT_EQ(flag, false);
-    EXPECT_EQ(SoftBusHandler::GetInstance().serverIdMap_.size(), 1);
+    EXPECT_EQ(SoftBusHandler::GetInstance().registry_.ServerCount(), 1);
 
     SoftBusSessionPool::GetInstance().AddSessionInfo(sessionName, sessionInfo1);
     flag = SoftBusSessionPool::GetInstance().GetSessionInfo(sessionName, sessionInfo);
@@ -585,9 +585,9 @@ HWTEST_F(SoftbusHandlerTest, SoftbusHandlerTest_CloseSession_0100, TestSize.Leve
     SoftBusHandler::GetInstance().CloseSession(1, "");
     flag = SoftBusSessionPool::GetInstance().GetSessionInfo(sessionName, sessionInfo);
     EXPECT_EQ(flag, true);
-    EXPECT_EQ(SoftBusHandler::GetInstance().serverIdMap_.size(), 1);
+    EXPECT_EQ(SoftBusHandler::GetInstance().registry_.ServerCount(), 1);
     SoftBusHandler::GetInstance().CloseSession(1, sessionName);
-    EXPECT_EQ(SoftBusHandler::GetInstance().serverIdMap_.size(), 0);
+    EXPECT_EQ(SoftBusHandler::GetInstance().registry_.ServerCount(), 0);
     flag = SoftBusSessionPool::GetInstance().GetSessionInfo(sessionName, sessionInfo);
     EXPECT_EQ(flag, false);
     GTEST_LOG_(INFO) << "SoftbusHandlerTest_CloseSession_0100 end";
@@ -603,13 +603,12 @@ HWTEST_F(SoftbusHandlerTest, SoftbusHandlerTest_CloseSession_0200, TestSize.Leve
 {
     GTEST_LOG_(INFO) << "SoftbusHandlerTest_CloseSession_0200 end";
     string sessionName = "sessionName";
-    SoftBusHandler::serverIdMap_.insert({"testSession", 0});
-    SoftBusHandler::clientSessNameMap_.insert({0, "test"});
+    SoftBusHandler::registry_.AddServer("testSession", 0);
+    SoftBusHandler::registry_.AddSocket(0, "test", "");
     SoftBusHandler::GetInstance().CloseSession(1, sessionName); // 1: testSessionId
-    EXPECT_EQ(SoftBusHandler::serverIdMap_.size(), 1); // 1: size
-    EXPECT_EQ(SoftBusHandler::clientSessNameMap_.size(), 1); // 1: size
-    SoftBusHandler::serverIdMap_.clear();
-    SoftBusHandler::clientSessNameMap_.clear();
+    EXPECT_EQ(SoftBusHandler::registry_.ServerCount(), 1); // 1: size
+    EXPECT_EQ(SoftBusHandler::registry_.SocketCount(), 1); // 1: size
+    SoftBusHandler::registry_.Clear();
     GTEST_LOG_(INFO) << "SoftbusHandlerTest_CloseSession_0200 end";
 }
 
@@ -626,10 +625,9 @@ HWTEST_F(SoftbusHandlerTest, SoftbusHandlerTest_CloseSessionWithSessionName_0100
     SoftBusHandler::GetInstance().CloseSessionWithSessionName("");
 
     string sessionName = "sessionName";
-    SoftBusHandler::GetInstance().serverIdMap_.insert(std::make_pair(sessionName, 2));
+    SoftBusHandler::GetInstance().registry_.AddServer(sessionName, 2);
     SoftBusHandler::GetInstance().CloseSessionWithSessionName(sessionName);
-    auto iter = SoftBusHandler::GetInstance().serverIdMap_.find(sessionName);
-    if (iter == SoftBusHandler::GetInstance().serverIdMap_.end()) {
+    if (!SoftBusHandler::GetInstance().registry_.HasServer(sessionName)) {
         EXPECT_TRUE(false);
     } else {
         EXPECT_TRUE(true);
@@ -646,26 +644,23 @@ HWTEST_F(SoftbusHandlerTest, SoftbusHandlerTest_CloseSessionWithSessionName_0100
 HWTEST_F(SoftbusHandlerTest, SoftbusHandlerTest_CloseSessionWithSessionName_0200, TestSize.Level1)
 {
     string sessionName = "sessionName";
-    SoftBusHandler::GetInstance().clientSessNameMap_.insert(make_pair(2, sessionName));
-    SoftBusHandler::GetInstance().clientSessNameMap_.insert(make_pair(1, "test"));
-    SoftBusHandler::GetInstance().serverIdMap_.insert(std::make_pair(sessionName, 2));
+    SoftBusHandler::GetInstance().registry_.AddSocket(2, sessionName, "");
+    SoftBusHandler::GetInstance().registry_.AddSocket(1, "test", "");
+    SoftBusHandler::GetInstance().registry_.AddServer(sessionName, 2);
     SoftBusHandler::GetInstance().CloseSessionWithSessionName(sessionName);
-    auto iter = SoftBusHandler::GetInstance().serverIdMap_.find(sessionName);
-    if (iter == SoftBusHandler::GetInstance().serverIdMap_.end()) {
+    if (!SoftBusHandler::GetInstance().registry_.HasServer(sessionName)) {
         EXPECT_TRUE(true);
     } else {
         EXPECT_TRUE(false);
     }
 
-    auto iterClient = SoftBusHandler::GetInstance().clientSessNameMap_.find(0);
-    if (iterClient == SoftBusHandler::GetInstance().clientSessNameMap_.end()) {
+    if (SoftBusHandler::GetInstance().GetSessionName(0).empty()) {
         EXPECT_TRUE(true);
     } else {
         EXPECT_TRUE(false);
     }
 
-    iterClient = SoftBusHandler::GetInstance().clientSessNameMap_.find(1);
-    if (iterClient == SoftBusHandler::GetInstance().clientSessNameMap_.end()) {
+    if (SoftBusHandler::GetInstance().GetSessionName(1).empty()) {
         EXPECT_TRUE(false);
     } else {
         EXPECT_TRUE(true);
@@ -704,6 +699,84 @@ HWTEST_F(SoftbusHandlerTest, SoftbusHandlerTest_CopySendFile_0100, TestSize.Leve
     EXPECT_EQ(ret, FileManagement::ERR_BAD_VALUE);
     GTEST_LOG_(INFO) << "SoftbusHandlerTest_CopySendFile_0100 end";
 }
+
+/**
+ * @tc.name: SoftbusHandlerTest_CopyOnStop_0100
+ * @tc.desc: Verify that CopyOnStop only closes the sockets of the stopped peer and keeps the indexes in step.
+ * @tc.type: FUNC
+ * @tc.require: I9JXPR
+ */
+HWTEST_F(SoftbusHandlerTest, SoftbusHandlerTest_CopyOnStop_0100, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SoftbusHandlerTest_CopyOnStop_0100 start";
+    auto &registry = SoftBusHandler::GetInstance().registry_;
+    registry.AddSocket(1, "sessionName1", TEST_NETWORKID);
+    registry.AddSocket(2, "sessionName2", TEST_NETWORKID);
+    registry.AddSocket(3, "sessionName3", TEST_NETWORKID_TWO);
+    EXPECT_EQ(SoftBusHandler::GetInstance().GetsocketIdFromPeerNetworkId(TEST_NETWORKID), vector<int32_t>({1, 2}));
+
+    SoftBusHandler::GetInstance().CopyOnStop(TEST_NETWORKID);
+    EXPECT_TRUE(SoftBusHandler::GetInstance().GetsocketIdFromPeerNetworkId(TEST_NETWORKID).empty());
+    EXPECT_EQ(SoftBusHandler::GetSessionName(1), "");
+    EXPECT_EQ(SoftBusHandler::GetSessionName(3), "sessionName3");
+    EXPECT_EQ(registry.SocketCount(), 1);
+
+    string idlePeer;
+    registry.AddSocket(3, "sessionName4", TEST_NETWORKID_THREE);
+    EXPECT_TRUE(SoftBusHandler::GetInstance().GetsocketIdFromPeerNetworkId(TEST_NETWORKID_TWO).empty());
+    int32_t socketId = -1;
+    EXPECT_FALSE(registry.GetFirstSocket("sessionName3", socketId));
+    EXPECT_TRUE(registry.GetFirstSocket("sessionName4", socketId));
+    EXPECT_EQ(socketId, 3);
+    EXPECT_TRUE(registry.RemoveSocket(3, idlePeer));
+    EXPECT_EQ(idlePeer, TEST_NETWORKID_THREE);
+    EXPECT_FALSE(registry.RemoveSocket(3, idlePeer));
+    GTEST_LOG_(INFO) << "SoftbusHandlerTest_CopyOnStop_0100 end";
+}
+
+/**
+ * @tc.name: SoftbusHandlerTest_PeerLookup_Benchmark_0100
+ * @tc.desc: Compare the peer lookup of the registry with a scan of a socket to network id map.
+ * @tc.type: PERF
+ * @tc.require: I9JXPR
+ */
+HWTEST_F(SoftbusHandlerTest, SoftbusHandlerTest_PeerLookup_Benchmark_0100, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SoftbusHandlerTest_PeerLookup_Benchmark_0100 start";
+    constexpr int32_t peerNum = 256;
+    constexpr int32_t socketsPerPeer = 32;
+    auto &registry = SoftBusHandler::GetInstance().registry_;
+    std::map<int32_t, string> networkIdMap;
+    for (int32_t socketId = 1; socketId <= peerNum * socketsPerPeer; socketId++) {
+        string networkId = TEST_NETWORKID + to_string(socketId % peerNum);
+        registry.AddSocket(socketId, "sessionName" + to_string(socketId), networkId);
+        networkIdMap.emplace(socketId, networkId);
+    }
+
+    size_t scanned = 0;
+    auto begin = chrono::steady_clock::now();
+    for (int32_t peer = 0; peer < peerNum; peer++) {
+        string networkId = TEST_NETWORKID + to_string(peer);
+        for (const auto &item : networkIdMap) {
+            scanned += (item.second == networkId) ? 1 : 0;
+        }
+    }
+    auto scanCost = chrono::steady_clock::now() - begin;
+
+    size_t indexed = 0;
+    begin = chrono::steady_clock::now();
+    for (int32_t peer = 0; peer < peerNum; peer++) {
+        indexed += SoftBusHandler::GetInstance().GetsocketIdFromPeerNetworkId(TEST_NETWORKID + to_string(peer)).size();
+    }
+    auto indexCost = chrono::steady_clock::now() - begin;
+    EXPECT_EQ(indexed, scanned);
+    EXPECT_EQ(indexed, static_cast<size_t>(peerNum * socketsPerPeer));
+
+    GTEST_LOG_(INFO) << "sockets: " << networkIdMap.size() << ", scan us: "
+                     << chrono::duration_cast<chrono::microseconds>(scanCost).count() << ", indexed us: "
+                     << chrono::duration_cast<chrono::microseconds>(indexCost).count();
+    GTEST_LOG_(INFO) << "SoftbusHandlerTest_PeerLookup_Benchmark_0100 end";
+}
 } // namespace Test
 } // namespace DistributedFile
 } // namespace Storage
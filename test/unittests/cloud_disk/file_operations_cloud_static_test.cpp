@@ -951,52 +951,54 @@ HWTEST_F(FileOperationsCloudStaticTest, HandleCloudReopenTest003, TestSize.Level
 }
 
 /**
- * @tc.name: CallBackTest001
- * @tc.desc: Verify the CallBack function
+ * @tc.name: FuseInvalTest001
+ * @tc.desc: Verify the fuse_inval function
  * @tc.type: FUNC
  * @tc.require: I6H5MH
  */
-HWTEST_F(FileOperationsCloudStaticTest, CallBackTest001, TestSize.Level1)
+HWTEST_F(FileOperationsCloudStaticTest, FuseInvalTest001, TestSize.Level1)
 {
-    GTEST_LOG_(INFO) << "CallBackTest001 start";
+    GTEST_LOG_(INFO) << "FuseInvalTest001 start";
     try {
         fuse_session *se = nullptr;
         fuse_ino_t parentIno = 0;
         fuse_ino_t childIno = 0;
         string childName = "";
-        FuseInvalData *fuseInvalData = new FuseInvalData(se, parentIno, childIno, childName);
         EXPECT_CALL(*insMock, fuse_lowlevel_notify_inval_entry(_, _, _, _)).WillOnce(Return(0));
-        CallBack(static_cast<void *>(fuseInvalData));
+        fuse_inval(se, parentIno, childIno, childName);
+        // returns after the tick that may have taken the request is sent
+        FuseInvalDispatcher::GetInstance().Flush();
     } catch (...) {
         EXPECT_TRUE(false);
-        GTEST_LOG_(INFO) << "CallBackTest001 failed";
+        GTEST_LOG_(INFO) << "FuseInvalTest001 failed";
     }
-    GTEST_LOG_(INFO) << "CallBackTest001 end";
+    GTEST_LOG_(INFO) << "FuseInvalTest001 end";
 }
 
 /**
- * @tc.name: CallBackTest002
- * @tc.desc: Verify the CallBack function
+ * @tc.name: FuseInvalTest002
+ * @tc.desc: Verify the fuse_inval function
  * @tc.type: FUNC
  * @tc.require: I6H5MH
  */
-HWTEST_F(FileOperationsCloudStaticTest, CallBackTest002, TestSize.Level1)
+HWTEST_F(FileOperationsCloudStaticTest, FuseInvalTest002, TestSize.Level1)
 {
-    GTEST_LOG_(INFO) << "CallBackTest002 start";
+    GTEST_LOG_(INFO) << "FuseInvalTest002 start";
     try {
         fuse_session *se = nullptr;
         fuse_ino_t parentIno = 0;
         fuse_ino_t childIno = 0;
         string childName = "";
-        FuseInvalData *fuseInvalData = new FuseInvalData(se, parentIno, childIno, childName);
         EXPECT_CALL(*insMock, fuse_lowlevel_notify_inval_entry(_, _, _, _)).WillOnce(Return(1));
         EXPECT_CALL(*insMock, fuse_lowlevel_notify_inval_inode(_, _, _, _)).WillOnce(Return(0));
-        CallBack(static_cast<void *>(fuseInvalData));
+        fuse_inval(se, parentIno, childIno, childName);
+        // returns after the tick that may have taken the request is sent
+        FuseInvalDispatcher::GetInstance().Flush();
     } catch (...) {
         EXPECT_TRUE(false);
-        GTEST_LOG_(INFO) << "CallBackTest002 failed";
+        GTEST_LOG_(INFO) << "FuseInvalTest002 failed";
     }
-    GTEST_LOG_(INFO) << "CallBackTest002 end";
+    GTEST_LOG_(INFO) << "FuseInvalTest002 end";
 }
 
 /**
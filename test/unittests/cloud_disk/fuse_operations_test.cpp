@@ -24,6 +24,7 @@
 #include "file_operations_cloud.h"
 #include "file_operations_helper.h"
 #include "file_operations_base.h"
+#include "file_operations_local.h"
 #include "parameters.h"
 #include "utils_log.h"
 #include "assistant.h"
@@ -85,7 +86,8 @@ HWTEST_F(FuseOperationsTest, LookupTest001, TestSize.Level1)
 {
     GTEST_LOG_(INFO) << "LookupTest001 Start";
     try {
-        fuse_req_t req = nullptr;
+        struct fuse_req fuseReq = {};
+        fuse_req_t req = &fuseReq;
         const char *name = "";
 
         fuseoperations_->Lookup(req, FUSE_ROOT_ID, name);
@@ -109,7 +111,8 @@ HWTEST_F(FuseOperationsTest, LookupTest002, TestSize.Level1)
     try {
         CloudDiskFuseData data;
         EXPECT_CALL(*insMock, fuse_req_userdata(_)).WillOnce(Return(reinterpret_cast<void*>(&data)));
-        fuse_req_t req = nullptr;
+        struct fuse_req fuseReq = {};
+        fuse_req_t req = &fuseReq;
         const char *name = "";
 
         fuseoperations_->Lookup(req, 0, name);
@@ -135,7 +138,8 @@ HWTEST_F(FuseOperationsTest, LookupTest, TestSize.Level1)
         (data.inodeCache)[0] = make_shared<CloudDiskInode>();
         (data.inodeCache)[0]->ops = make_shared<FileOperationsCloud>();
         EXPECT_CALL(*insMock, fuse_req_userdata(_)).WillOnce(Return(reinterpret_cast<void*>(&data)));
-        fuse_req_t req = nullptr;
+        struct fuse_req fuseReq = {};
+        fuse_req_t req = &fuseReq;
         const char *name = RECYCLE_NAME.c_str();
         fuse_ino_t parent = FUSE_ROOT_TWO;
 
@@ -235,7 +239,8 @@ HWTEST_F(FuseOperationsTest, GetAttrTest001, TestSize.Level1)
     try {
         CloudDiskFuseData data;
         EXPECT_CALL(*insMock, fuse_req_userdata(_)).WillOnce(Return(reinterpret_cast<void*>(&data)));
-        fuse_req_t req = nullptr;
+        struct fuse_req fuseReq = {};
+        fuse_req_t req = &fuseReq;
         struct fuse_file_info *fi = nullptr;
 
         fuseoperations_->GetAttr(req, FUSE_ROOT_ID, fi);
@@ -259,7 +264,8 @@ HWTEST_F(FuseOperationsTest, GetAttrTest002, TestSize.Level1)
     try {
         CloudDiskFuseData data;
         EXPECT_CALL(*insMock, fuse_req_userdata(_)).WillOnce(Return(reinterpret_cast<void*>(&data)));
-        fuse_req_t req = nullptr;
+        struct fuse_req fuseReq = {};
+        fuse_req_t req = &fuseReq;
         struct fuse_file_info *fi = nullptr;
 
         fuseoperations_->GetAttr(req, 0, fi);
@@ -286,7 +292,8 @@ HWTEST_F(FuseOperationsTest, GetAttrTest, TestSize.Level1)
         (data.inodeCache)[0]->ops = make_shared<FileOperationsCloud>();
         EXPECT_CALL(*insMock, fuse_req_userdata(_)).WillOnce(Return(reinterpret_cast<void *>(&data)))
                                                    .WillOnce(Return(reinterpret_cast<void *>(&data)));
-        fuse_req_t req = nullptr;
+        struct fuse_req fuseReq = {};
+        fuse_req_t req = &fuseReq;
         fuse_ino_t ino = 0;
         struct fuse_file_info *fi = nullptr;
 
@@ -310,7 +317,8 @@ HWTEST_F(FuseOperationsTest, OpenTest001, TestSize.Level1)
 {
     GTEST_LOG_(INFO) << "OpenTest001 Start";
     try {
-        fuse_req_t req = nullptr;
+        struct fuse_req fuseReq = {};
+        fuse_req_t req = &fuseReq;
         struct fuse_file_info *fi = nullptr;
 
         fuseoperations_->Open(req, FUSE_ROOT_ID, fi);
@@ -334,7 +342,8 @@ HWTEST_F(FuseOperationsTest, OpenTest002, TestSize.Level1)
     try {
         CloudDiskFuseData data;
         EXPECT_CALL(*insMock, fuse_req_userdata(_)).WillOnce(Return(reinterpret_cast<void*>(&data)));
-        fuse_req_t req = nullptr;
+        struct fuse_req fuseReq = {};
+        fuse_req_t req = &fuseReq;
         struct fuse_file_info *fi = nullptr;
 
         fuseoperations_->Open(req, 0, fi);
@@ -361,7 +370,8 @@ HWTEST_F(FuseOperationsTest, OpenTest, TestSize.Level1)
         (data.inodeCache)[0] = make_shared<CloudDiskInode>();
         (data.inodeCache)[0]->ops = make_shared<FileOperationsCloud>();
         EXPECT_CALL(*insMock, fuse_req_userdata(_)).WillRepeatedly(Return(reinterpret_cast<void *>(&data)));
-        fuse_req_t req = nullptr;
+        struct fuse_req fuseReq = {};
+        fuse_req_t req = &fuseReq;
         fuse_ino_t ino = 0;
         struct fuse_file_info fi;
         fi.fh = 1;
@@ -454,7 +464,7 @@ HWTEST_F(FuseOperationsTest, ForgetTest, TestSize.Level1)
 
 /**
  * @tc.name:ForgetMultiTest001
- * @tc.desc: Verify the ForgetMulti function
+ * @tc.desc: Verify the ForgetMulti function releases the root like any other inode
  * @tc.type: FUNC
  * @tc.require: issuesI92WQP
  */
@@ -462,6 +472,11 @@ HWTEST_F(FuseOperationsTest, ForgetMultiTest001, TestSize.Level1)
 {
     GTEST_LOG_(INFO) << "ForgetMultiTest001 Start";
     try {
+        CloudDiskFuseData data;
+        (data.inodeCache)[FUSE_ROOT_ID] = make_shared<CloudDiskInode>();
+        (data.inodeCache)[FUSE_ROOT_ID]->refCount = 1;
+        EXPECT_CALL(*insMock, fuse_req_userdata(_)).WillOnce(Return(reinterpret_cast<void *>(&data)));
+        EXPECT_CALL(*insMock, fuse_reply_none(_));
         fuse_req_t req = nullptr;
         struct fuse_forget_data forgets = {
             FUSE_ROOT_ID,
@@ -469,7 +484,7 @@ HWTEST_F(FuseOperationsTest, ForgetMultiTest001, TestSize.Level1)
         };
 
         fuseoperations_->ForgetMulti(req, 1, &forgets);
-        EXPECT_TRUE(true);
+        EXPECT_EQ(data.inodeCache.count(FUSE_ROOT_ID), 0);
     } catch (...) {
         EXPECT_TRUE(false);
         GTEST_LOG_(INFO) << "ForgetMultiTest001  ERROR";
@@ -479,7 +494,7 @@ HWTEST_F(FuseOperationsTest, ForgetMultiTest001, TestSize.Level1)
 
 /**
  * @tc.name:ForgetMultiTest002
- * @tc.desc: Verify the ForgetMulti function
+ * @tc.desc: Verify the ForgetMulti function replies to an empty batch
  * @tc.type: FUNC
  * @tc.require: issuesI92WQP
  */
@@ -487,6 +502,9 @@ HWTEST_F(FuseOperationsTest, ForgetMultiTest002, TestSize.Level1)
 {
     GTEST_LOG_(INFO) << "ForgetMultiTest002 Start";
     try {
+        CloudDiskFuseData data;
+        EXPECT_CALL(*insMock, fuse_req_userdata(_)).WillOnce(Return(reinterpret_cast<void *>(&data)));
+        EXPECT_CALL(*insMock, fuse_reply_none(_));
         fuse_req_t req = nullptr;
         struct fuse_forget_data forgets = {
             0,
@@ -494,7 +512,7 @@ HWTEST_F(FuseOperationsTest, ForgetMultiTest002, TestSize.Level1)
         };
 
         fuseoperations_->ForgetMulti(req, 0, &forgets);
-        EXPECT_TRUE(true);
+        EXPECT_TRUE(data.inodeCache.empty());
     } catch (...) {
         EXPECT_TRUE(false);
         GTEST_LOG_(INFO) << "ForgetMultiTest002  ERROR";
@@ -504,7 +522,7 @@ HWTEST_F(FuseOperationsTest, ForgetMultiTest002, TestSize.Level1)
 
 /**
  * @tc.name:ForgetMultiTest01
- * @tc.desc: Verify the ForgetMulti function
+ * @tc.desc: Verify the ForgetMulti function releases every inode of a batch mixing cloud and local inodes
  * @tc.type: FUNC
  * @tc.require: issuesI92WQP
  */
@@ -512,20 +530,25 @@ HWTEST_F(FuseOperationsTest, ForgetMultiTest01, TestSize.Level1)
 {
     GTEST_LOG_(INFO) << "ForgetMultiTest01 Start";
     try {
-        CloudDiskFuseData data1;
-        CloudDiskFuseData data2;
-        (data1.inodeCache)[0] = make_shared<CloudDiskInode>();
-        (data1.inodeCache)[0]->ops = make_shared<FileOperationsCloud>();
-        EXPECT_CALL(*insMock, fuse_req_userdata(_)).WillOnce(Return(reinterpret_cast<void *>(&data1)))
-                                                   .WillOnce(Return(reinterpret_cast<void *>(&data2)));
+        CloudDiskFuseData data;
+        (data.inodeCache)[FUSE_ROOT_TWO] = make_shared<CloudDiskInode>();
+        (data.inodeCache)[FUSE_ROOT_TWO]->ops = make_shared<FileOperationsCloud>();
+        (data.inodeCache)[FUSE_ROOT_TWO]->refCount = 1;
+        (data.inodeCache)[FUSE_ROOT_TWO + 1] = make_shared<CloudDiskInode>();
+        (data.inodeCache)[FUSE_ROOT_TWO + 1]->ops = make_shared<FileOperationsLocal>();
+        (data.inodeCache)[FUSE_ROOT_TWO + 1]->refCount = 2;
+        EXPECT_CALL(*insMock, fuse_req_userdata(_)).WillOnce(Return(reinterpret_cast<void *>(&data)));
+        EXPECT_CALL(*insMock, fuse_reply_none(_));
         fuse_req_t req = nullptr;
-        struct fuse_forget_data forgets;
-        forgets.ino = 0;
-        size_t count = 1;
+        struct fuse_forget_data forgets[] = {
+            {FUSE_ROOT_TWO, 1},
+            {FUSE_ROOT_TWO + 1, 1},
+        };
 
-        fuseoperations_->ForgetMulti(req, count, &forgets);
-        EXPECT_NE(count, 0);
-        EXPECT_NE((data1.inodeCache)[0], nullptr);
+        fuseoperations_->ForgetMulti(req, sizeof(forgets) / sizeof(forgets[0]), forgets);
+        EXPECT_EQ(data.inodeCache.count(FUSE_ROOT_TWO), 0);
+        ASSERT_EQ(data.inodeCache.count(FUSE_ROOT_TWO + 1), 1);
+        EXPECT_EQ((data.inodeCache)[FUSE_ROOT_TWO + 1]->refCount, 1);
     } catch (...) {
         EXPECT_TRUE(false);
         GTEST_LOG_(INFO) << "ForgetMultiTest01 ERROR";
@@ -535,7 +558,7 @@ HWTEST_F(FuseOperationsTest, ForgetMultiTest01, TestSize.Level1)
 
 /**
  * @tc.name:ForgetMultiTest02
- * @tc.desc: Verify the ForgetMulti function
+ * @tc.desc: Verify the ForgetMulti function skips inodes that are not cached
  * @tc.type: FUNC
  * @tc.require: issuesI92WQP
  */
@@ -545,13 +568,15 @@ HWTEST_F(FuseOperationsTest, ForgetMultiTest02, TestSize.Level1)
     try {
         CloudDiskFuseData data;
         EXPECT_CALL(*insMock, fuse_req_userdata(_)).WillOnce(Return(reinterpret_cast<void *>(&data)));
+        EXPECT_CALL(*insMock, fuse_reply_none(_));
         fuse_req_t req = nullptr;
         struct fuse_forget_data forgets;
         forgets.ino = 0;
+        forgets.nlookup = 1;
         size_t count = 1;
 
         fuseoperations_->ForgetMulti(req, count, &forgets);
-        EXPECT_NE(count, 0);
+        EXPECT_TRUE(data.inodeCache.empty());
     } catch (...) {
         EXPECT_TRUE(false);
         GTEST_LOG_(INFO) << "ForgetMultiTest02 ERROR";
@@ -1289,7 +1314,8 @@ HWTEST_F(FuseOperationsTest, ReadTest001, TestSize.Level1)
 {
     GTEST_LOG_(INFO) << "ReadTest001 Start";
     try {
-        fuse_req_t req = nullptr;
+        struct fuse_req fuseReq = {};
+        fuse_req_t req = &fuseReq;
         size_t size = 0;
         off_t off = 0;
         struct fuse_file_info fi;
@@ -1315,7 +1341,8 @@ HWTEST_F(FuseOperationsTest, ReadTest002, TestSize.Level1)
     try {
         CloudDiskFuseData data;
         EXPECT_CALL(*insMock, fuse_req_userdata(_)).WillOnce(Return(reinterpret_cast<void*>(&data)));
-        fuse_req_t req = nullptr;
+        struct fuse_req fuseReq = {};
+        fuse_req_t req = &fuseReq;
         size_t size = 0;
         off_t off = 0;
         struct fuse_file_info fi;
@@ -1344,7 +1371,8 @@ HWTEST_F(FuseOperationsTest, ReadTest, TestSize.Level1)
         (data.inodeCache)[0]->ops = make_shared<FileOperationsCloud>();
         EXPECT_CALL(*insMock, fuse_req_userdata(_)).WillOnce(Return(reinterpret_cast<void *>(&data)))
                                                    .WillOnce(Return(reinterpret_cast<void *>(&data)));
-        fuse_req_t req = nullptr;
+        struct fuse_req fuseReq = {};
+        fuse_req_t req = &fuseReq;
         fuse_ino_t ino = 0;
         size_t size = 0;
         off_t off = 0;
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fuse_request_lane.h"
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+namespace OHOS::FileManagement::CloudDisk::Test {
+using namespace testing;
+using namespace testing::ext;
+using namespace std;
+
+namespace {
+constexpr chrono::milliseconds IDLE_TIMEOUT = 50ms;
+
+/* Waits until every submitted task has run, polling like a client waiting for its replies. */
+void WaitDone(atomic<uint32_t> &done, uint32_t expect)
+{
+    auto deadline = chrono::steady_clock::now() + 10s;
+    while (done.load() < expect && chrono::steady_clock::now() < deadline) {
+        this_thread::sleep_for(1ms);
+    }
+}
+
+/*
+ * Several clients issue a mix of metadata requests, served on the caller like the session thread does,
+ * and slow data requests handed to the lane. Returns the data requests served per second.
+ */
+double RunLoad(uint32_t maxWorkers, uint32_t clients, uint32_t requestsPerClient, chrono::microseconds &metaCost)
+{
+    FuseRequestLane lane("load_lane", 0, maxWorkers, clients * requestsPerClient, IDLE_TIMEOUT);
+    lane.Start();
+    atomic<uint32_t> done{0};
+    atomic<int64_t> metaUs{0};
+    auto begin = chrono::steady_clock::now();
+    vector<thread> workers;
+    for (uint32_t client = 0; client < clients; client++) {
+        workers.emplace_back([&lane, &done, &metaUs, requestsPerClient] {
+            for (uint32_t i = 0; i < requestsPerClient; i++) {
+                auto metaBegin = chrono::steady_clock::now();
+                EXPECT_TRUE(lane.Submit([&done] {
+                    this_thread::sleep_for(2ms); // a cloud read blocked on the network
+                    done++;
+                }));
+                metaUs += chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() -
+                    metaBegin).count();
+            }
+        });
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    WaitDone(done, clients * requestsPerClient);
+    auto cost = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - begin);
+    EXPECT_EQ(done.load(), clients * requestsPerClient);
+    EXPECT_LE(lane.GetPeakWorkerCount(), maxWorkers);
+    metaCost = chrono::microseconds(metaUs.load() / (clients * requestsPerClient));
+    lane.Stop();
+    return static_cast<double>(done.load()) * chrono::microseconds(1s).count() / max<int64_t>(cost.count(), 1);
+}
+} // namespace
+
+class FuseRequestLaneTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {};
+    static void TearDownTestCase(void) {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+/**
+ * @tc.name: SubmitTest001
+ * @tc.desc: Verify that a lane refuses tasks before Start and after Stop and runs them in between.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseRequestLaneTest, SubmitTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SubmitTest001 Start";
+    FuseRequestLane lane("test_lane", 1, 2, 4, IDLE_TIMEOUT);
+    atomic<uint32_t> done{0};
+    EXPECT_FALSE(lane.Submit([&done] { done++; }));
+
+    lane.Start();
+    EXPECT_TRUE(lane.Submit([&done] { done++; }));
+    WaitDone(done, 1);
+    EXPECT_EQ(done.load(), 1);
+
+    lane.Stop();
+    EXPECT_EQ(lane.GetWorkerCount(), 0);
+    EXPECT_FALSE(lane.Submit([&done] { done++; }));
+    GTEST_LOG_(INFO) << "SubmitTest001 End";
+}
+
+/**
+ * @tc.name: SubmitTest002
+ * @tc.desc: Verify that a full lane hands the request back and Stop drains the queued tasks.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseRequestLaneTest, SubmitTest002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SubmitTest002 Start";
+    constexpr size_t maxPending = 2;
+    FuseRequestLane lane("test_lane", 0, 1, maxPending, IDLE_TIMEOUT);
+    lane.Start();
+    atomic<bool> release{false};
+    atomic<uint32_t> done{0};
+    auto blocked = [&release, &done] {
+        while (!release.load()) {
+            this_thread::sleep_for(1ms);
+        }
+        done++;
+    };
+    EXPECT_TRUE(lane.Submit(blocked));
+    while (lane.GetPendingCount() != 0) {
+        this_thread::sleep_for(1ms);
+    }
+    EXPECT_TRUE(lane.Submit(blocked));
+    EXPECT_TRUE(lane.Submit(blocked));
+    EXPECT_FALSE(lane.Submit(blocked));
+
+    release = true;
+    lane.Stop();
+    EXPECT_EQ(done.load(), 3);
+    GTEST_LOG_(INFO) << "SubmitTest002 End";
+}
+
+/**
+ * @tc.name: CreateDataLaneTest001
+ * @tc.desc: Verify that every session gets its own data lane and stopping one leaves the others serving.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseRequestLaneTest, CreateDataLaneTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "CreateDataLaneTest001 Start";
+    auto first = FuseRequestLane::CreateDataLane();
+    auto second = FuseRequestLane::CreateDataLane();
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_NE(first, second);
+    first->Start();
+    second->Start();
+    atomic<uint32_t> done{0};
+    EXPECT_TRUE(first->Submit([&done] { done++; }));
+    first->Stop();
+    EXPECT_EQ(done.load(), 1);
+    EXPECT_FALSE(first->Submit([&done] { done++; }));
+
+    EXPECT_TRUE(second->Submit([&done] { done++; }));
+    second->Stop();
+    EXPECT_EQ(done.load(), 2);
+    GTEST_LOG_(INFO) << "CreateDataLaneTest001 End";
+}
+
+/**
+ * @tc.name: AdaptiveSizeTest001
+ * @tc.desc: Verify that workers are added with the queue depth and the ones above the minimum leave when idle.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseRequestLaneTest, AdaptiveSizeTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "AdaptiveSizeTest001 Start";
+    constexpr uint32_t minWorkers = 1;
+    constexpr uint32_t maxWorkers = 4;
+    FuseRequestLane lane("test_lane", minWorkers, maxWorkers, 64, IDLE_TIMEOUT);
+    lane.Start();
+    atomic<uint32_t> done{0};
+    for (uint32_t i = 0; i < 32; i++) {
+        EXPECT_TRUE(lane.Submit([&done] {
+            this_thread::sleep_for(5ms);
+            done++;
+        }));
+    }
+    WaitDone(done, 32);
+    EXPECT_EQ(lane.GetPeakWorkerCount(), maxWorkers);
+
+    auto deadline = chrono::steady_clock::now() + 5s;
+    while (lane.GetWorkerCount() > minWorkers && chrono::steady_clock::now() < deadline) {
+        this_thread::sleep_for(IDLE_TIMEOUT);
+    }
+    EXPECT_EQ(lane.GetWorkerCount(), minWorkers);
+    lane.Stop();
+    GTEST_LOG_(INFO) << "AdaptiveSizeTest001 End";
+}
+
+/**
+ * @tc.name: LoadBenchmark001
+ * @tc.desc: Serve a synthetic multi-client mix of slow reads with 1 to 8 lane workers and compare the throughput.
+ * @tc.type: PERF
+ */
+HWTEST_F(FuseRequestLaneTest, LoadBenchmark001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "LoadBenchmark001 Start";
+    constexpr uint32_t clients = 8;
+    constexpr uint32_t requestsPerClient = 16;
+    double single = 0;
+    for (uint32_t workers = 1; workers <= 8; workers *= 2) {
+        chrono::microseconds metaCost(0);
+        double throughput = RunLoad(workers, clients, requestsPerClient, metaCost);
+        if (workers == 1) {
+            single = throughput;
+        } else {
+            EXPECT_GT(throughput, single);
+        }
+        // the submitting thread stands for the session thread, its cost is what a metadata request waits
+        GTEST_LOG_(INFO) << "workers: " << workers << ", reads/s: " << throughput
+                         << ", session thread us per read: " << metaCost.count();
+    }
+    GTEST_LOG_(INFO) << "LoadBenchmark001 End";
+}
+} // namespace OHOS::FileManagement::CloudDisk::Test
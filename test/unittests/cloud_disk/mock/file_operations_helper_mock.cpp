@@ -273,6 +273,14 @@ void FileOperationsHelper::PutLocalId(struct CloudDiskFuseData *data,
         wLock.unlock();
     }
 }
+void FileOperationsHelper::PutCloudDiskInodes(struct CloudDiskFuseData *data,
+                                              const vector<struct fuse_forget_data> &forgets)
+{
+    for (const auto &forget : forgets) {
+        auto inoPtr = FindCloudDiskInode(data, static_cast<int64_t>(forget.ino));
+        PutCloudDiskInode(data, inoPtr, forget.nlookup, static_cast<int64_t>(forget.ino));
+    }
+}
 } // namespace CloudDisk
 } // namespace FileManagement
 } // namespace OHOS
\ No newline at end of file
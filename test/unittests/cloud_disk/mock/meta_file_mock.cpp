@@ -30,6 +30,10 @@ void MetaFileMgr::CloudDiskClearAll()
 {
 }
 
+void MetaFileMgr::CloudDiskClearBundle(uint32_t userId, const std::string &bundleName)
+{
+}
+
 CloudDiskMetaFile::CloudDiskMetaFile(uint32_t userId, const std::string &bundleName, const std::string &cloudId)
 {
 }
@@ -13,10 +13,14 @@
  * limitations under the License.
  */
 
+#include <atomic>
+#include <chrono>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <thread>
 #include "cloud_report_cacher.h"
 #include "dfs_error.h"
+#include "nlohmann/json.hpp"
 
 namespace OHOS::FileManagement::CloudFile::Test {
 using namespace testing;
@@ -98,4 +102,167 @@ HWTEST_F(CloudReportCacherTest, ReportTest, TestSize.Level1)
     EXPECT_EQ(scheduleType, 1);
 }
 
+/*
+ * @tc.name: ReportTest002
+ * @tc.desc: Verify that Report drains every cached event of the bundle under the given schedule.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CloudReportCacherTest, ReportTest002, TestSize.Level1)
+{
+    std::string bundleName = "com.report.test002";
+    constexpr uint64_t eventCount = 5;
+    for (uint64_t i = 0; i < eventCount; i++) {
+        Cacher.PushEvent(bundleName, {"CLOUD_SYNC_FAULT", static_cast<int64_t>(i), 0, 1, "ReportTest002", "msg"});
+    }
+    shared_ptr<ReportInfo> reportInfo;
+    ASSERT_TRUE(Cacher.GetReportInfo(bundleName, reportInfo));
+    EXPECT_EQ(reportInfo->events_.Size(), eventCount);
+
+    Cacher.Report(bundleName, 3);
+    EXPECT_EQ(reportInfo->events_.Size(), 0);
+    EXPECT_EQ(reportInfo->reportedCount_.load(), eventCount);
+    EXPECT_EQ(reportInfo->lastScheduleType_, 3);
+}
+
+/*
+ * @tc.name: ReportTest003
+ * @tc.desc: Verify that a backlog is reported in several reports of at most the cache limit plus one events.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CloudReportCacherTest, ReportTest003, TestSize.Level1)
+{
+    std::string bundleName = "com.report.test003";
+    constexpr uint64_t eventCount = 50; // 50: reports of 21, 21 and 8 events
+    shared_ptr<ReportInfo> reportInfo;
+    ASSERT_TRUE(Cacher.GetReportInfo(bundleName, reportInfo));
+    // pushed to the ring directly, so that no background flush takes a part of the backlog
+    for (uint64_t i = 0; i < eventCount; i++) {
+        ASSERT_TRUE(reportInfo->events_.TryPush({"CLOUD_SYNC_FAULT", static_cast<int64_t>(i), 0, 1,
+            "ReportTest003", "msg"}));
+    }
+    reportInfo->lastScheduleType_ = 4;
+
+    Cacher.Report(bundleName, 9);
+    EXPECT_EQ(reportInfo->events_.Size(), 0);
+    EXPECT_EQ(reportInfo->reportedCount_.load(), eventCount);
+    EXPECT_EQ(reportInfo->lastScheduleType_, 9);
+
+    for (uint64_t i = 0; i < eventCount; i++) {
+        ASSERT_TRUE(reportInfo->events_.TryPush({"CLOUD_SYNC_FAULT", static_cast<int64_t>(i), 0, 1,
+            "ReportTest003", "msg"}));
+    }
+    Cacher.Flush(bundleName, reportInfo, 0);
+    // three overflow reports, each numbered as the next schedule
+    EXPECT_EQ(reportInfo->lastScheduleType_, 12);
+    EXPECT_EQ(reportInfo->reportedCount_.load(), eventCount * 2);
+}
+
+/*
+ * @tc.name: FaultEventRingTest001
+ * @tc.desc: Verify that the ring keeps fifo order and refuses events once it is full.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CloudReportCacherTest, FaultEventRingTest001, TestSize.Level1)
+{
+    FaultEventRing ring;
+    CloudFaultInfo event;
+    EXPECT_FALSE(ring.TryPop(event));
+    for (size_t i = 0; i < FaultEventRing::CAPACITY; i++) {
+        event.faultTime_ = static_cast<int64_t>(i);
+        EXPECT_TRUE(ring.TryPush(event));
+    }
+    EXPECT_FALSE(ring.TryPush(event));
+    EXPECT_EQ(ring.Size(), FaultEventRing::CAPACITY);
+    for (size_t i = 0; i < FaultEventRing::CAPACITY; i++) {
+        ASSERT_TRUE(ring.TryPop(event));
+        EXPECT_EQ(event.faultTime_, static_cast<int64_t>(i));
+    }
+    EXPECT_FALSE(ring.TryPop(event));
+    EXPECT_TRUE(ring.TryPush(event));
+}
+
+/*
+ * @tc.name: BuildReportMessageTest001
+ * @tc.desc: Verify that the string writer produces the same text as the nlohmann array dump.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CloudReportCacherTest, BuildReportMessageTest001, TestSize.Level1)
+{
+    vector<CloudFaultInfo> events = {
+        {"CLOUD_SYNC_FAULT", 1700000000000, 1, 4294967295U, "Download", "plain"},
+        {"CLOUD_SYNC_FAULT", -1, 2, 0, "Up\"load\\", string("tab\tline\nctl\x01\x1f end") + "\xe4\xb8\xad\xff"},
+        // overlong, surrogate, above U+10FFFF and truncated sequences are dropped
+        {"CLOUD_SYNC_FAULT", 0, 3, 1, "Utf8",
+            "a" "\xe0\x80\xaf" "b" "\xed\xa0\x80" "c" "\xf0\x80\x80\xaf" "d"
+            "\xf4\x90\x80\x80" "e" "\xf0\x9f\x98\x80\xe0\xa0"},
+    };
+    string traceId = "trace\"id";
+    int32_t scheduleType = 7;
+
+    nlohmann::json jsonArr = nlohmann::json::array();
+    for (const auto &event : events) {
+        nlohmann::json jsonItem;
+        jsonItem["version"] = 2;
+        jsonItem["trace_id"] = traceId;
+        jsonItem["schedule"] = scheduleType;
+        jsonItem["fault_error_code"] = event.faultErrorCode_;
+        jsonItem["function_name"] = event.funcName_;
+        jsonItem["fault_time"] = event.faultTime_;
+        jsonItem["message"] = event.message_;
+        jsonArr.push_back(jsonItem);
+    }
+    string expected = jsonArr.dump(-1, ' ', false, nlohmann::detail::error_handler_t::ignore);
+    EXPECT_EQ(CloudReportCacher::BuildReportMessage(events, traceId, scheduleType), expected);
+    EXPECT_EQ(CloudReportCacher::BuildReportMessage({}, traceId, scheduleType), "[]");
+}
+
+/*
+ * @tc.name: FaultStormBenchmark001
+ * @tc.desc: Push a fault storm from 8 threads into a few bundles and check every event is reported or counted.
+ * @tc.type: PERF
+ */
+HWTEST_F(CloudReportCacherTest, FaultStormBenchmark001, TestSize.Level1)
+{
+    constexpr int threadCount = 8;
+    constexpr int eventsPerThread = 20000;
+    constexpr int bundleCount = 4;
+    vector<string> bundles;
+    for (int i = 0; i < bundleCount; i++) {
+        bundles.push_back("com.fault.storm" + to_string(i));
+    }
+    atomic<bool> start{false};
+    vector<thread> workers;
+    for (int t = 0; t < threadCount; t++) {
+        workers.emplace_back([&, t]() {
+            while (!start.load()) {
+                this_thread::yield();
+            }
+            const string &bundleName = bundles[t % bundleCount];
+            for (int i = 0; i < eventsPerThread; i++) {
+                Cacher.PushEvent(bundleName, {"CLOUD_SYNC_FAULT", i, 1, static_cast<uint32_t>(t), "Storm", "msg"});
+            }
+        });
+    }
+    auto begin = chrono::steady_clock::now();
+    start.store(true);
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    auto costUs = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - begin).count();
+
+    uint64_t reported = 0;
+    uint64_t dropped = 0;
+    for (const auto &bundleName : bundles) {
+        shared_ptr<ReportInfo> reportInfo;
+        ASSERT_TRUE(Cacher.GetReportInfo(bundleName, reportInfo));
+        Cacher.Report(bundleName, 1);
+        reported += reportInfo->reportedCount_.load();
+        dropped += reportInfo->droppedCount_.load();
+    }
+    uint64_t total = static_cast<uint64_t>(threadCount) * eventsPerThread;
+    EXPECT_EQ(reported + dropped, total);
+    GTEST_LOG_(INFO) << "threads: " << threadCount << ", events: " << total << ", cost: " << costUs
+                     << " us, reported: " << reported << ", dropped: " << dropped;
+}
+
 } // namespace OHOS::FileManagement::CloudFile
\ No newline at end of file
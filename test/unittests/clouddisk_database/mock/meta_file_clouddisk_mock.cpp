@@ -523,6 +523,21 @@ void MetaFileMgr::CloudDiskClearAll()
     cloudDiskMetaFileList_.clear();
 }
 
+void MetaFileMgr::CloudDiskClearBundle(uint32_t userId, const std::string &bundleName)
+{
+    std::lock_guard<std::mutex> lock(cloudDiskMutex_);
+    for (auto it = cloudDiskMetaFileList_.begin(); it != cloudDiskMetaFileList_.end();) {
+        const auto &[keyUserId, keyName] = it->first;
+        if (keyUserId != userId || keyName.size() < bundleName.size() ||
+            keyName.compare(keyName.size() - bundleName.size(), bundleName.size(), bundleName) != 0) {
+            it++;
+            continue;
+        }
+        cloudDiskMetaFile_.erase(it->first);
+        it = cloudDiskMetaFileList_.erase(it);
+    }
+}
+
 std::shared_ptr<CloudDiskMetaFile> MetaFileMgr::GetCloudDiskMetaFile(uint32_t userId, const std::string &bundleName,
     const std::string &cloudId)
 {
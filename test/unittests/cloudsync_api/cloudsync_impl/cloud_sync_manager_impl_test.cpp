@@ -1025,10 +1025,11 @@ HWTEST_F(CloudSyncManagerImplTest, BatchDentryFileInsertTest002, TestSize.Level1
         std::vector<DentryFileInfo> fileInfo(MAX_DENTRY_FILE_SIZE - 1);
         std::vector<std::string> failCloudId;
         EXPECT_CALL(*proxy_, GetInstance(_)).WillOnce(Return(serviceProxy_));
-        EXPECT_CALL(*serviceProxy_, BatchDentryFileInsert(_, _)).WillOnce(Return(E_PERMISSION_DENIED));
+        EXPECT_CALL(*serviceProxy_, BatchDentryFileInsertChunk(_, _)).WillOnce(Return(E_PERMISSION_DENIED));
         int32_t result = CloudSyncManagerImpl::GetInstance().BatchDentryFileInsert(fileInfo, failCloudId);
 
         EXPECT_EQ(result, E_PERMISSION_DENIED);
+        EXPECT_EQ(failCloudId.size(), fileInfo.size());
     } catch (...) {
         EXPECT_TRUE(false);
         GTEST_LOG_(INFO) << " BatchDentryFileInsertTest002 FAILED";
@@ -1367,10 +1368,17 @@ HWTEST_F(CloudSyncManagerImplTest, BatchDentryFileInsertTest001, TestSize.Level1
     GTEST_LOG_(INFO) << "BatchDentryFileInsertTest001 Start";
     try {
         std::vector<DentryFileInfo> fileInfo(MAX_DENTRY_FILE_SIZE + 1);
+        fileInfo.back().cloudId = "lastCloudId";
         std::vector<std::string> failCloudId;
+        EXPECT_CALL(*proxy_, GetInstance(_)).WillOnce(Return(serviceProxy_));
+        EXPECT_CALL(*serviceProxy_, BatchDentryFileInsertChunk(_, _))
+            .WillOnce(Return(E_OK))
+            .WillOnce(Return(E_PERMISSION_DENIED));
         int32_t result = CloudSyncManagerImpl::GetInstance().BatchDentryFileInsert(fileInfo, failCloudId);
 
-        EXPECT_EQ(result, E_INVAL_ARG);
+        EXPECT_EQ(result, E_PERMISSION_DENIED);
+        ASSERT_EQ(failCloudId.size(), 1);
+        EXPECT_EQ(failCloudId[0], "lastCloudId");
     } catch (...) {
         EXPECT_TRUE(false);
         GTEST_LOG_(INFO) << " BatchDentryFileInsertTest001 FAILED";
@@ -2604,6 +2612,32 @@ HWTEST_F(CloudSyncManagerImplTest, GetAclXattrBatchTest003, TestSize.Level1)
     GTEST_LOG_(INFO) << "GetAclXattrBatchTest003 End";
 }
 
+/**
+ * @tc.name: GetAclXattrBatchTest004
+ * @tc.desc: Verify that GetAclXattrBatch appends no result when one of the chunks fails.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CloudSyncManagerImplTest, GetAclXattrBatchTest004, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GetAclXattrBatchTest004 Start";
+    try {
+        std::vector<std::string> filePaths(MAX_XATTR_PATH_SIZE + 1, "/storage/media/local/test/file1.txt");
+        std::vector<XattrResult> chunkResults(MAX_XATTR_PATH_SIZE);
+        std::vector<XattrResult> aclXattrResults(1);
+        EXPECT_CALL(*proxy_, GetInstance(_)).WillOnce(Return(serviceProxy_));
+        EXPECT_CALL(*serviceProxy_, GetAclXattrBatch(_, _, _))
+            .WillOnce(DoAll(SetArgReferee<2>(chunkResults), Return(E_OK)))
+            .WillOnce(Return(E_PERMISSION_DENIED));
+        int32_t res = CloudSyncManagerImpl::GetInstance().GetAclXattrBatch(true, filePaths, aclXattrResults);
+        EXPECT_EQ(res, E_PERMISSION_DENIED);
+        EXPECT_EQ(aclXattrResults.size(), 1);
+    } catch (...) {
+        EXPECT_TRUE(false);
+        GTEST_LOG_(INFO) << "GetAclXattrBatchTest004 FAILED";
+    }
+    GTEST_LOG_(INFO) << "GetAclXattrBatchTest004 End";
+}
+
 /**
  * @tc.name: GetUploadListTest001
  * @tc.desc: Verify GetUploadList function.
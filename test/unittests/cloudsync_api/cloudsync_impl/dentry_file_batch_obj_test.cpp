@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cloud_sync_common.h"
+#include "message_parcel.h"
+
+namespace OHOS {
+namespace FileManagement::CloudSync {
+using namespace testing::ext;
+using namespace std;
+
+namespace {
+constexpr size_t SMALL_BATCH_COUNT = 10;
+constexpr size_t LARGE_BATCH_COUNT = 500;
+constexpr size_t BENCHMARK_ENTRY_COUNT = 5000;
+constexpr size_t BENCHMARK_CHUNK_SIZE = 500;
+
+vector<DentryFileInfo> MakeEntries(size_t count)
+{
+    vector<DentryFileInfo> entries;
+    entries.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        string index = to_string(i);
+        entries.push_back({"cloud_id_" + index, static_cast<int64_t>(i * 1024), static_cast<int64_t>(i),
+            "/storage/cloud/files/Photo/16/IMG_" + index + ".jpg", "IMG_" + index + ".jpg", "image/jpeg"});
+    }
+    return entries;
+}
+
+bool SameEntry(const DentryFileInfo &lhs, const DentryFileInfo &rhs)
+{
+    return lhs.cloudId == rhs.cloudId && lhs.size == rhs.size && lhs.modifiedTime == rhs.modifiedTime &&
+        lhs.path == rhs.path && lhs.fileName == rhs.fileName && lhs.fileType == rhs.fileType;
+}
+
+/* Writes the batch into a parcel and reads it back, the parcel stands in for the binder transaction. */
+unique_ptr<DentryFileBatchObj> Loopback(const DentryFileBatchObj &batch)
+{
+    MessageParcel parcel;
+    if (!parcel.WriteParcelable(&batch)) {
+        return nullptr;
+    }
+    return unique_ptr<DentryFileBatchObj>(parcel.ReadParcelable<DentryFileBatchObj>());
+}
+
+int64_t ElapsedUs(chrono::steady_clock::time_point start)
+{
+    return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+}
+} // namespace
+
+class DentryFileBatchObjTest : public testing::Test {
+public:
+    void SetUp() {};
+    void TearDown() {};
+};
+
+/*
+ * @tc.name: EncodeDecodeTest001
+ * @tc.desc: Verify that encoded entries decode back unchanged and corrupt payloads are rejected.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DentryFileBatchObjTest, EncodeDecodeTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "EncodeDecodeTest001 Start";
+    auto entries = MakeEntries(SMALL_BATCH_COUNT);
+    DentryFileBatchObj batch;
+    ASSERT_TRUE(batch.Encode(entries.data(), entries.size()));
+    EXPECT_EQ(batch.GetCount(), SMALL_BATCH_COUNT);
+
+    vector<DentryFileInfo> decoded;
+    ASSERT_TRUE(DentryFileBatchObj::Decode(batch.payload_.data(), batch.payload_.size(), batch.GetCount(),
+        decoded));
+    ASSERT_EQ(decoded.size(), entries.size());
+    for (size_t i = 0; i < entries.size(); i++) {
+        EXPECT_TRUE(SameEntry(decoded[i], entries[i]));
+    }
+
+    EXPECT_FALSE(DentryFileBatchObj::Decode(batch.payload_.data(), batch.payload_.size() - 1, batch.GetCount(),
+        decoded));
+    EXPECT_TRUE(decoded.empty());
+    EXPECT_FALSE(DentryFileBatchObj::Decode(batch.payload_.data(), batch.payload_.size(), batch.GetCount() - 1,
+        decoded));
+    EXPECT_FALSE(batch.Encode(nullptr, 1));
+    GTEST_LOG_(INFO) << "EncodeDecodeTest001 End";
+}
+
+/*
+ * @tc.name: MarshallingTest001
+ * @tc.desc: Verify that a small batch travels inline and a large one through ashmem.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DentryFileBatchObjTest, MarshallingTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "MarshallingTest001 Start";
+    for (size_t count : {static_cast<size_t>(0), SMALL_BATCH_COUNT, LARGE_BATCH_COUNT}) {
+        auto entries = MakeEntries(count);
+        DentryFileBatchObj batch;
+        ASSERT_TRUE(batch.Encode(entries.data(), entries.size()));
+        if (count == LARGE_BATCH_COUNT) {
+            EXPECT_GT(batch.GetPayloadSize(), DentryFileBatchObj::INLINE_PAYLOAD_LIMIT);
+        }
+
+        auto received = Loopback(batch);
+        ASSERT_NE(received, nullptr);
+        ASSERT_EQ(received->fileInfo.size(), count);
+        for (size_t i = 0; i < count; i++) {
+            EXPECT_TRUE(SameEntry(received->fileInfo[i], entries[i]));
+        }
+    }
+    GTEST_LOG_(INFO) << "MarshallingTest001 End";
+}
+
+/*
+ * @tc.name: MarshallingTest002
+ * @tc.desc: Verify that a header claiming an oversized inline payload is rejected.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DentryFileBatchObjTest, MarshallingTest002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "MarshallingTest002 Start";
+    MessageParcel parcel;
+    parcel.WriteUint32(1);
+    parcel.WriteUint32(DentryFileBatchObj::INLINE_PAYLOAD_LIMIT + 1);
+    parcel.WriteBool(false);
+    DentryFileBatchObj batch;
+    EXPECT_FALSE(batch.ReadFromParcel(parcel));
+    GTEST_LOG_(INFO) << "MarshallingTest002 End";
+}
+
+/*
+ * @tc.name: LoopbackBenchmark001
+ * @tc.desc: Compare one DentryFileInfoObj per parcelable against encoded chunks over a parcel loopback.
+ * @tc.type: PERF
+ */
+HWTEST_F(DentryFileBatchObjTest, LoopbackBenchmark001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "LoopbackBenchmark001 Start";
+    auto entries = MakeEntries(BENCHMARK_ENTRY_COUNT);
+
+    auto start = chrono::steady_clock::now();
+    size_t legacyReceived = 0;
+    for (size_t offset = 0; offset < entries.size(); offset += BENCHMARK_CHUNK_SIZE) {
+        vector<DentryFileInfoObj> objs;
+        for (size_t i = offset; i < offset + BENCHMARK_CHUNK_SIZE; i++) {
+            objs.emplace_back(entries[i]);
+        }
+        MessageParcel parcel;
+        parcel.WriteInt32(static_cast<int32_t>(objs.size()));
+        for (const auto &obj : objs) {
+            parcel.WriteParcelable(&obj);
+        }
+        int32_t count = parcel.ReadInt32();
+        vector<DentryFileInfo> received;
+        for (int32_t i = 0; i < count; i++) {
+            unique_ptr<DentryFileInfoObj> obj(parcel.ReadParcelable<DentryFileInfoObj>());
+            ASSERT_NE(obj, nullptr);
+            received.push_back({obj->cloudId, obj->size, obj->modifiedTime, obj->path, obj->fileName, obj->fileType});
+        }
+        legacyReceived += received.size();
+    }
+    int64_t legacyUs = ElapsedUs(start);
+
+    start = chrono::steady_clock::now();
+    size_t batchReceived = 0;
+    for (size_t offset = 0; offset < entries.size(); offset += BENCHMARK_CHUNK_SIZE) {
+        DentryFileBatchObj batch;
+        ASSERT_TRUE(batch.Encode(entries.data() + offset, BENCHMARK_CHUNK_SIZE));
+        auto received = Loopback(batch);
+        ASSERT_NE(received, nullptr);
+        batchReceived += received->fileInfo.size();
+    }
+    int64_t batchUs = ElapsedUs(start);
+
+    EXPECT_EQ(legacyReceived, BENCHMARK_ENTRY_COUNT);
+    EXPECT_EQ(batchReceived, BENCHMARK_ENTRY_COUNT);
+    GTEST_LOG_(INFO) << "entries: " << BENCHMARK_ENTRY_COUNT << ", per object parcel: " << legacyUs
+                     << " us, encoded chunks: " << batchUs << " us";
+    GTEST_LOG_(INFO) << "LoopbackBenchmark001 End";
+}
+} // namespace FileManagement::CloudSync
+} // namespace OHOS
@@ -135,6 +135,8 @@ public:
     MOCK_METHOD1(GetCachedTotalSizeInner, int32_t(int64_t &totalSize));
     MOCK_METHOD1(GetDecompressUnsupportedList, int32_t(std::vector<std::string> &unsupportedList));
     MOCK_METHOD1(GetDecompressSystemFeature, int32_t(bool &systemFeature));
+    MOCK_METHOD2(BatchDentryFileInsertChunk,
+                 int32_t(const DentryFileBatchObj &batch, std::vector<std::string> &failCloudId));
  private:
     int32_t StartFileCacheWriteParcel(MessageParcel &data,
                                       const std::vector<std::string> &uriVec,
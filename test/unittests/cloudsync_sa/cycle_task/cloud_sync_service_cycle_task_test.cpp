@@ -250,8 +250,12 @@ HWTEST_F(CloudSyncServiceCycleTaskTest, InitTasksTest001, TestSize.Level1)
     try {
         EXPECT_NE(g_dataSyncManagerPtr_, nullptr);
         taskRunner_->cycleTasks_.clear();
+        taskRunner_->taskSpecs_.clear();
         taskRunner_->InitTasks();
         EXPECT_EQ(taskRunner_->cycleTasks_.size(), 10);
+        ASSERT_EQ(taskRunner_->taskSpecs_.size(), 10);
+        EXPECT_EQ(taskRunner_->taskSpecs_.back().name, PeriodicCheckTaskName);
+        EXPECT_EQ(taskRunner_->taskSpecs_.back().dependencies.size(), 9);
     } catch (...) {
         EXPECT_TRUE(false);
         GTEST_LOG_(INFO) << "InitTasksTest001 FAILED";
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "cycle_task_scheduler.h"
+#include "dfs_error.h"
+
+namespace OHOS::FileManagement::CloudSync::Test {
+using namespace testing::ext;
+using namespace std;
+using ResourceClass = CycleTaskScheduler::ResourceClass;
+using TaskState = CycleTaskScheduler::TaskState;
+
+namespace {
+constexpr auto WAIT_TIMEOUT = chrono::seconds(5);
+
+class FakeClock {
+public:
+    int64_t Now() const
+    {
+        return nowMs_.load();
+    }
+
+    void Advance(int64_t ms)
+    {
+        nowMs_ += ms;
+    }
+
+    function<int64_t()> AsFunction()
+    {
+        return [this]() { return Now(); };
+    }
+
+private:
+    atomic<int64_t> nowMs_{0};
+};
+
+CycleTaskScheduler::TaskSpec MakeTask(const string &name, ResourceClass resourceClass, function<void()> run,
+    const vector<string> &dependencies = {})
+{
+    CycleTaskScheduler::TaskSpec spec;
+    spec.name = name;
+    spec.resourceClass = resourceClass;
+    spec.priority = static_cast<int32_t>(CycleTaskScheduler::GetIoCost(resourceClass));
+    spec.dependencies = dependencies;
+    spec.run = move(run);
+    return spec;
+}
+
+const CycleTaskScheduler::TaskMetric *FindMetric(const vector<CycleTaskScheduler::TaskMetric> &metrics,
+    const string &name)
+{
+    for (const auto &metric : metrics) {
+        if (metric.name == name) {
+            return &metric;
+        }
+    }
+    return nullptr;
+}
+} // namespace
+
+class CycleTaskSchedulerTest : public testing::Test {
+public:
+    void SetUp() {};
+    void TearDown() {};
+};
+
+/*
+ * @tc.name: RunTest001
+ * @tc.desc: Verify that a task starts only after all of its dependencies finished.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CycleTaskSchedulerTest, RunTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "RunTest001 Start";
+    mutex orderMutex;
+    vector<string> order;
+    auto record = [&orderMutex, &order](const string &name) {
+        return [&orderMutex, &order, name]() {
+            lock_guard<mutex> lock(orderMutex);
+            order.push_back(name);
+        };
+    };
+    CycleTaskScheduler scheduler(CycleTaskScheduler::Options{});
+    EXPECT_EQ(scheduler.AddTask(MakeTask("check", ResourceClass::LIGHT, record("check"), {"backup", "clean"})),
+        E_OK);
+    EXPECT_EQ(scheduler.AddTask(MakeTask("supplement", ResourceClass::DATABASE, record("supplement"), {"backup"})),
+        E_OK);
+    EXPECT_EQ(scheduler.AddTask(MakeTask("backup", ResourceClass::DATABASE, record("backup"))), E_OK);
+    EXPECT_EQ(scheduler.AddTask(MakeTask("clean", ResourceClass::IO, record("clean"))), E_OK);
+
+    scheduler.Run();
+
+    ASSERT_EQ(order.size(), 4U);
+    auto position = [&order](const string &name) { return find(order.begin(), order.end(), name) - order.begin(); };
+    EXPECT_LT(position("backup"), position("supplement"));
+    EXPECT_LT(position("backup"), position("check"));
+    EXPECT_LT(position("clean"), position("check"));
+    for (const auto &metric : scheduler.GetMetrics()) {
+        EXPECT_EQ(metric.state, TaskState::FINISHED);
+    }
+    GTEST_LOG_(INFO) << "RunTest001 End";
+}
+
+/*
+ * @tc.name: RunTest002
+ * @tc.desc: Verify that a light task runs beside an I/O task while two I/O tasks never overlap.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CycleTaskSchedulerTest, RunTest002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "RunTest002 Start";
+    atomic<int32_t> ioRunning{0};
+    atomic<int32_t> maxIoRunning{0};
+    promise<void> lightStarted;
+    shared_future<void> lightFuture = lightStarted.get_future().share();
+    atomic<bool> overlapped{false};
+    auto ioTask = [&ioRunning, &maxIoRunning, &overlapped, lightFuture]() {
+        int32_t running = ++ioRunning;
+        int32_t expected = maxIoRunning.load();
+        while (running > expected && !maxIoRunning.compare_exchange_weak(expected, running)) {
+        }
+        if (lightFuture.wait_for(WAIT_TIMEOUT) == future_status::ready) {
+            overlapped = true;
+        }
+        --ioRunning;
+    };
+    CycleTaskScheduler::Options options;
+    options.maxParallel = 3;
+    CycleTaskScheduler scheduler(options);
+    EXPECT_EQ(scheduler.AddTask(MakeTask("chown", ResourceClass::IO, ioTask)), E_OK);
+    EXPECT_EQ(scheduler.AddTask(MakeTask("space_report", ResourceClass::IO, ioTask)), E_OK);
+    EXPECT_EQ(scheduler.AddTask(MakeTask("subscription", ResourceClass::LIGHT,
+        [&lightStarted]() { lightStarted.set_value(); })), E_OK);
+
+    scheduler.Run();
+
+    EXPECT_TRUE(overlapped.load());
+    EXPECT_EQ(maxIoRunning.load(), 1);
+    GTEST_LOG_(INFO) << "RunTest002 End";
+}
+
+/*
+ * @tc.name: RunTest003
+ * @tc.desc: Verify per-task duration metrics and the over budget flag with a fake clock.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CycleTaskSchedulerTest, RunTest003, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "RunTest003 Start";
+    FakeClock clock;
+    CycleTaskScheduler::Options options;
+    options.maxParallel = 1;
+    options.clock = clock.AsFunction();
+    CycleTaskScheduler scheduler(options);
+    auto fast = MakeTask("fast", ResourceClass::LIGHT, [&clock]() { clock.Advance(10); });
+    fast.budgetMs = 50;
+    auto slow = MakeTask("slow", ResourceClass::IO, [&clock]() { clock.Advance(200); }, {"fast"});
+    slow.budgetMs = 100;
+    EXPECT_EQ(scheduler.AddTask(fast), E_OK);
+    EXPECT_EQ(scheduler.AddTask(slow), E_OK);
+
+    scheduler.Run();
+
+    auto metrics = scheduler.GetMetrics();
+    const auto *fastMetric = FindMetric(metrics, "fast");
+    const auto *slowMetric = FindMetric(metrics, "slow");
+    ASSERT_NE(fastMetric, nullptr);
+    ASSERT_NE(slowMetric, nullptr);
+    EXPECT_EQ(fastMetric->startMs, 0);
+    EXPECT_EQ(fastMetric->durationMs, 10);
+    EXPECT_FALSE(fastMetric->overBudget);
+    EXPECT_EQ(slowMetric->startMs, 10);
+    EXPECT_EQ(slowMetric->durationMs, 200);
+    EXPECT_TRUE(slowMetric->overBudget);
+    GTEST_LOG_(INFO) << "RunTest003 End";
+}
+
+/*
+ * @tc.name: RunTest004
+ * @tc.desc: Verify invalid specs are rejected, unknown dependencies ignored and cycles skipped.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CycleTaskSchedulerTest, RunTest004, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "RunTest004 Start";
+    atomic<int32_t> runCount{0};
+    auto count = [&runCount]() { runCount++; };
+    CycleTaskScheduler scheduler(CycleTaskScheduler::Options{});
+    EXPECT_EQ(scheduler.AddTask(MakeTask("", ResourceClass::LIGHT, count)), E_INVAL_ARG);
+    EXPECT_EQ(scheduler.AddTask(MakeTask("empty", ResourceClass::LIGHT, nullptr)), E_INVAL_ARG);
+    EXPECT_EQ(scheduler.AddTask(MakeTask("a", ResourceClass::LIGHT, count, {"b"})), E_OK);
+    EXPECT_EQ(scheduler.AddTask(MakeTask("a", ResourceClass::LIGHT, count)), E_INVAL_ARG);
+    EXPECT_EQ(scheduler.AddTask(MakeTask("b", ResourceClass::LIGHT, count, {"a"})), E_OK);
+    EXPECT_EQ(scheduler.AddTask(MakeTask("c", ResourceClass::IO, count, {"missing"})), E_OK);
+
+    scheduler.Run();
+
+    auto metrics = scheduler.GetMetrics();
+    EXPECT_EQ(runCount.load(), 1);
+    ASSERT_NE(FindMetric(metrics, "c"), nullptr);
+    EXPECT_EQ(FindMetric(metrics, "c")->state, TaskState::FINISHED);
+    EXPECT_EQ(FindMetric(metrics, "a")->state, TaskState::SKIPPED);
+    EXPECT_EQ(FindMetric(metrics, "b")->state, TaskState::SKIPPED);
+    GTEST_LOG_(INFO) << "RunTest004 End";
+}
+} // namespace OHOS::FileManagement::CloudSync::Test
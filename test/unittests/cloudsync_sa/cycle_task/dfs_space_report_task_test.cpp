@@ -13,13 +13,13 @@
  * limitations under the License.
  */
 
-#ifdef lstat
-#define DFS_SPACE_REPORT_TEST_MOCK_LSTAT
-#undef lstat
+#ifdef fstatat
+#define DFS_SPACE_REPORT_TEST_MOCK_FSTATAT
+#undef fstatat
 #endif
-#ifdef opendir
-#define DFS_SPACE_REPORT_TEST_MOCK_OPENDIR
-#undef opendir
+#ifdef openat
+#define DFS_SPACE_REPORT_TEST_MOCK_OPENAT
+#undef openat
 #endif
 #ifdef readdir
 #define DFS_SPACE_REPORT_TEST_MOCK_READDIR
@@ -33,10 +33,14 @@
 #include <algorithm>
 #include <atomic>
 #include <cerrno>
+#include <climits>
+#include <cstdarg>
 #include <dirent.h>
+#include <fcntl.h>
 #include <fstream>
 #include <gtest/gtest.h>
 #include <limits>
+#include <mutex>
 #include <string>
 #include <sys/stat.h>
 #include <unistd.h>
@@ -53,18 +57,18 @@ static bool g_mockReadDirFail = false;
 static int32_t g_mockReadDirFailAfter = -1;
 static bool g_mockTimeout = false;
 static int32_t g_mockTimeoutAfter = -1;
-static int32_t g_mockReadDirCalls = 0;
+static std::atomic<int32_t> g_mockReadDirCalls = 0;
 static bool g_mockScreenOnInReadDir = false;
 static int32_t g_mockScreenOnAfterReadDir = -1;
 static std::atomic_bool g_mockStopScan = false;
 static bool g_mockFaultReportFailFirst = false;
 static int32_t g_mockFaultReportCalls = 0;
 static std::vector<std::string> g_mockFaultReportDetails;
-static std::string g_mockLstatFailPath;
-static std::string g_mockOpenDirFailPath;
-static int32_t g_mockLstatCalls = 0;
-static int32_t g_mockOpenDirCalls = 0;
-static int32_t g_mockCloseDirCalls = 0;
+static std::string g_mockFstatAtFailPath;
+static std::string g_mockOpenAtFailPath;
+static std::atomic<int32_t> g_mockFstatAtCalls = 0;
+static std::atomic<int32_t> g_mockOpenAtCalls = 0;
+static std::atomic<int32_t> g_mockCloseDirCalls = 0;
 
 static int32_t MockCloudSyncFaultReport(const OHOS::FileManagement::CloudFile::CloudSyncFaultInfo &info)
 {
@@ -79,18 +83,18 @@ static int32_t MockCloudSyncFaultReport(const OHOS::FileManagement::CloudFile::C
 
 namespace OHOS::FileManagement::CloudSync {
 static struct dirent *MockReadDir(DIR *dir);
-static int MockLstat(const char *path, struct stat *buf);
-static DIR *MockOpenDir(const char *path);
+static int MockFstatAt(int dirFd, const char *name, struct stat *buf, int flags);
+static int MockOpenAt(int dirFd, const char *name, int flags, ...);
 static int MockCloseDir(DIR *dir);
 } // namespace OHOS::FileManagement::CloudSync
 
 #undef CLOUD_SYNC_FAULT_REPORT
 #define CLOUD_SYNC_FAULT_REPORT(...) MockCloudSyncFaultReport(__VA_ARGS__)
-#ifdef DFS_SPACE_REPORT_TEST_MOCK_LSTAT
-#define lstat MockLstat
+#ifdef DFS_SPACE_REPORT_TEST_MOCK_FSTATAT
+#define fstatat MockFstatAt
 #endif
-#ifdef DFS_SPACE_REPORT_TEST_MOCK_OPENDIR
-#define opendir MockOpenDir
+#ifdef DFS_SPACE_REPORT_TEST_MOCK_OPENAT
+#define openat MockOpenAt
 #endif
 #ifdef DFS_SPACE_REPORT_TEST_MOCK_READDIR
 #define readdir MockReadDir
@@ -98,12 +102,13 @@ static int MockCloseDir(DIR *dir);
 #ifdef DFS_SPACE_REPORT_TEST_MOCK_CLOSEDIR
 #define closedir MockCloseDir
 #endif
+#include "dir_tree_scanner.cpp"
 #include "dfs_space_report_task.cpp"
-#ifdef lstat
-#undef lstat
+#ifdef fstatat
+#undef fstatat
 #endif
-#ifdef opendir
-#undef opendir
+#ifdef openat
+#undef openat
 #endif
 #ifdef readdir
 #undef readdir
@@ -113,24 +118,48 @@ static int MockCloseDir(DIR *dir);
 #endif
 
 namespace OHOS::FileManagement::CloudSync {
-static int MockLstat(const char *path, struct stat *buf)
+static std::string GetMockAtPath(int dirFd, const char *name)
 {
-    g_mockLstatCalls++;
-    if (!g_mockLstatFailPath.empty() && path != nullptr && g_mockLstatFailPath == path) {
+    if (name == nullptr) {
+        return "";
+    }
+    if (dirFd == AT_FDCWD || name[0] == '/') {
+        return name;
+    }
+    char dirPath[PATH_MAX] = {0};
+    std::string fdPath = "/proc/self/fd/" + std::to_string(dirFd);
+    ssize_t len = ::readlink(fdPath.c_str(), dirPath, sizeof(dirPath) - 1);
+    if (len <= 0) {
+        return name;
+    }
+    return std::string(dirPath, len) + "/" + name;
+}
+
+static int MockFstatAt(int dirFd, const char *name, struct stat *buf, int flags)
+{
+    g_mockFstatAtCalls++;
+    if (!g_mockFstatAtFailPath.empty() && g_mockFstatAtFailPath == GetMockAtPath(dirFd, name)) {
         errno = ENOENT;
         return -1;
     }
-    return ::lstat(path, buf);
+    return ::fstatat(dirFd, name, buf, flags);
 }
 
-static DIR *MockOpenDir(const char *path)
+static int MockOpenAt(int dirFd, const char *name, int flags, ...)
 {
-    g_mockOpenDirCalls++;
-    if (!g_mockOpenDirFailPath.empty() && path != nullptr && g_mockOpenDirFailPath == path) {
+    g_mockOpenAtCalls++;
+    if (!g_mockOpenAtFailPath.empty() && g_mockOpenAtFailPath == GetMockAtPath(dirFd, name)) {
         errno = EACCES;
-        return nullptr;
+        return -1;
+    }
+    mode_t mode = 0;
+    if ((flags & O_CREAT) != 0) {
+        va_list args;
+        va_start(args, flags);
+        mode = static_cast<mode_t>(va_arg(args, int));
+        va_end(args);
     }
-    return ::opendir(path);
+    return ::openat(dirFd, name, flags, mode);
 }
 
 static struct dirent *MockReadDir(DIR *dir)
@@ -188,10 +217,10 @@ static void ResetMockFaultReport()
 
 static void ResetMockSysCalls()
 {
-    g_mockLstatFailPath.clear();
-    g_mockOpenDirFailPath.clear();
-    g_mockLstatCalls = 0;
-    g_mockOpenDirCalls = 0;
+    g_mockFstatAtFailPath.clear();
+    g_mockOpenAtFailPath.clear();
+    g_mockFstatAtCalls = 0;
+    g_mockOpenAtCalls = 0;
     g_mockCloseDirCalls = 0;
 }
 
@@ -245,6 +274,26 @@ void DfsSpaceReportTaskTest::TearDown(void)
     std::system(("rm -rf " + TEST_ROOT).c_str());
 }
 
+/*
+ * @tc.name: SnapshotConditionTest001
+ * @tc.desc: Verify that the scan sees the status the cloudfile_kit shared library setters publish.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DfsSpaceReportTaskTest, SnapshotConditionTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "SnapshotConditionTest001 Start";
+    EXPECT_TRUE(IsDfsSpaceReportSnapshotSatisfied());
+    EXPECT_EQ(GetScanStopReason(g_mockStopScan), ScanStopReason::NOT_STOPPED);
+
+    SetDfsReportCondition(true, true, PowerMgr::ThermalLevel::NORMAL);
+    EXPECT_FALSE(IsDfsSpaceReportSnapshotSatisfied());
+    EXPECT_EQ(GetScanStopReason(g_mockStopScan), ScanStopReason::CONDITION_CHANGED);
+
+    SetDfsReportCondition(false, false, PowerMgr::ThermalLevel::NORMAL);
+    EXPECT_FALSE(IsDfsSpaceReportSnapshotSatisfied());
+    GTEST_LOG_(INFO) << "SnapshotConditionTest001 End";
+}
+
 /*
  * @tc.name: ScanDirTest001
  * @tc.desc: Verify that readdir failure is counted in scan errors for reporting.
@@ -337,7 +386,7 @@ HWTEST_F(DfsSpaceReportTaskTest, ScanDirTest005, TestSize.Level1)
     DfsDirStat stat = ScanDir(TEST_ROOT, g_mockStopScan);
 
     EXPECT_TRUE(IsScanStopped(stat.stopped));
-    EXPECT_EQ(g_mockOpenDirCalls, 0);
+    EXPECT_EQ(g_mockOpenAtCalls.load(), 0);
     GTEST_LOG_(INFO) << "ScanDirTest005 End";
 }
 
@@ -608,7 +657,7 @@ HWTEST_F(DfsSpaceReportTaskTest, ScanDfsUidTreeTest002, TestSize.Level1)
     ScanDfsUidTree(TEST_ROOT, dirStat, g_mockStopScan);
 
     EXPECT_TRUE(IsScanStopped(dirStat.stopped));
-    EXPECT_EQ(g_mockOpenDirCalls, 0);
+    EXPECT_EQ(g_mockOpenAtCalls.load(), 0);
     GTEST_LOG_(INFO) << "ScanDfsUidTreeTest002 End";
 }
 
@@ -1047,7 +1096,7 @@ HWTEST_F(DfsSpaceReportTaskTest, ScanMediaWrongUidDirsTest003, TestSize.Level1)
 
 /*
  * @tc.name: ScanDfsUidTreeTest003
- * @tc.desc: Verify media subtree scan records missing roots and regular-root opendir failures.
+ * @tc.desc: Verify media subtree scan records missing roots and regular-root open failures.
  * @tc.type: FUNC
  * @tc.require: NA
  */
@@ -1090,7 +1139,7 @@ HWTEST_F(DfsSpaceReportTaskTest, ScanDfsUidTreeTest004, TestSize.Level1)
 
 /*
  * @tc.name: ScanDfsUidTreeTest006
- * @tc.desc: Verify common DFS UID tree scan records child lstat failures.
+ * @tc.desc: Verify common DFS UID tree scan records child fstatat failures.
  * @tc.type: FUNC
  * @tc.require: NA
  */
@@ -1099,7 +1148,7 @@ HWTEST_F(DfsSpaceReportTaskTest, ScanDfsUidTreeTest006, TestSize.Level1)
     GTEST_LOG_(INFO) << "ScanDfsUidTreeTest006 Start";
     string childPath = TEST_ROOT + "/lost_entry";
     CreateFile(childPath);
-    g_mockLstatFailPath = childPath;
+    g_mockFstatAtFailPath = childPath;
     DfsDirStat dirStat;
 
     ScanDfsUidTree(TEST_ROOT, dirStat, g_mockStopScan);
@@ -1124,31 +1173,31 @@ HWTEST_F(DfsSpaceReportTaskTest, ScanDfsUidTreeTest005, TestSize.Level1)
     ScanDfsUidTree(TEST_ROOT, uidStat, g_mockStopScan);
 
     EXPECT_TRUE(IsScanStopped(uidStat.stopped));
-    EXPECT_EQ(g_mockOpenDirCalls, 0);
+    EXPECT_EQ(g_mockOpenAtCalls.load(), 0);
     GTEST_LOG_(INFO) << "ScanDfsUidTreeTest005 End";
 }
 
 /*
  * @tc.name: ScanMediaWrongUidDirsTest004
- * @tc.desc: Verify media wrong-UID parent reports opendir failure.
+ * @tc.desc: Verify media wrong-UID parent reports open failure.
  * @tc.type: FUNC
  * @tc.require: NA
  */
 HWTEST_F(DfsSpaceReportTaskTest, ScanMediaWrongUidDirsTest004, TestSize.Level1)
 {
     GTEST_LOG_(INFO) << "ScanMediaWrongUidDirsTest004 Start";
-    g_mockOpenDirFailPath = TEST_ROOT;
+    g_mockOpenAtFailPath = TEST_ROOT;
 
     MediaWrongUidStat stat = ScanMediaWrongUidDirs(TEST_ROOT, g_mockStopScan);
 
-    EXPECT_GT(g_mockOpenDirCalls, 0);
+    EXPECT_GT(g_mockOpenAtCalls.load(), 0);
     EXPECT_GT(stat.errors, 0U);
     GTEST_LOG_(INFO) << "ScanMediaWrongUidDirsTest004 End";
 }
 
 /*
  * @tc.name: ScanMediaWrongUidDirsTest005
- * @tc.desc: Verify media parent scan records first-level child lstat failures.
+ * @tc.desc: Verify media parent scan records first-level child fstatat failures.
  * @tc.type: FUNC
  * @tc.require: NA
  */
@@ -1157,7 +1206,7 @@ HWTEST_F(DfsSpaceReportTaskTest, ScanMediaWrongUidDirsTest005, TestSize.Level1)
     GTEST_LOG_(INFO) << "ScanMediaWrongUidDirsTest005 Start";
     string childPath = TEST_ROOT + "/lost_bucket";
     std::system(("mkdir -p " + childPath).c_str());
-    g_mockLstatFailPath = childPath;
+    g_mockFstatAtFailPath = childPath;
 
     MediaWrongUidStat stat = ScanMediaWrongUidDirs(TEST_ROOT, g_mockStopScan);
 
@@ -1524,7 +1573,7 @@ HWTEST_F(DfsSpaceReportTaskTest, RunTaskForBundleTest005, TestSize.Level1)
     int32_t ret = task.RunTaskForBundle(0, GALLERY_BUNDLE_NAME);
 
     EXPECT_EQ(ret, E_OK);
-    EXPECT_EQ(g_mockOpenDirCalls, 0);
+    EXPECT_EQ(g_mockOpenAtCalls.load(), 0);
     EXPECT_EQ(g_mockFaultReportCalls, 0);
     GTEST_LOG_(INFO) << "RunTaskForBundleTest005 End";
 }
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <dirent.h>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "dir_tree_scanner.h"
+
+namespace OHOS::FileManagement::CloudSync::Test {
+using namespace testing::ext;
+using namespace std;
+
+namespace {
+const string TEST_ROOT = "/data/test_tdd/dir_tree_scanner";
+constexpr uint32_t BUCKET_COUNT = 8;
+constexpr uint32_t FILES_PER_BUCKET = 4;
+
+void CreateFile(const string &path)
+{
+    ofstream file(path);
+    file << "dir-tree-scanner";
+    file.close();
+}
+
+void CreateBucketTree()
+{
+    for (uint32_t bucket = 0; bucket < BUCKET_COUNT; bucket++) {
+        string bucketPath = TEST_ROOT + "/" + to_string(bucket);
+        std::system(("mkdir -p " + bucketPath + "/sub").c_str());
+        for (uint32_t file = 0; file < FILES_PER_BUCKET; file++) {
+            CreateFile(bucketPath + "/file_" + to_string(file));
+        }
+        CreateFile(bucketPath + "/sub/nested");
+    }
+}
+
+struct CollectResult {
+    mutex lock;
+    set<string> paths;
+    atomic<uint32_t> statCount{0};
+    atomic<uint32_t> errorCount{0};
+};
+
+DirTreeScanner::Callbacks BuildCollectCallbacks(CollectResult &result)
+{
+    DirTreeScanner::Callbacks callbacks;
+    callbacks.onEntry = [&result](const DirTreeScanner::Entry &entry, uint32_t) {
+        if (entry.st != nullptr) {
+            result.statCount++;
+        }
+        lock_guard<mutex> lock(result.lock);
+        result.paths.insert(entry.GetPath());
+        return true;
+    };
+    callbacks.onError = [&result](const string &, int32_t, uint32_t) { result.errorCount++; };
+    return callbacks;
+}
+} // namespace
+
+class DirTreeScannerTest : public testing::Test {
+public:
+    void SetUp();
+    void TearDown();
+};
+
+void DirTreeScannerTest::SetUp(void)
+{
+    std::system(("rm -rf " + TEST_ROOT).c_str());
+    std::system(("mkdir -p " + TEST_ROOT).c_str());
+}
+
+void DirTreeScannerTest::TearDown(void)
+{
+    std::system(("rm -rf " + TEST_ROOT).c_str());
+}
+
+/*
+ * @tc.name: ScanTest001
+ * @tc.desc: Verify that a parallel scan visits every entry of the tree exactly once.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DirTreeScannerTest, ScanTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ScanTest001 Start";
+    CreateBucketTree();
+    CollectResult result;
+    DirTreeScanner::Options options;
+    options.workerCount = 4;
+    DirTreeScanner scanner(options, BuildCollectCallbacks(result));
+
+    EXPECT_EQ(scanner.Scan(TEST_ROOT), DirTreeScanner::ScanResult::COMPLETED);
+
+    uint32_t entriesPerBucket = 1 + FILES_PER_BUCKET + 1 + 1;
+    EXPECT_EQ(result.paths.size(), BUCKET_COUNT * entriesPerBucket);
+    EXPECT_TRUE(result.paths.count(TEST_ROOT + "/3/sub/nested") > 0);
+    EXPECT_EQ(result.errorCount.load(), 0U);
+    GTEST_LOG_(INFO) << "ScanTest001 End";
+}
+
+/*
+ * @tc.name: ScanTest002
+ * @tc.desc: Verify that fstatat is skipped for entries whose d_type is not requested.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DirTreeScannerTest, ScanTest002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ScanTest002 Start";
+    CreateBucketTree();
+    CollectResult result;
+    DirTreeScanner::Callbacks callbacks = BuildCollectCallbacks(result);
+    callbacks.needStat = [](unsigned char type) { return type == DT_DIR; };
+    DirTreeScanner scanner(DirTreeScanner::Options(), callbacks);
+
+    EXPECT_EQ(scanner.Scan(TEST_ROOT), DirTreeScanner::ScanResult::COMPLETED);
+
+    // Filesystems without d_type report DT_UNKNOWN and every entry is stat'ed.
+    EXPECT_TRUE(result.statCount.load() == BUCKET_COUNT * 2 || result.statCount.load() == result.paths.size());
+    GTEST_LOG_(INFO) << "ScanTest002 End";
+}
+
+/*
+ * @tc.name: ScanTest003
+ * @tc.desc: Verify that a stopped scan checkpoints finished units and a second scan resumes after the cursor.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DirTreeScannerTest, ScanTest003, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ScanTest003 Start";
+    CreateBucketTree();
+    string cursor;
+    atomic<uint32_t> visited{0};
+    DirTreeScanner::Callbacks callbacks;
+    callbacks.onEntry = [&visited](const DirTreeScanner::Entry &, uint32_t) {
+        visited++;
+        return true;
+    };
+    callbacks.shouldStop = [&visited]() { return visited.load() >= 20; };
+    callbacks.onCheckpoint = [&cursor](const string &name) { cursor = name; };
+    DirTreeScanner firstScanner(DirTreeScanner::Options(), callbacks);
+
+    EXPECT_EQ(firstScanner.Scan(TEST_ROOT), DirTreeScanner::ScanResult::STOPPED);
+    ASSERT_FALSE(cursor.empty());
+
+    CollectResult result;
+    DirTreeScanner::Options options;
+    options.cursor = cursor;
+    DirTreeScanner secondScanner(options, BuildCollectCallbacks(result));
+
+    EXPECT_EQ(secondScanner.Scan(TEST_ROOT), DirTreeScanner::ScanResult::COMPLETED);
+    EXPECT_EQ(result.paths.count(TEST_ROOT + "/" + cursor), 0U);
+    EXPECT_GT(result.paths.size(), 0U);
+    GTEST_LOG_(INFO) << "ScanTest003 End";
+}
+
+/*
+ * @tc.name: ScanTest005
+ * @tc.desc: Verify that a unit stopped from onEntry is not checkpointed and is scanned again on resume.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DirTreeScannerTest, ScanTest005, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ScanTest005 Start";
+    CreateBucketTree();
+    string cursor;
+    atomic<bool> conditionStop{false};
+    // the stop hits the last entry the unit visits, nothing after it notices the stop first
+    const string stopPath = TEST_ROOT + "/5";
+    DirTreeScanner::Callbacks callbacks;
+    callbacks.onEntry = [&conditionStop, &stopPath](const DirTreeScanner::Entry &entry, uint32_t) {
+        if (entry.GetPath() == stopPath) {
+            conditionStop.store(true);
+            return false;
+        }
+        return true;
+    };
+    callbacks.shouldStop = [&conditionStop]() { return conditionStop.load(); };
+    callbacks.onCheckpoint = [&cursor](const string &name) { cursor = name; };
+    DirTreeScanner firstScanner(DirTreeScanner::Options(), callbacks);
+
+    EXPECT_EQ(firstScanner.Scan(TEST_ROOT), DirTreeScanner::ScanResult::STOPPED);
+    EXPECT_EQ(cursor, "4");
+
+    CollectResult result;
+    DirTreeScanner::Options options;
+    options.cursor = cursor;
+    DirTreeScanner secondScanner(options, BuildCollectCallbacks(result));
+
+    EXPECT_EQ(secondScanner.Scan(TEST_ROOT), DirTreeScanner::ScanResult::COMPLETED);
+    EXPECT_EQ(result.paths.count(stopPath), 1U);
+    GTEST_LOG_(INFO) << "ScanTest005 End";
+}
+
+/*
+ * @tc.name: ScanTest004
+ * @tc.desc: Verify that missing roots and depth limits are reported.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DirTreeScannerTest, ScanTest004, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ScanTest004 Start";
+    CollectResult missingResult;
+    DirTreeScanner missingScanner(DirTreeScanner::Options(), BuildCollectCallbacks(missingResult));
+
+    EXPECT_EQ(missingScanner.Scan(TEST_ROOT + "/missing"), DirTreeScanner::ScanResult::OPEN_ROOT_FAILED);
+    EXPECT_EQ(missingResult.errorCount.load(), 1U);
+
+    std::system(("mkdir -p " + TEST_ROOT + "/a/b/c").c_str());
+    CollectResult depthResult;
+    DirTreeScanner::Options options;
+    options.maxDepth = 1;
+    DirTreeScanner depthScanner(options, BuildCollectCallbacks(depthResult));
+
+    EXPECT_EQ(depthScanner.Scan(TEST_ROOT), DirTreeScanner::ScanResult::DEPTH_LIMIT);
+    GTEST_LOG_(INFO) << "ScanTest004 End";
+}
+} // namespace OHOS::FileManagement::CloudSync::Test
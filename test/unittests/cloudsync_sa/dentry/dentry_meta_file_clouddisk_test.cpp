@@ -299,6 +299,33 @@ HWTEST_F(CloudDiskDentryMetaFileTest, CloudDiskMetaFileMgrTest001, TestSize.Leve
     GTEST_LOG_(INFO) << "CloudDiskMetaFileMgrTest001 End";
 }
 
+/**
+ * @tc.name: CloudDiskClearBundleTest001
+ * @tc.desc: Verify that only the cached dentry files of the removed bundle of the user are dropped
+ * @tc.type: FUNC
+ */
+HWTEST_F(CloudDiskDentryMetaFileTest, CloudDiskClearBundleTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "CloudDiskClearBundleTest001 Start";
+    auto &mgr = MetaFileMgr::GetInstance();
+    mgr.CloudDiskClearAll();
+    mgr.GetCloudDiskMetaFile(TEST_USER_ID, "com.example.removed", "id1");
+    mgr.GetCloudDiskMetaFile(TEST_USER_ID, "com.example.removed", "id2");
+    mgr.GetCloudDiskMetaFile(TEST_USER_ID, "com.example.kept", "id1");
+    mgr.GetCloudDiskMetaFile(TEST_USER_ID + 1, "com.example.removed", "id1");
+
+    mgr.CloudDiskClearBundle(TEST_USER_ID, "com.example.removed");
+    EXPECT_EQ(mgr.cloudDiskMetaFile_.size(), 2);
+    EXPECT_EQ(mgr.cloudDiskMetaFileList_.size(), 2);
+    EXPECT_EQ(mgr.cloudDiskMetaFile_.count(MetaFileKey(TEST_USER_ID, "id1com.example.kept")), 1);
+    EXPECT_EQ(mgr.cloudDiskMetaFile_.count(MetaFileKey(TEST_USER_ID + 1, "id1com.example.removed")), 1);
+
+    mgr.CloudDiskClearBundle(TEST_USER_ID, "");
+    EXPECT_EQ(mgr.cloudDiskMetaFile_.size(), 2);
+    mgr.CloudDiskClearAll();
+    GTEST_LOG_(INFO) << "CloudDiskClearBundleTest001 End";
+}
+
 #if defined(CLOUD_ADAPTER_ENABLED)
 /**
  * @tc.name: CreateRecycleDentryTest001
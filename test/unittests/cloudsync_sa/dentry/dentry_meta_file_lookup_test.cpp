@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <sys/stat.h>
+#include <sys/xattr.h>
+#include <unistd.h>
+
+#include "cloud_file_utils.h"
+#include "dfs_error.h"
+#include "directory_ex.h"
+#include "file_utils.h"
+#include "meta_file.h"
+#include "securec.h"
+#include "string_ex.h"
+#include "utils_log.h"
+
+namespace {
+uint64_t g_syscallCount = 0;
+}
+
+static int CountedOpen(const char *path, int flags, mode_t mode)
+{
+    g_syscallCount++;
+    return open(path, flags, mode);
+}
+
+static int CountedStat(const char *path, struct stat *buf)
+{
+    g_syscallCount++;
+    return stat(path, buf);
+}
+
+static int CountedFstat(int fd, struct stat *buf)
+{
+    g_syscallCount++;
+    return fstat(fd, buf);
+}
+
+static int CountedFsetxattr(int fd, const char *name, const void *value, size_t size, int flags)
+{
+    g_syscallCount++;
+    return fsetxattr(fd, name, value, size, flags);
+}
+
+#define open(path, flags, mode) CountedOpen(path, flags, mode)
+#define stat(path, buf) CountedStat(path, buf)
+#define fstat(fd, buf) CountedFstat(fd, buf)
+#define fsetxattr(fd, name, value, size, flags) CountedFsetxattr(fd, name, value, size, flags)
+#include "meta_file.cpp"
+#undef open
+#undef stat
+#undef fstat
+#undef fsetxattr
+
+namespace OHOS::FileManagement::CloudSync::Test {
+using namespace testing;
+using namespace testing::ext;
+using namespace std;
+constexpr uint32_t TEST_USER_ID = 301;
+const string DENTRY_DIR = "/data/service/el2/301/hmdfs/cache/account_cache/dentry_cache/cloud/";
+const string ALBUM_PATH = "/Photo/album";
+
+class DentryMetaFileLookupTest : public testing::Test {
+public:
+    void SetUp()
+    {
+        ForceCreateDirectory(DENTRY_DIR);
+        MetaFileMgr::GetInstance().ClearAll();
+    }
+    void TearDown()
+    {
+        MetaFileMgr::GetInstance().ClearAll();
+        ForceRemoveDirectory(DENTRY_DIR);
+    }
+};
+
+static void CreateChildren(const string &path, int32_t num)
+{
+    auto metaFile = MetaFileMgr::GetInstance().GetMetaFile(TEST_USER_ID, path);
+    ASSERT_NE(metaFile, nullptr);
+    for (int32_t i = 0; i < num; i++) {
+        MetaBase base("IMG_" + to_string(i) + ".jpg", to_string(i));
+        base.size = i;
+        EXPECT_EQ(metaFile->DoCreate(base), E_OK);
+    }
+}
+
+/**
+ * @tc.name: GetRevalidatedMetaFile001
+ * @tc.desc: Verify that the cached handle is reused until its dentry file is replaced on disk.
+ * @tc.type: FUNC
+ */
+HWTEST_F(DentryMetaFileLookupTest, GetRevalidatedMetaFile001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GetRevalidatedMetaFile001 Start";
+    CreateChildren(ALBUM_PATH, 1);
+    auto first = MetaFileMgr::GetInstance().GetRevalidatedMetaFile(TEST_USER_ID, ALBUM_PATH);
+    ASSERT_NE(first, nullptr);
+    EXPECT_FALSE(first->IsStale());
+    EXPECT_EQ(MetaFileMgr::GetInstance().GetRevalidatedMetaFile(TEST_USER_ID, ALBUM_PATH), first);
+
+    MetaBase base("IMG_0.jpg");
+    EXPECT_EQ(first->DoLookup(base), E_OK);
+
+    string dentryFile = MetaFile::GetDentryfileByPath(TEST_USER_ID, ALBUM_PATH);
+    ASSERT_EQ(unlink(dentryFile.c_str()), 0);
+    EXPECT_TRUE(first->IsStale());
+    auto second = MetaFileMgr::GetInstance().GetRevalidatedMetaFile(TEST_USER_ID, ALBUM_PATH);
+    ASSERT_NE(second, nullptr);
+    EXPECT_NE(second, first);
+    EXPECT_FALSE(second->IsStale());
+    EXPECT_EQ(second->DoLookup(base), ENOENT);
+    EXPECT_EQ(MetaFileMgr::GetInstance().CheckMetaFileSize(), 3); // 3: "/", "/Photo" and the album
+    GTEST_LOG_(INFO) << "GetRevalidatedMetaFile001 End";
+}
+
+/**
+ * @tc.name: LookupSyscallBenchmark001
+ * @tc.desc: Count the open, stat and xattr calls of a lookup through a new MetaFile and through the cache.
+ * @tc.type: PERF
+ */
+HWTEST_F(DentryMetaFileLookupTest, LookupSyscallBenchmark001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "LookupSyscallBenchmark001 Start";
+    constexpr int32_t childNum = 500;
+    CreateChildren(ALBUM_PATH, childNum);
+
+    g_syscallCount = 0;
+    auto begin = chrono::steady_clock::now();
+    for (int32_t i = 0; i < childNum; i++) {
+        MetaBase base("IMG_" + to_string(i) + ".jpg");
+        EXPECT_EQ(MetaFile(TEST_USER_ID, ALBUM_PATH).DoLookup(base), E_OK);
+    }
+    auto legacyCost = chrono::steady_clock::now() - begin;
+    uint64_t legacyCount = g_syscallCount;
+
+    MetaFileMgr::GetInstance().ClearAll();
+    g_syscallCount = 0;
+    begin = chrono::steady_clock::now();
+    for (int32_t i = 0; i < childNum; i++) {
+        MetaBase base("IMG_" + to_string(i) + ".jpg");
+        auto metaFile = MetaFileMgr::GetInstance().GetRevalidatedMetaFile(TEST_USER_ID, ALBUM_PATH);
+        ASSERT_NE(metaFile, nullptr);
+        EXPECT_EQ(metaFile->DoLookup(base), E_OK);
+    }
+    auto cachedCost = chrono::steady_clock::now() - begin;
+    uint64_t cachedCount = g_syscallCount;
+    EXPECT_LT(cachedCount, legacyCount);
+
+    // the stat and chown of ChangeUidByPath and the dentry block reads are not counted on either side,
+    // the legacy side includes the fstat that records the inode of a new handle
+    GTEST_LOG_(INFO) << "lookups: " << childNum << ", legacy calls per lookup: "
+                     << static_cast<double>(legacyCount) / childNum << ", legacy us: "
+                     << chrono::duration_cast<chrono::microseconds>(legacyCost).count()
+                     << ", cached calls per lookup: " << static_cast<double>(cachedCount) / childNum
+                     << ", cached us: " << chrono::duration_cast<chrono::microseconds>(cachedCost).count();
+    GTEST_LOG_(INFO) << "LookupSyscallBenchmark001 End";
+}
+} // namespace OHOS::FileManagement::CloudSync::Test
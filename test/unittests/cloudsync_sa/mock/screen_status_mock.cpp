@@ -15,6 +15,7 @@
 
 #include "screen_status.h"
 
+#include "device_status_snapshot.h"
 #include "screen_status_mock.h"
 
 namespace OHOS {
@@ -36,6 +37,7 @@ void ScreenStatus::InitScreenStatus()
 void ScreenStatus::SetScreenState(ScreenState screenState)
 {
     screenState_ = screenState;
+    DeviceStatusSnapshot::SetScreenOff(screenState == ScreenState::SCREEN_OFF);
 }
 } // namespace CloudSync
 } // namespace FileManagement
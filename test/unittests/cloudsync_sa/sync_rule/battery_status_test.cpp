@@ -18,6 +18,7 @@
 #include <vector>
 #include "battery_client_mock.h"
 #include "battery_status.h"
+#include "device_status_snapshot.h"
 #include "utils_log.h"
 
 namespace OHOS::FileManagement::CloudSync::Test {
@@ -1262,4 +1263,60 @@ HWTEST_F(BatteryStatusTest, BatteryStatusErrorHandlingTest001, TestSize.Level1)
     GTEST_LOG_(INFO) << "BatteryStatusErrorHandlingTest001 End";
 }
 
+/**
+ * @tc.name: DeviceStatusSnapshotTest001
+ * @tc.desc: Verify that charging and capacity updates are published to the device status snapshot
+ * @tc.type: FUNC
+ * @tc.require: NA
+ */
+HWTEST_F(BatteryStatusTest, DeviceStatusSnapshotTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "DeviceStatusSnapshotTest001 Start";
+    BatteryStatus::SetChargingStatus(true);
+    BatteryStatus::SetCapacity(STOP_CAPACITY_LIMIT);
+
+    uint32_t word = DeviceStatusSnapshot::Load();
+    EXPECT_TRUE(DeviceStatusSnapshot::IsCharging(word));
+    EXPECT_EQ(DeviceStatusSnapshot::GetCapacity(word), STOP_CAPACITY_LIMIT);
+
+    BatteryStatus::SetChargingStatus(false);
+    BatteryStatus::SetCapacity(FULL_BATTERY_CAPACITY);
+
+    word = DeviceStatusSnapshot::Load();
+    EXPECT_FALSE(DeviceStatusSnapshot::IsCharging(word));
+    EXPECT_EQ(DeviceStatusSnapshot::GetCapacity(word), FULL_BATTERY_CAPACITY);
+    GTEST_LOG_(INFO) << "DeviceStatusSnapshotTest001 End";
+}
+
+/**
+ * @tc.name: DeviceStatusSnapshotTest002
+ * @tc.desc: Verify IsIdleCharging against screen, capacity and thermal fields
+ * @tc.type: FUNC
+ * @tc.require: NA
+ */
+HWTEST_F(BatteryStatusTest, DeviceStatusSnapshotTest002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "DeviceStatusSnapshotTest002 Start";
+    constexpr int32_t minCapacity = 20;
+    constexpr int32_t normalLevel = 1;
+    constexpr int32_t hotLevel = 3;
+    BatteryStatus::SetChargingStatus(true);
+    DeviceStatusSnapshot::SetScreenOff(true);
+    DeviceStatusSnapshot::SetThermalLevel(normalLevel);
+
+    EXPECT_TRUE(DeviceStatusSnapshot::IsIdleCharging(minCapacity, normalLevel));
+
+    BatteryStatus::SetCapacity(STOP_CAPACITY_LIMIT);
+    EXPECT_FALSE(DeviceStatusSnapshot::IsIdleCharging(minCapacity, normalLevel));
+
+    BatteryStatus::SetCapacity(FULL_BATTERY_CAPACITY);
+    DeviceStatusSnapshot::SetThermalLevel(hotLevel);
+    EXPECT_FALSE(DeviceStatusSnapshot::IsIdleCharging(minCapacity, normalLevel));
+
+    DeviceStatusSnapshot::SetThermalLevel(normalLevel);
+    DeviceStatusSnapshot::SetScreenOff(false);
+    EXPECT_FALSE(DeviceStatusSnapshot::IsIdleCharging(minCapacity, normalLevel));
+    GTEST_LOG_(INFO) << "DeviceStatusSnapshotTest002 End";
+}
+
 } // namespace OHOS::FileManagement::CloudSync::Test
\ No newline at end of file
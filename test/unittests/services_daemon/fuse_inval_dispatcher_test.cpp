@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fuse_inval_dispatcher.h"
+
+#include <gtest/gtest.h>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "ffrt_inner.h"
+
+namespace {
+struct SentInval {
+    struct fuse_session *se;
+    fuse_ino_t ino;
+    std::string name;
+};
+
+std::mutex g_sentMutex;
+std::vector<SentInval> g_sentEntries;
+std::vector<SentInval> g_sentInodes;
+int g_entryRet = 0;
+} // namespace
+
+int fuse_lowlevel_notify_inval_entry(struct fuse_session *se, fuse_ino_t parent, const char *name, size_t namelen)
+{
+    std::lock_guard<std::mutex> lock(g_sentMutex);
+    g_sentEntries.push_back({se, parent, std::string(name, namelen)});
+    return g_entryRet;
+}
+
+int fuse_lowlevel_notify_inval_inode(struct fuse_session *se, fuse_ino_t ino, off_t off, off_t len)
+{
+    std::lock_guard<std::mutex> lock(g_sentMutex);
+    g_sentInodes.push_back({se, ino, ""});
+    return 0;
+}
+
+namespace OHOS::FileManagement::CloudFile::Test {
+using namespace testing;
+using namespace testing::ext;
+using namespace std;
+
+namespace {
+constexpr uint64_t TICK_MS = 5;
+constexpr size_t MAX_PENDING = 4;
+
+struct fuse_session *FakeSession(uintptr_t id)
+{
+    return reinterpret_cast<struct fuse_session *>(id);
+}
+} // namespace
+
+class FuseInvalDispatcherTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {};
+    static void TearDownTestCase(void) {};
+    void SetUp()
+    {
+        lock_guard<mutex> lock(g_sentMutex);
+        g_sentEntries.clear();
+        g_sentInodes.clear();
+        g_entryRet = 0;
+    }
+    void TearDown() {};
+};
+
+/**
+ * @tc.name: InvalEntryTest001
+ * @tc.desc: Verify that repeated invalidations of one entry within a tick are sent once.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseInvalDispatcherTest, InvalEntryTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "InvalEntryTest001 Start";
+    FuseInvalDispatcher dispatcher(TICK_MS, MAX_PENDING);
+    // the tick is driven by the test instead of the timer
+    dispatcher.tickStarted_ = true;
+    auto se = FakeSession(1);
+    dispatcher.InvalEntry(se, 1, 2, "a.txt");
+    dispatcher.InvalEntry(se, 1, 3, "a.txt");
+    dispatcher.InvalEntry(se, 1, 4, "b.txt");
+    dispatcher.Flush();
+
+    auto stats = dispatcher.GetStats();
+    EXPECT_EQ(stats.requested, 3);
+    EXPECT_EQ(stats.coalesced, 1);
+    EXPECT_EQ(stats.issued, 2);
+    EXPECT_EQ(stats.overflowed, 0);
+    EXPECT_EQ(stats.dropped, 0);
+    lock_guard<mutex> lock(g_sentMutex);
+    ASSERT_EQ(g_sentEntries.size(), 2);
+    EXPECT_EQ(g_sentEntries[0].name, "a.txt");
+    EXPECT_EQ(g_sentEntries[1].name, "b.txt");
+    EXPECT_TRUE(g_sentInodes.empty());
+    GTEST_LOG_(INFO) << "InvalEntryTest001 End";
+}
+
+/**
+ * @tc.name: InvalEntryTest002
+ * @tc.desc: Verify that the latest child is invalidated when the kernel no longer knows the entry.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseInvalDispatcherTest, InvalEntryTest002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "InvalEntryTest002 Start";
+    FuseInvalDispatcher dispatcher(TICK_MS, MAX_PENDING);
+    dispatcher.tickStarted_ = true;
+    g_entryRet = -ENOENT;
+    auto se = FakeSession(1);
+    dispatcher.InvalEntry(se, 1, 2, "a.txt");
+    dispatcher.InvalEntry(se, 1, 3, "a.txt");
+    dispatcher.Flush();
+
+    EXPECT_EQ(dispatcher.GetStats().issued, 2);
+    lock_guard<mutex> lock(g_sentMutex);
+    ASSERT_EQ(g_sentInodes.size(), 1);
+    EXPECT_EQ(g_sentInodes[0].ino, 3);
+    GTEST_LOG_(INFO) << "InvalEntryTest002 End";
+}
+
+/**
+ * @tc.name: InvalEntryTest003
+ * @tc.desc: Verify that an inode queued under several gone entries is invalidated once per batch.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseInvalDispatcherTest, InvalEntryTest003, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "InvalEntryTest003 Start";
+    FuseInvalDispatcher dispatcher(TICK_MS, MAX_PENDING);
+    dispatcher.tickStarted_ = true;
+    g_entryRet = -ENOENT;
+    auto se = FakeSession(1);
+    auto other = FakeSession(2);
+    dispatcher.InvalEntry(se, 1, 4, "a.txt");
+    dispatcher.InvalEntry(se, 5, 4, "b.txt");
+    dispatcher.InvalEntry(other, 1, 4, "a.txt");
+    dispatcher.Flush();
+
+    auto stats = dispatcher.GetStats();
+    EXPECT_EQ(stats.issued, 5);
+    EXPECT_EQ(stats.coalesced, 1);
+    lock_guard<mutex> lock(g_sentMutex);
+    EXPECT_EQ(g_sentEntries.size(), 3);
+    ASSERT_EQ(g_sentInodes.size(), 2);
+    EXPECT_NE(g_sentInodes[0].se, g_sentInodes[1].se);
+    GTEST_LOG_(INFO) << "InvalEntryTest003 End";
+}
+
+/**
+ * @tc.name: DiscardTest001
+ * @tc.desc: Verify that Discard drops only the queued requests of the given session.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseInvalDispatcherTest, DiscardTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "DiscardTest001 Start";
+    // room for both sessions, so that no overflow flush races with Discard
+    FuseInvalDispatcher dispatcher(TICK_MS, MAX_PENDING * 2);
+    dispatcher.tickStarted_ = true;
+    auto gone = FakeSession(1);
+    auto alive = FakeSession(2);
+    dispatcher.InvalEntry(gone, 1, 2, "a.txt");
+    dispatcher.InvalEntry(gone, 1, 3, "b.txt");
+    dispatcher.InvalEntry(alive, 1, 2, "a.txt");
+    dispatcher.Discard(gone);
+    dispatcher.Flush();
+
+    lock_guard<mutex> lock(g_sentMutex);
+    ASSERT_EQ(g_sentEntries.size(), 1);
+    EXPECT_EQ(g_sentEntries[0].se, alive);
+    GTEST_LOG_(INFO) << "DiscardTest001 End";
+}
+
+/**
+ * @tc.name: OverflowTest001
+ * @tc.desc: Verify that a full queue is flushed without waiting for the tick.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseInvalDispatcherTest, OverflowTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "OverflowTest001 Start";
+    FuseInvalDispatcher dispatcher(TICK_MS, MAX_PENDING);
+    dispatcher.tickStarted_ = true;
+    auto se = FakeSession(1);
+    for (fuse_ino_t ino = 1; ino <= MAX_PENDING; ino++) {
+        dispatcher.InvalEntry(se, 1, ino, to_string(ino));
+    }
+    ffrt::wait();
+
+    auto stats = dispatcher.GetStats();
+    EXPECT_EQ(stats.overflowed, 1);
+    EXPECT_EQ(stats.issued, MAX_PENDING);
+    lock_guard<mutex> lock(g_sentMutex);
+    EXPECT_EQ(g_sentEntries.size(), MAX_PENDING);
+    GTEST_LOG_(INFO) << "OverflowTest001 End";
+}
+
+/**
+ * @tc.name: OverflowTest002
+ * @tc.desc: Verify that a full queue drops requests for new entries and still coalesces queued ones.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseInvalDispatcherTest, OverflowTest002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "OverflowTest002 Start";
+    FuseInvalDispatcher dispatcher(TICK_MS, MAX_PENDING);
+    // the sender is held back, as if it were still busy with the previous batch
+    dispatcher.tickStarted_ = true;
+    dispatcher.flushQueued_ = true;
+    auto se = FakeSession(1);
+    for (fuse_ino_t ino = 1; ino <= MAX_PENDING + 2; ino++) {
+        dispatcher.InvalEntry(se, 1, ino, to_string(ino));
+    }
+    dispatcher.InvalEntry(se, 1, 1, "1");
+    EXPECT_EQ(dispatcher.entries_.size(), MAX_PENDING);
+
+    auto stats = dispatcher.GetStats();
+    EXPECT_EQ(stats.requested, MAX_PENDING + 3);
+    EXPECT_EQ(stats.dropped, 2);
+    EXPECT_EQ(stats.coalesced, 1);
+    dispatcher.Flush();
+    lock_guard<mutex> lock(g_sentMutex);
+    EXPECT_EQ(g_sentEntries.size(), MAX_PENDING);
+    GTEST_LOG_(INFO) << "OverflowTest002 End";
+}
+} // namespace OHOS::FileManagement::CloudFile::Test
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fuse_io_accounting.h"
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+namespace OHOS::FileManagement::CloudFile::Test {
+using namespace testing;
+using namespace testing::ext;
+using namespace std;
+
+namespace {
+constexpr uid_t APP_UID = 20010001;
+constexpr uid_t OTHER_APP_UID = 20010002;
+} // namespace
+
+class FuseIoAccountingTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {};
+    static void TearDownTestCase(void) {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+/**
+ * @tc.name: CountTest001
+ * @tc.desc: Verify that the requests of each uid are counted apart.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseIoAccountingTest, CountTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "CountTest001 Start";
+    FuseIoAccounting accounting;
+    accounting.CountRead(APP_UID, 4096);
+    accounting.CountRead(APP_UID, 100);
+    accounting.CountOpen(APP_UID);
+    accounting.CountStat(APP_UID);
+    accounting.CountStat(APP_UID);
+    accounting.CountOpen(OTHER_APP_UID);
+
+    auto counters = accounting.GetCounters(APP_UID);
+    EXPECT_EQ(counters.reads, 2);
+    EXPECT_EQ(counters.readBytes, 4196);
+    EXPECT_EQ(counters.opens, 1);
+    EXPECT_EQ(counters.stats, 2);
+    counters = accounting.GetCounters(OTHER_APP_UID);
+    EXPECT_EQ(counters.reads, 0);
+    EXPECT_EQ(counters.opens, 1);
+    counters = accounting.GetCounters(0);
+    EXPECT_EQ(counters.opens, 0);
+    EXPECT_EQ(accounting.GetUncountedCount(), 0);
+    GTEST_LOG_(INFO) << "CountTest001 End";
+}
+
+/**
+ * @tc.name: ConcurrentTest001
+ * @tc.desc: Verify that no request is lost when threads count for the same uids at once.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseIoAccountingTest, ConcurrentTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "ConcurrentTest001 Start";
+    constexpr uint32_t threadCount = 8;
+    constexpr uint32_t rounds = 10000;
+    FuseIoAccounting accounting;
+    vector<thread> threads;
+    for (uint32_t i = 0; i < threadCount; i++) {
+        threads.emplace_back([&accounting] {
+            for (uint32_t j = 0; j < rounds; j++) {
+                accounting.CountRead(APP_UID + j % 2, 1);
+                accounting.CountOpen(APP_UID + j % 2);
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+    for (uid_t uid : {APP_UID, OTHER_APP_UID}) {
+        auto counters = accounting.GetCounters(uid);
+        EXPECT_EQ(counters.reads, threadCount * rounds / 2);
+        EXPECT_EQ(counters.readBytes, threadCount * rounds / 2);
+        EXPECT_EQ(counters.opens, threadCount * rounds / 2);
+    }
+    GTEST_LOG_(INFO) << "ConcurrentTest001 End";
+}
+
+/**
+ * @tc.name: FullTableTest001
+ * @tc.desc: Verify that uids beyond the table are reported as uncounted and others keep counting.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseIoAccountingTest, FullTableTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "FullTableTest001 Start";
+    FuseIoAccounting accounting;
+    uint64_t counted = 0;
+    for (uid_t uid = 1; uid <= FuseIoAccounting::SLOT_COUNT * 2; uid++) {
+        accounting.CountStat(uid);
+    }
+    for (uid_t uid = 1; uid <= FuseIoAccounting::SLOT_COUNT * 2; uid++) {
+        counted += accounting.GetCounters(uid).stats;
+    }
+    EXPECT_LE(counted, FuseIoAccounting::SLOT_COUNT);
+    EXPECT_EQ(counted + accounting.GetUncountedCount(), FuseIoAccounting::SLOT_COUNT * 2);
+    GTEST_LOG_(INFO) << "FullTableTest001 End";
+}
+
+/**
+ * @tc.name: CountBenchmark001
+ * @tc.desc: Measure what accounting one request costs the FUSE worker serving it.
+ * @tc.type: PERF
+ */
+HWTEST_F(FuseIoAccountingTest, CountBenchmark001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "CountBenchmark001 Start";
+    constexpr uint32_t rounds = 100000;
+    FuseIoAccounting accounting;
+    auto begin = chrono::steady_clock::now();
+    for (uint32_t i = 0; i < rounds; i++) {
+        accounting.CountRead(APP_UID, 4096);
+    }
+    auto cost = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - begin);
+    EXPECT_EQ(accounting.GetCounters(APP_UID).reads, rounds);
+    GTEST_LOG_(INFO) << "ns per accounted request: " << cost.count() / rounds;
+    GTEST_LOG_(INFO) << "CountBenchmark001 End";
+}
+} // namespace OHOS::FileManagement::CloudFile::Test
@@ -283,7 +283,7 @@ HWTEST_F(FuseManagerStaticTest, DoSessionInitTest001, TestSize.Level1)
         cInode->mBase = make_shared<MetaBase>("test");
         cInode->mBase->fileType = FILE_TYPE_THUMBNAIL;
 
-        DoSessionInit(cInode, err, openFinish, cond);
+        DoSessionInit(cInode, err, openFinish, cond, false);
         EXPECT_TRUE(err);
     } catch (...) {
         EXPECT_TRUE(false);
@@ -2212,4 +2212,402 @@ HWTEST_F(FuseManagerStaticTest, ReadFileToBufTest005, TestSize.Level1) {
     EXPECT_EQ(result, -1);
 }
 
+/**
+ * @tc.name: CloudForgetMultiTest001
+ * @tc.desc: Verify that a forget batch releases every inode of it and skips the unknown ones.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseManagerStaticTest, CloudForgetMultiTest001, TestSize.Level1) {
+    fuse_req_t req = nullptr;
+    auto data = make_shared<FuseData>();
+    for (uint64_t ino = 10; ino <= 11; ino++) {
+        auto node = make_shared<CloudInode>();
+        node->mBase = make_shared<MetaBase>("IMG_" + to_string(ino) + ".jpg");
+        node->refCount = static_cast<int>(ino - 9);
+        data->inodeCache[ino] = node;
+    }
+    struct fuse_forget_data forgets[] = {{10, 1}, {11, 1}, {99, 1}};
+
+    EXPECT_CALL(*insMock, fuse_req_userdata(_)).WillRepeatedly(Return(reinterpret_cast<void*>(data.get())));
+    EXPECT_CALL(*insMock, fuse_reply_none(_)).Times(1);
+    CloudForgetMulti(req, sizeof(forgets) / sizeof(forgets[0]), forgets);
+    EXPECT_EQ(data->inodeCache.count(10), 0);
+    ASSERT_EQ(data->inodeCache.count(11), 1);
+    EXPECT_EQ(data->inodeCache[11]->refCount, 1);
+}
+
+/**
+ * @tc.name: CloudForgetTest001
+ * @tc.desc: Verify that a forget keeps a still referenced inode and releases it with its last reference.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseManagerStaticTest, CloudForgetTest001, TestSize.Level1) {
+    fuse_req_t req = nullptr;
+    auto data = make_shared<FuseData>();
+    auto node = make_shared<CloudInode>();
+    node->mBase = make_shared<MetaBase>("IMG_10.jpg");
+    node->refCount = 2;
+    data->inodeCache[10] = node;
+
+    EXPECT_CALL(*insMock, fuse_req_userdata(_)).WillRepeatedly(Return(reinterpret_cast<void*>(data.get())));
+    EXPECT_CALL(*insMock, fuse_reply_none(_)).Times(2);
+    CloudForget(req, 10, 1);
+    ASSERT_EQ(data->inodeCache.count(10), 1);
+    EXPECT_EQ(node->refCount, 1);
+    CloudForget(req, 10, 1);
+    EXPECT_EQ(data->inodeCache.count(10), 0);
+}
+
+/**
+ * @tc.name: CloudForgetMultiBenchmark001
+ * @tc.desc: Compare evicting large inode sets with one forget batch against one forget per inode.
+ * @tc.type: PERF
+ */
+HWTEST_F(FuseManagerStaticTest, CloudForgetMultiBenchmark001, TestSize.Level1) {
+    fuse_req_t req = nullptr;
+    auto data = make_shared<FuseData>();
+    auto fill = [&data](uint64_t count) {
+        for (uint64_t ino = FUSE_ROOT_ID + 1; ino <= count + FUSE_ROOT_ID; ino++) {
+            auto node = make_shared<CloudInode>();
+            node->mBase = make_shared<MetaBase>("IMG_" + to_string(ino) + ".jpg");
+            node->refCount = 1;
+            data->inodeCache[ino] = node;
+        }
+    };
+    EXPECT_CALL(*insMock, fuse_req_userdata(_)).WillRepeatedly(Return(reinterpret_cast<void*>(data.get())));
+    EXPECT_CALL(*insMock, fuse_reply_none(_)).Times(AnyNumber());
+    for (uint64_t count = 64; count <= 4096; count *= 8) {
+        vector<struct fuse_forget_data> forgets;
+        for (uint64_t ino = FUSE_ROOT_ID + 1; ino <= count + FUSE_ROOT_ID; ino++) {
+            forgets.push_back({ino, 1});
+        }
+        fill(count);
+        auto begin = chrono::steady_clock::now();
+        for (const auto &forget : forgets) {
+            CloudForget(req, forget.ino, forget.nlookup);
+        }
+        auto singleCost = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - begin);
+        EXPECT_TRUE(data->inodeCache.empty());
+
+        fill(count);
+        begin = chrono::steady_clock::now();
+        CloudForgetMulti(req, forgets.size(), forgets.data());
+        auto batchCost = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - begin);
+        EXPECT_TRUE(data->inodeCache.empty());
+        GTEST_LOG_(INFO) << "inodes: " << count << ", ns per inode one by one: " << singleCost.count() / count
+                         << ", ns per inode batched: " << batchCost.count() / count;
+    }
+}
+
+/* read session whose cloud answers after a fixed delay */
+class FakeReadSession : public CloudAssetReadSession {
+public:
+    FakeReadSession(chrono::milliseconds latency, atomic<int> &inits)
+        : CloudAssetReadSession(USER_ID, "media", "", "", ""), latency_(latency), inits_(inits)
+    {
+    }
+    CloudError InitSession() override
+    {
+        inits_++;
+        this_thread::sleep_for(latency_);
+        return CloudError::CK_NO_ERROR;
+    }
+    void CancelSession() override {}
+    bool Close(bool needRemain) override
+    {
+        return true;
+    }
+
+private:
+    chrono::milliseconds latency_;
+    atomic<int> &inits_;
+};
+
+class FakeCloudDatabase : public CloudDatabase {
+public:
+    FakeCloudDatabase(chrono::milliseconds latency, bool fail)
+        : CloudDatabase(USER_ID, PHOTOS_BUNDLE_NAME), latency_(latency), fail_(fail)
+    {
+    }
+    shared_ptr<CloudAssetReadSession> NewAssetReadSession(const int32_t userId, string recordType,
+        string recordId, string assetKey, string assetPath) override
+    {
+        sessions_++;
+        if (fail_) {
+            return nullptr;
+        }
+        return make_shared<FakeReadSession>(latency_, inits_);
+    }
+    atomic<int> sessions_{0};
+    atomic<int> inits_{0};
+
+private:
+    chrono::milliseconds latency_;
+    bool fail_;
+};
+
+static shared_ptr<CloudInode> AddContentInode(shared_ptr<FuseData> data, fuse_ino_t ino,
+    fuse_ino_t parent = FUSE_ROOT_ID)
+{
+    auto cInode = make_shared<CloudInode>();
+    cInode->parent = parent;
+    cInode->mBase = make_shared<MetaBase>("IMG_" + to_string(ino) + ".jpg");
+    cInode->mBase->fileType = FILE_TYPE_CONTENT;
+    cInode->path = "/" + cInode->mBase->name;
+    cInode->refCount = 1;
+    data->inodeCache[ino] = cInode;
+    return cInode;
+}
+
+/**
+ * @tc.name: CloudOpenAsyncTest001
+ * @tc.desc: Verify that opens of an uncached file return to the fuse worker at once and share one session.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseManagerStaticTest, CloudOpenAsyncTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "CloudOpenAsyncTest001 Begin";
+    constexpr chrono::milliseconds latency = 500ms;
+    constexpr size_t opens = 4;
+    auto data = make_shared<FuseData>();
+    data->userId = USER_ID;
+    auto database = make_shared<FakeCloudDatabase>(latency, false);
+    data->database = database;
+    auto cInode = AddContentInode(data, 10);
+    vector<struct fuse_req> reqs(opens);
+    atomic<size_t> replied{0};
+
+    EXPECT_CALL(*insMock, fuse_req_userdata(_)).WillRepeatedly(Return(reinterpret_cast<void*>(data.get())));
+    EXPECT_CALL(*insMock, fuse_reply_open(_, _)).Times(opens).WillRepeatedly(Invoke([&replied](auto, auto) {
+        replied++;
+        return 0;
+    }));
+    auto begin = chrono::steady_clock::now();
+    for (auto &req : reqs) {
+        struct fuse_file_info fi = {};
+        CloudOpen(&req, 10, &fi);
+    }
+    auto cost = chrono::steady_clock::now() - begin;
+    EXPECT_LT(cost, latency);
+    ffrt::wait();
+    auto deadline = chrono::steady_clock::now() + latency * 4;
+    while (replied.load() < opens && chrono::steady_clock::now() < deadline) {
+        this_thread::sleep_for(10ms);
+    }
+
+    EXPECT_EQ(replied.load(), opens);
+    EXPECT_EQ(database->sessions_.load(), 1);
+    EXPECT_EQ(cInode->sessionRefCount.load(), static_cast<int>(opens));
+    EXPECT_FALSE(cInode->opening);
+    EXPECT_EQ(data->cloudFdCache.size(), opens);
+    GTEST_LOG_(INFO) << "CloudOpenAsyncTest001 End";
+}
+
+/**
+ * @tc.name: CloudOpenAsyncTest002
+ * @tc.desc: Verify that every queued open fails when the read session cannot be created.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseManagerStaticTest, CloudOpenAsyncTest002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "CloudOpenAsyncTest002 Begin";
+    constexpr size_t opens = 3;
+    auto data = make_shared<FuseData>();
+    data->userId = USER_ID;
+    auto database = make_shared<FakeCloudDatabase>(0ms, true);
+    data->database = database;
+    auto cInode = AddContentInode(data, 11);
+    vector<struct fuse_req> reqs(opens);
+    atomic<size_t> failed{0};
+
+    EXPECT_CALL(*insMock, fuse_req_userdata(_)).WillRepeatedly(Return(reinterpret_cast<void*>(data.get())));
+    EXPECT_CALL(*insMock, fuse_reply_open(_, _)).Times(0);
+    EXPECT_CALL(*insMock, fuse_reply_err(_, EPERM)).WillRepeatedly(Invoke([&failed](auto, auto) {
+        failed++;
+        return 0;
+    }));
+    // keep the task from running until every open is queued
+    cInode->opening = true;
+    for (auto &req : reqs) {
+        struct fuse_file_info fi = {};
+        CloudOpen(&req, 11, &fi);
+    }
+    EXPECT_EQ(cInode->pendingOpens.size(), opens);
+    CloudOpenAsync(data.get(), cInode, 11, database);
+
+    EXPECT_EQ(failed.load(), opens);
+    EXPECT_EQ(database->sessions_.load(), 1);
+    EXPECT_EQ(cInode->readSession, nullptr);
+    EXPECT_FALSE(cInode->opening);
+    EXPECT_TRUE(data->cloudFdCache.empty());
+    GTEST_LOG_(INFO) << "CloudOpenAsyncTest002 End";
+}
+/**
+ * @tc.name: PredictNextOpensTest001
+ * @tc.desc: Verify that the opens predicted follow the lookup order, backwards when the opens walk back.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseManagerStaticTest, PredictNextOpensTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "PredictNextOpensTest001 Begin";
+    constexpr fuse_ino_t parent = 5;
+    auto data = make_shared<FuseData>();
+    data->warmer.enabled = true;
+    for (fuse_ino_t ino = 20; ino <= 26; ino++) {
+        RecordLookupOrder(data.get(), parent, ino);
+    }
+    RecordLookupOrder(data.get(), parent, 21);
+
+    EXPECT_EQ(PredictNextOpens(data->warmer, parent, 21), vector<fuse_ino_t>({22, 23, 24}));
+    // already warming
+    EXPECT_EQ(PredictNextOpens(data->warmer, parent, 22), vector<fuse_ino_t>({25}));
+    data->warmer.warming.clear();
+    EXPECT_EQ(PredictNextOpens(data->warmer, parent, 26), vector<fuse_ino_t>({}));
+    EXPECT_EQ(PredictNextOpens(data->warmer, parent, 25), vector<fuse_ino_t>({24, 23, 22}));
+    EXPECT_EQ(PredictNextOpens(data->warmer, parent + 1, 25), vector<fuse_ino_t>({}));
+    GTEST_LOG_(INFO) << "PredictNextOpensTest001 End";
+}
+
+/**
+ * @tc.name: WarmSessionTest001
+ * @tc.desc: Verify that a session warmed for the next asset is used by its open instead of a new one.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseManagerStaticTest, WarmSessionTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "WarmSessionTest001 Begin";
+    constexpr fuse_ino_t parent = 5;
+    auto data = make_shared<FuseData>();
+    data->userId = USER_ID;
+    data->warmer.enabled = true;
+    auto database = make_shared<FakeCloudDatabase>(0ms, false);
+    data->database = database;
+    auto first = AddContentInode(data, 30, parent);
+    auto next = AddContentInode(data, 31, parent);
+    RecordLookupOrder(data.get(), parent, 30);
+    RecordLookupOrder(data.get(), parent, 31);
+    struct fuse_req reqs[2] = {};
+
+    EXPECT_CALL(*insMock, fuse_req_userdata(_)).WillRepeatedly(Return(reinterpret_cast<void*>(data.get())));
+    EXPECT_CALL(*insMock, fuse_reply_open(_, _)).Times(2).WillRepeatedly(Return(0));
+    struct fuse_file_info fi = {};
+    CloudOpen(&reqs[0], 30, &fi);
+    ffrt::wait();
+    EXPECT_EQ(database->sessions_.load(), 2);
+    ASSERT_EQ(data->warmer.sessions.count(31), 1);
+    EXPECT_TRUE(data->warmer.warming.empty());
+
+    CloudOpen(&reqs[1], 31, &fi);
+    ffrt::wait();
+    EXPECT_EQ(database->sessions_.load(), 2);
+    EXPECT_EQ(database->inits_.load(), 2);
+    EXPECT_TRUE(data->warmer.sessions.empty());
+    EXPECT_NE(next->readSession, nullptr);
+    EXPECT_EQ(next->sessionRefCount.load(), 1);
+    EXPECT_EQ(first->sessionRefCount.load(), 1);
+    GTEST_LOG_(INFO) << "WarmSessionTest001 End";
+}
+
+/**
+ * @tc.name: WarmSessionTest002
+ * @tc.desc: Verify that warmed sessions are bounded by count and dropped once too old.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseManagerStaticTest, WarmSessionTest002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "WarmSessionTest002 Begin";
+    auto data = make_shared<FuseData>();
+    data->warmer.enabled = true;
+    atomic<int> inits{0};
+    // stored in order, and all older than allowed by the time they are taken
+    int64_t createdMs = SteadyMilliSeconds() - WARM_SESSION_TTL_MS * 2;
+    vector<shared_ptr<CloudAssetReadSession>> dropped;
+    for (fuse_ino_t ino = 40; ino < 40 + MAX_WARM_SESSIONS + 2; ino++) {
+        WarmSession warm;
+        warm.session = make_shared<FakeReadSession>(0ms, inits);
+        warm.createdMs = createdMs + static_cast<int64_t>(ino);
+        StoreWarmSessionLocked(data->warmer, ino, std::move(warm), dropped);
+    }
+    EXPECT_EQ(data->warmer.sessions.size(), MAX_WARM_SESSIONS);
+    EXPECT_EQ(dropped.size(), 2);
+    EXPECT_EQ(data->warmer.sessions.count(40), 0);
+    EXPECT_EQ(data->warmer.sessions.count(41), 0);
+
+    EXPECT_EQ(TakeWarmSession(data.get(), 42, "", MetaBase()), nullptr);
+    EXPECT_TRUE(data->warmer.sessions.empty());
+    GTEST_LOG_(INFO) << "WarmSessionTest002 End";
+}
+
+/**
+ * @tc.name: WarmSessionTest004
+ * @tc.desc: Verify that a session warmed for an asset that a lookup replaced since is dropped.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseManagerStaticTest, WarmSessionTest004, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "WarmSessionTest004 Begin";
+    auto data = make_shared<FuseData>();
+    data->warmer.enabled = true;
+    atomic<int> inits{0};
+    MetaBase mBase("IMG_60.jpg", "cloudId60");
+    mBase.size = 100;
+    mBase.mtime = 1;
+    vector<shared_ptr<CloudAssetReadSession>> dropped;
+    for (fuse_ino_t ino = 60; ino <= 62; ino++) {
+        WarmSession warm;
+        warm.session = make_shared<FakeReadSession>(0ms, inits);
+        warm.createdMs = SteadyMilliSeconds();
+        warm.recordId = "record60";
+        warm.size = mBase.size;
+        warm.mtime = mBase.mtime;
+        StoreWarmSessionLocked(data->warmer, ino, std::move(warm), dropped);
+    }
+    EXPECT_TRUE(dropped.empty());
+
+    EXPECT_NE(TakeWarmSession(data.get(), 60, "record60", mBase), nullptr);
+    EXPECT_EQ(TakeWarmSession(data.get(), 61, "record61", mBase), nullptr);
+    mBase.mtime = 2;
+    EXPECT_EQ(TakeWarmSession(data.get(), 62, "record60", mBase), nullptr);
+    EXPECT_TRUE(data->warmer.sessions.empty());
+    GTEST_LOG_(INFO) << "WarmSessionTest004 End";
+}
+
+/**
+ * @tc.name: WarmSessionTest003
+ * @tc.desc: Verify that draining a session waits for its open and warm tasks and closes the warm sessions left.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseManagerStaticTest, WarmSessionTest003, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "WarmSessionTest003 Begin";
+    constexpr fuse_ino_t parent = 5;
+    auto data = make_shared<FuseData>();
+    data->userId = USER_ID;
+    data->warmer.enabled = true;
+    auto database = make_shared<FakeCloudDatabase>(20ms, false);
+    data->database = database;
+    AddContentInode(data, 50, parent);
+    AddContentInode(data, 51, parent);
+    RecordLookupOrder(data.get(), parent, 50);
+    RecordLookupOrder(data.get(), parent, 51);
+    struct fuse_req req = {};
+
+    EXPECT_CALL(*insMock, fuse_req_userdata(_)).WillRepeatedly(Return(reinterpret_cast<void*>(data.get())));
+    EXPECT_CALL(*insMock, fuse_reply_open(_, _)).WillOnce(Return(0));
+    struct fuse_file_info fi = {};
+    CloudOpen(&req, 50, &fi);
+    DrainSessionTasks(data.get());
+    EXPECT_EQ(data->tasks.running, 0);
+    EXPECT_EQ(database->inits_.load(), 2);
+    ASSERT_EQ(data->warmer.sessions.count(51), 1);
+    weak_ptr<CloudAssetReadSession> warmed = data->warmer.sessions[51].session;
+
+    CloseAllWarmSessions(data.get());
+    EXPECT_TRUE(data->warmer.sessions.empty());
+    EXPECT_TRUE(data->warmer.dirs.empty());
+    EXPECT_TRUE(warmed.expired());
+    EXPECT_FALSE(SubmitSessionTask(data.get(), [] {}));
+    GTEST_LOG_(INFO) << "WarmSessionTest003 End";
+}
+
 } // namespace OHOS::FileManagement::CloudSync::Test
\ No newline at end of file
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "fuse_watchdog.h"
+
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <thread>
+
+namespace OHOS::FileManagement::CloudFile::Test {
+using namespace testing;
+using namespace testing::ext;
+using namespace std;
+
+namespace {
+constexpr chrono::milliseconds SCAN_PERIOD = 10ms;
+constexpr uint32_t TIMEOUT_MS = 30;
+
+void CountOverrun(void *arg)
+{
+    static_cast<atomic<uint32_t> *>(arg)->fetch_add(1);
+}
+
+size_t GetSlotCount(FuseWatchdog &watchdog)
+{
+    lock_guard<mutex> lock(watchdog.mutex_);
+    return watchdog.slots_.size();
+}
+} // namespace
+
+class FuseWatchdogTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) {};
+    static void TearDownTestCase(void) {};
+    void SetUp() {};
+    void TearDown() {};
+};
+
+/**
+ * @tc.name: GuardTest001
+ * @tc.desc: Verify that operations finishing in time are not reported.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseWatchdogTest, GuardTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GuardTest001 Start";
+    FuseWatchdog watchdog(SCAN_PERIOD);
+    atomic<uint32_t> overruns{0};
+    for (int i = 0; i < 10; i++) {
+        FuseWatchdog::Guard guard("GuardTest001", TIMEOUT_MS, CountOverrun, &overruns, watchdog);
+        this_thread::sleep_for(1ms);
+    }
+    this_thread::sleep_for(chrono::milliseconds(TIMEOUT_MS) + SCAN_PERIOD * 3);
+    EXPECT_EQ(overruns.load(), 0);
+    EXPECT_EQ(watchdog.GetOverrunCount(), 0);
+    GTEST_LOG_(INFO) << "GuardTest001 End";
+}
+
+/**
+ * @tc.name: OverrunTest001
+ * @tc.desc: Verify that an overrunning operation fires its callback once before it returns.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseWatchdogTest, OverrunTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "OverrunTest001 Start";
+    FuseWatchdog watchdog(SCAN_PERIOD);
+    atomic<uint32_t> overruns{0};
+    {
+        FuseWatchdog::Guard guard("OverrunTest001", TIMEOUT_MS, CountOverrun, &overruns, watchdog);
+        this_thread::sleep_for(chrono::milliseconds(TIMEOUT_MS * 4));
+    }
+    EXPECT_EQ(overruns.load(), 1);
+    EXPECT_EQ(watchdog.GetOverrunCount(), 1);
+
+    {
+        FuseWatchdog::Guard guard("OverrunTest001", TIMEOUT_MS, nullptr, nullptr, watchdog);
+        this_thread::sleep_for(chrono::milliseconds(TIMEOUT_MS * 4));
+    }
+    EXPECT_EQ(overruns.load(), 1);
+    EXPECT_EQ(watchdog.GetOverrunCount(), 2);
+    GTEST_LOG_(INFO) << "OverrunTest001 End";
+}
+
+/**
+ * @tc.name: NestedTest001
+ * @tc.desc: Verify that an operation nested in another one of the same thread is covered by the outer one.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseWatchdogTest, NestedTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "NestedTest001 Start";
+    FuseWatchdog watchdog(SCAN_PERIOD);
+    atomic<uint32_t> outer{0};
+    atomic<uint32_t> inner{0};
+    {
+        FuseWatchdog::Guard outerGuard("NestedTest001", TIMEOUT_MS, CountOverrun, &outer, watchdog);
+        FuseWatchdog::Guard innerGuard("NestedTest001", TIMEOUT_MS, CountOverrun, &inner, watchdog);
+        this_thread::sleep_for(chrono::milliseconds(TIMEOUT_MS * 4));
+    }
+    EXPECT_EQ(outer.load(), 1);
+    EXPECT_EQ(inner.load(), 0);
+    GTEST_LOG_(INFO) << "NestedTest001 End";
+}
+
+/**
+ * @tc.name: RetireTest001
+ * @tc.desc: Verify that the slot of an exited thread is dropped by the scanner.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FuseWatchdogTest, RetireTest001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "RetireTest001 Start";
+    FuseWatchdog watchdog(SCAN_PERIOD);
+    thread([&watchdog] {
+        FuseWatchdog::Guard guard("RetireTest001", TIMEOUT_MS, nullptr, nullptr, watchdog);
+    }).join();
+    auto deadline = chrono::steady_clock::now() + 5s;
+    while (GetSlotCount(watchdog) != 0 && chrono::steady_clock::now() < deadline) {
+        this_thread::sleep_for(SCAN_PERIOD);
+    }
+    EXPECT_EQ(GetSlotCount(watchdog), 0);
+    GTEST_LOG_(INFO) << "RetireTest001 End";
+}
+
+/**
+ * @tc.name: GuardBenchmark001
+ * @tc.desc: Measure what watching one operation costs the thread running it.
+ * @tc.type: PERF
+ */
+HWTEST_F(FuseWatchdogTest, GuardBenchmark001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GuardBenchmark001 Start";
+    constexpr uint32_t rounds = 100000;
+    FuseWatchdog watchdog(SCAN_PERIOD);
+    auto begin = chrono::steady_clock::now();
+    for (uint32_t i = 0; i < rounds; i++) {
+        FuseWatchdog::Guard guard("GuardBenchmark001", TIMEOUT_MS, nullptr, nullptr, watchdog);
+    }
+    auto cost = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - begin);
+    EXPECT_EQ(watchdog.GetOverrunCount(), 0);
+    GTEST_LOG_(INFO) << "ns per watched operation: " << cost.count() / rounds;
+    GTEST_LOG_(INFO) << "GuardBenchmark001 End";
+}
+} // namespace OHOS::FileManagement::CloudFile::Test
@@ -58,6 +58,7 @@ public:
     int32_t DoRename(MetaBase &metaBase, const std::string &newName, std::shared_ptr<MetaFile> newMetaFile);
     int32_t DoLookup(MetaBase &base);
     int32_t LoadChildren(std::vector<MetaBase> &bases);
+    bool IsStale();
 
     static std::string GetParentDir(const std::string &path);
     static std::string GetFileName(const std::string &path);
@@ -73,6 +74,8 @@ private:
     std::string name_{};
     UniqueFd fd_{};
     uint32_t userId_{};
+    dev_t dev_{0};
+    ino_t ino_{0};
     std::shared_ptr<MetaFile> parentMetaFile_{nullptr};
 };
 
@@ -140,10 +143,14 @@ public:
     static std::string RecordIdToCloudId(const std::string hexStr, bool isHdc = false);
     static std::string CloudIdToRecordId(const std::string cloudId, bool isHdc = false);
     std::shared_ptr<MetaFile> GetMetaFile(uint32_t userId, const std::string &path);
+    /* same as GetMetaFile, but a cached handle whose dentry file was replaced on disk is opened again */
+    std::shared_ptr<MetaFile> GetRevalidatedMetaFile(uint32_t userId, const std::string &path);
     std::shared_ptr<CloudDiskMetaFile> GetCloudDiskMetaFile(uint32_t userId, const std::string &bundleName,
         const std::string &cloudId);
     void ClearAll();
     void CloudDiskClearAll();
+    /* drops the cached dentry files of one bundle of one user */
+    void CloudDiskClearBundle(uint32_t userId, const std::string &bundleName);
     void Clear(uint32_t userId, const std::string &bundleName, const std::string &cloudId);
     int32_t CreateRecycleDentry(uint32_t userId, const std::string &bundleName);
     int32_t MoveIntoRecycleDentryfile(uint32_t userId, const std::string &bundleName,
@@ -173,6 +173,11 @@ MetaFile::MetaFile(uint32_t userId, const std::string &path)
         LOGE("fd=%{public}d, errno :%{public}d", fd_.Get(), errno);
         return;
     }
+    struct stat fileStat {};
+    if (fstat(fd_, &fileStat) == 0) {
+        dev_ = fileStat.st_dev;
+        ino_ = fileStat.st_ino;
+    }
 
     int ret = fsetxattr(fd_, "user.hmdfs_cache", path.c_str(), path.size(), 0);
     if (ret != 0) {
@@ -203,6 +208,18 @@ MetaFile::~MetaFile()
 {
 }
 
+bool MetaFile::IsStale()
+{
+    if (fd_ < 0) {
+        return true;
+    }
+    struct stat fileStat {};
+    if (stat(cacheFile_.c_str(), &fileStat) != 0) {
+        return true;
+    }
+    return fileStat.st_dev != dev_ || fileStat.st_ino != ino_;
+}
+
 static inline uint32_t GetDentrySlots(size_t nameLen)
 {
     return static_cast<uint32_t>((nameLen + BITS_PER_BYTE - 1) >> HMDFS_SLOT_LEN_BITS);
@@ -702,6 +719,36 @@ std::shared_ptr<MetaFile> MetaFileMgr::GetMetaFile(uint32_t userId, const std::s
     return mFile;
 }
 
+std::shared_ptr<MetaFile> MetaFileMgr::GetRevalidatedMetaFile(uint32_t userId, const std::string &path)
+{
+    MetaFileKey key(userId, path);
+    std::shared_ptr<MetaFile> cached = nullptr;
+    {
+        std::lock_guard<std::recursive_mutex> lock(mtx_);
+        auto it = metaFiles_.find(key);
+        if (it != metaFiles_.end()) {
+            cached = it->second->second;
+        }
+    }
+    if (cached == nullptr) {
+        return GetMetaFile(userId, path);
+    }
+    // the stat runs without mtx_, so lookups in other directories do not queue behind it
+    bool stale = cached->IsStale();
+    std::lock_guard<std::recursive_mutex> lock(mtx_);
+    auto it = metaFiles_.find(key);
+    if (it != metaFiles_.end() && it->second->second == cached) {
+        if (!stale) {
+            metaFileList_.splice(metaFileList_.begin(), metaFileList_, it->second);
+            return cached;
+        }
+        LOGI("dentry file of %{public}s is replaced, reopen it", GetAnonyString(path).c_str());
+        metaFileList_.erase(it->second);
+        metaFiles_.erase(it);
+    }
+    return GetMetaFile(userId, path);
+}
+
 int32_t MetaFileMgr::CheckMetaFileSize()
 {
     std::lock_guard<std::recursive_mutex> lock(mtx_);
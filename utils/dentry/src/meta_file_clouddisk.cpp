@@ -753,6 +753,27 @@ void MetaFileMgr::CloudDiskClearAll()
     cloudDiskMetaFileList_.clear();
 }
 
+void MetaFileMgr::CloudDiskClearBundle(uint32_t userId, const std::string &bundleName)
+{
+    if (bundleName.empty()) {
+        return;
+    }
+    // keys are cloudId + bundleName, a bundle whose name merely ends with bundleName is reloaded on next use
+    auto isBundleKey = [userId, &bundleName](const MetaFileKey &key) {
+        return key.first == userId && key.second.size() >= bundleName.size() &&
+            key.second.compare(key.second.size() - bundleName.size(), bundleName.size(), bundleName) == 0;
+    };
+    std::lock_guard<std::mutex> lock(cloudDiskMutex_);
+    for (auto it = cloudDiskMetaFileList_.begin(); it != cloudDiskMetaFileList_.end();) {
+        if (!isBundleKey(it->first)) {
+            it++;
+            continue;
+        }
+        cloudDiskMetaFile_.erase(it->first);
+        it = cloudDiskMetaFileList_.erase(it);
+    }
+}
+
 std::shared_ptr<CloudDiskMetaFile> MetaFileMgr::GetCloudDiskMetaFile(uint32_t userId, const std::string &bundleName,
     const std::string &cloudId)
 {